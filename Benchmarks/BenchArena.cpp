@@ -0,0 +1,50 @@
+#include <memory>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Memory/ArenaAllocator.hpp"
+
+using namespace lux;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+
+    struct Node
+    {
+        float position[3];
+        uint32_t index;
+        Node* next;
+    };
+}
+
+// Baseline: one heap allocation and release per transient object
+LUX_BENCHMARK(Arena_NewDelete)
+{
+    std::vector<Node*> nodes(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            nodes[i] = new Node{{}, static_cast<uint32_t>(i), nullptr};
+        bench::DoNotOptimize(nodes.data());
+
+        for (Node* node : nodes)
+            delete node;
+    });
+}
+
+// Same objects out of a frame arena, blocks are kept across resets
+LUX_BENCHMARK(Arena_CreateReset)
+{
+    Arena arena {16 * 1024};
+    std::vector<Node*> nodes(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            nodes[i] = arena.Create<Node>(Node{{}, static_cast<uint32_t>(i), nullptr});
+        bench::DoNotOptimize(nodes.data());
+
+        arena.Reset();
+    });
+}
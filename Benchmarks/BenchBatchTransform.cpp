@@ -0,0 +1,133 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/BatchTransform.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+
+    Matrix4f BenchMatrix()
+    {
+        return Matrix4f::Translate(Vector3f(1.0f, 2.0f, 3.0f)) * Matrix4f::Rotate(0.5f, Vector3f(0.0f, 1.0f, 0.0f)) *
+               Matrix4f::Scale(2.0f);
+    }
+
+    std::vector<Vector3f> RandomPoints(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {-100.0f, 100.0f};
+
+        std::vector<Vector3f> points;
+        points.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            points.emplace_back(dist(rng), dist(rng), dist(rng));
+        return points;
+    }
+}
+
+// Baseline: one Matrix4f * Vector4f per point
+LUX_BENCHMARK(TransformPoints_PerElement)
+{
+    Matrix4f m = BenchMatrix();
+    auto in = RandomPoints(Count, 1);
+    std::vector<Vector3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+        {
+            Vector4f p = m * Vector4f(in[i], 1.0f);
+            out[i] = Vector3f(p[0], p[1], p[2]);
+        }
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(TransformPoints_AoS)
+{
+    Matrix4f m = BenchMatrix();
+    auto in = RandomPoints(Count, 1);
+    std::vector<Vector3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        TransformPoints(m, in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(TransformPoints_SoA)
+{
+    Matrix4f m = BenchMatrix();
+    std::vector<float> x(Count), y(Count), z(Count), ox(Count), oy(Count), oz(Count);
+    for (size_t i = 0; const auto& p : RandomPoints(Count, 1))
+    {
+        x[i] = p.GetX(); y[i] = p.GetY(); z[i] = p.GetZ();
+        ++i;
+    }
+
+    state.Run(Count, [&]
+    {
+        TransformPoints(m, ConstVector3Stream {x, y, z}, Vector3Stream {ox, oy, oz});
+        bench::DoNotOptimize(ox.data());
+    });
+}
+
+LUX_BENCHMARK(TransformDirections_AoS)
+{
+    Matrix4f m = BenchMatrix();
+    auto in = RandomPoints(Count, 2);
+    std::vector<Vector3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        TransformDirections(m, in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+// Baseline: transform the eight corners and rebuild the box
+LUX_BENCHMARK(TransformAABBs_Corners)
+{
+    Matrix4f m = BenchMatrix();
+    auto points = RandomPoints(Count * 2, 3);
+    std::vector<AABB> in, out(Count);
+    for (size_t i = 0; i < Count; ++i)
+        in.push_back(AABB::FromPoints(std::span(points).subspan(i * 2, 2)));
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+        {
+            Vector3f corners[8];
+            for (int c = 0; c < 8; ++c)
+            {
+                Vector4f p = m * Vector4f(Vector3f(c & 1 ? in[i].max.GetX() : in[i].min.GetX(),
+                                                   c & 2 ? in[i].max.GetY() : in[i].min.GetY(),
+                                                   c & 4 ? in[i].max.GetZ() : in[i].min.GetZ()), 1.0f);
+                corners[c] = Vector3f(p[0], p[1], p[2]);
+            }
+            out[i] = AABB::FromPoints(corners);
+        }
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(TransformAABBs_AoS)
+{
+    Matrix4f m = BenchMatrix();
+    auto points = RandomPoints(Count * 2, 3);
+    std::vector<AABB> in, out(Count);
+    for (size_t i = 0; i < Count; ++i)
+        in.push_back(AABB::FromPoints(std::span(points).subspan(i * 2, 2)));
+
+    state.Run(Count, [&]
+    {
+        TransformAABBs(m, in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
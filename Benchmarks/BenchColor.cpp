@@ -0,0 +1,80 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/Color.hpp"
+
+using namespace lux;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+
+    std::vector<Color> RandomColors(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {0.0f, 1.0f};
+
+        std::vector<Color> colors;
+        colors.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            colors.emplace_back(dist(rng), dist(rng), dist(rng), dist(rng));
+        return colors;
+    }
+}
+
+LUX_BENCHMARK(Color_MultiplyAdd)
+{
+    auto a = RandomColors(Count, 1);
+    auto b = RandomColors(Count, 2);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = a[i] * b[i] + a[i];
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Color_Lerp)
+{
+    auto a = RandomColors(Count, 1);
+    auto b = RandomColors(Count, 2);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = Color::Lerp(a[i], b[i], 0.25f);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Color_Clamp)
+{
+    auto in = RandomColors(Count, 3);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = (in[i] * 1.5f).Clamp(0);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Color_UnpackFromFloat)
+{
+    auto in = RandomColors(Count, 4);
+    std::vector<float> packed(Count);
+    for (size_t i = 0; i < Count; ++i)
+        packed[i] = PackColorToFloat(in[i]);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = UnpackColorFromFloat(packed[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
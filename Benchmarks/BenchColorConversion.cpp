@@ -0,0 +1,162 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/ColorConversion.hpp"
+
+using namespace lux;
+
+namespace
+{
+    constexpr size_t Count = 16384;
+
+    std::vector<Color> RandomColors(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {0.0f, 1.0f};
+
+        std::vector<Color> colors;
+        colors.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            colors.emplace_back(dist(rng), dist(rng), dist(rng), dist(rng));
+        return colors;
+    }
+}
+
+// Baseline: std::pow per component
+LUX_BENCHMARK(SrgbToLinear_Pow)
+{
+    auto in = RandomColors(Count, 1);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = Color(SrgbToLinear(in[i].GetR()), SrgbToLinear(in[i].GetG()), SrgbToLinear(in[i].GetB()), in[i].GetA());
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(SrgbToLinear_Batch)
+{
+    auto in = RandomColors(Count, 1);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        SrgbToLinear(in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+// Baseline: std::pow per component
+LUX_BENCHMARK(LinearToSrgb_Pow)
+{
+    auto in = RandomColors(Count, 2);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = Color(LinearToSrgb(in[i].GetR()), LinearToSrgb(in[i].GetG()), LinearToSrgb(in[i].GetB()), in[i].GetA());
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(LinearToSrgb_Batch)
+{
+    auto in = RandomColors(Count, 2);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        LinearToSrgb(in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(PremultiplyAlpha_Batch)
+{
+    auto in = RandomColors(Count, 3);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        PremultiplyAlpha(in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+// Baseline: the existing one color at a time packer
+LUX_BENCHMARK(PackRGBA8_PerElement)
+{
+    auto in = RandomColors(Count, 4);
+    std::vector<float> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = PackColorToFloat(in[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(PackRGBA8_Batch)
+{
+    auto in = RandomColors(Count, 4);
+    std::vector<uint8_t> out(Count * 4);
+
+    state.Run(Count, [&]
+    {
+        PackRGBA8(in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(PackSrgbRGBA8_Batch)
+{
+    auto in = RandomColors(Count, 5);
+    std::vector<uint8_t> out(Count * 4);
+
+    state.Run(Count, [&]
+    {
+        PackSrgbRGBA8(in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(PackRGB10A2_Batch)
+{
+    auto in = RandomColors(Count, 6);
+    std::vector<uint32_t> out(Count);
+
+    state.Run(Count, [&]
+    {
+        PackRGB10A2(in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(PackRGBA16F_Batch)
+{
+    auto in = RandomColors(Count, 7);
+    std::vector<uint16_t> out(Count * 4);
+
+    state.Run(Count, [&]
+    {
+        PackRGBA16F(in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(UnpackSrgbRGBA8_Table)
+{
+    std::vector<uint8_t> in(Count * 4);
+    PackRGBA8(RandomColors(Count, 8), in);
+    std::vector<Color> out(Count);
+
+    state.Run(Count, [&]
+    {
+        UnpackSrgbRGBA8(in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
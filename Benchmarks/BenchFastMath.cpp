@@ -0,0 +1,108 @@
+#include <cmath>
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/FastMath.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+
+    std::vector<float> RandomFloats(size_t count, unsigned seed, float min, float max)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {min, max};
+
+        std::vector<float> values(count);
+        for (float& v : values)
+            v = dist(rng);
+        return values;
+    }
+}
+
+// Baselines: the std:: functions one element at a time
+
+LUX_BENCHMARK(SinCos_Std)
+{
+    auto angles = RandomFloats(Count, 1, -10.0f, 10.0f);
+    std::vector<float> sines(Count), cosines(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+        {
+            sines[i] = std::sin(angles[i]);
+            cosines[i] = std::cos(angles[i]);
+        }
+        bench::DoNotOptimize(sines.data());
+        bench::DoNotOptimize(cosines.data());
+    });
+}
+
+LUX_BENCHMARK(SinCos_Fast)
+{
+    auto angles = RandomFloats(Count, 1, -10.0f, 10.0f);
+    std::vector<float> sines(Count), cosines(Count);
+
+    state.Run(Count, [&]
+    {
+        fast::SinCos(angles, sines, cosines);
+        bench::DoNotOptimize(sines.data());
+        bench::DoNotOptimize(cosines.data());
+    });
+}
+
+LUX_BENCHMARK(Atan2_Std)
+{
+    auto ys = RandomFloats(Count, 2, -10.0f, 10.0f);
+    auto xs = RandomFloats(Count, 3, -10.0f, 10.0f);
+    std::vector<float> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = std::atan2(ys[i], xs[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Atan2_Fast)
+{
+    auto ys = RandomFloats(Count, 2, -10.0f, 10.0f);
+    auto xs = RandomFloats(Count, 3, -10.0f, 10.0f);
+    std::vector<float> out(Count);
+
+    state.Run(Count, [&]
+    {
+        fast::Atan2(ys, xs, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Rsqrt_Std)
+{
+    auto values = RandomFloats(Count, 4, 0.01f, 100.0f);
+    std::vector<float> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = 1.0f / std::sqrt(values[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Rsqrt_Fast)
+{
+    auto values = RandomFloats(Count, 4, 0.01f, 100.0f);
+    std::vector<float> out(Count);
+
+    state.Run(Count, [&]
+    {
+        fast::Rsqrt(values, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
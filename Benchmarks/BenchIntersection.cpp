@@ -0,0 +1,147 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/Geometry/Intersection.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+/*  Every benchmark casts Rays rays against Primitives primitives per call and counts one
+ *  element per ray, so elements/s reads as rays/s against the whole set.
+ *----------------------------------------------------------------------------------------*/
+namespace
+{
+    constexpr size_t Rays = 64;
+    constexpr size_t Primitives = 1024;
+
+    Vector3f RandomVector(std::mt19937& rng, float extent)
+    {
+        std::uniform_real_distribution<float> dist {-extent, extent};
+        return Vector3f {dist(rng), dist(rng), dist(rng)};
+    }
+
+    std::vector<Ray> MakeRays()
+    {
+        std::mt19937 rng {1};
+        std::vector<Ray> rays;
+        for (size_t i = 0; i < Rays; ++i)
+            rays.push_back({Vector3f {0.0f, 0.0f, 50.0f}, RandomVector(rng, 0.5f) - Vector3f {0.0f, 0.0f, 1.0f}});
+        return rays;
+    }
+
+    std::vector<Triangle> MakeTriangles()
+    {
+        std::mt19937 rng {2};
+        std::vector<Triangle> triangles;
+        for (size_t i = 0; i < Primitives; ++i)
+        {
+            Vector3f center = RandomVector(rng, 20.0f);
+            triangles.push_back({center + RandomVector(rng, 1.0f), center + RandomVector(rng, 1.0f), center + RandomVector(rng, 1.0f)});
+        }
+        return triangles;
+    }
+
+    std::vector<AABB> MakeBoxes()
+    {
+        std::mt19937 rng {3};
+        std::vector<AABB> boxes;
+        for (size_t i = 0; i < Primitives; ++i)
+        {
+            Vector3f center = RandomVector(rng, 20.0f);
+            boxes.push_back({center - Vector3f {1.0f, 1.0f, 1.0f}, center + Vector3f {1.0f, 1.0f, 1.0f}});
+        }
+        return boxes;
+    }
+
+    std::vector<Sphere> MakeSpheres()
+    {
+        std::mt19937 rng {4};
+        std::vector<Sphere> spheres;
+        for (size_t i = 0; i < Primitives; ++i)
+            spheres.push_back({RandomVector(rng, 20.0f), 1.0f});
+        return spheres;
+    }
+}
+
+LUX_BENCHMARK(RayTriangle_Scalar)
+{
+    auto rays = MakeRays();
+    auto triangles = MakeTriangles();
+    std::vector<float> distances(Primitives);
+
+    state.Run(Rays, [&]
+    {
+        for (const Ray& ray : rays)
+            for (size_t i = 0; i < Primitives; ++i)
+                distances[i] = Intersect(ray, triangles[i]).value_or(-1.0f);
+        bench::DoNotOptimize(distances.data());
+    });
+}
+
+LUX_BENCHMARK(RayTriangle_Batch)
+{
+    auto rays = MakeRays();
+    auto triangles = MakeTriangles();
+    std::vector<float> distances(Primitives);
+
+    state.Run(Rays, [&]
+    {
+        for (const Ray& ray : rays)
+            bench::DoNotOptimize(IntersectTriangles(ray, triangles, distances));
+    });
+}
+
+LUX_BENCHMARK(RayAABB_Scalar)
+{
+    auto rays = MakeRays();
+    auto boxes = MakeBoxes();
+    std::vector<float> distances(Primitives);
+
+    state.Run(Rays, [&]
+    {
+        for (const Ray& ray : rays)
+            for (size_t i = 0; i < Primitives; ++i)
+                distances[i] = Intersect(ray, boxes[i]).value_or(-1.0f);
+        bench::DoNotOptimize(distances.data());
+    });
+}
+
+LUX_BENCHMARK(RayAABB_Batch)
+{
+    auto rays = MakeRays();
+    auto boxes = MakeBoxes();
+    std::vector<float> distances(Primitives);
+
+    state.Run(Rays, [&]
+    {
+        for (const Ray& ray : rays)
+            bench::DoNotOptimize(IntersectAABBs(ray, boxes, distances));
+    });
+}
+
+// One plane or capsule query per "ray" slot, against every sphere
+LUX_BENCHMARK(SpherePlane_Batch)
+{
+    auto spheres = MakeSpheres();
+    std::vector<uint8_t> hits(Primitives);
+    Plane plane = Plane::FromPointNormal(Vector3f {0.0f, 0.0f, 0.0f}, Vector3f {0.3f, 1.0f, 0.1f});
+
+    state.Run(Rays, [&]
+    {
+        for (size_t i = 0; i < Rays; ++i)
+            bench::DoNotOptimize(IntersectSpheres(plane, spheres, hits));
+    });
+}
+
+LUX_BENCHMARK(CapsuleSphere_Batch)
+{
+    auto spheres = MakeSpheres();
+    std::vector<uint8_t> hits(Primitives);
+    Capsule capsule {Vector3f {-10.0f, 0.0f, 0.0f}, Vector3f {10.0f, 2.0f, 0.0f}, 2.0f};
+
+    state.Run(Rays, [&]
+    {
+        for (size_t i = 0; i < Rays; ++i)
+            bench::DoNotOptimize(IntersectSpheres(capsule, spheres, hits));
+    });
+}
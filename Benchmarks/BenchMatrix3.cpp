@@ -0,0 +1,79 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/Matrix.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t Count = 1024;
+
+    std::vector<Matrix3f> RandomMatrices(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {-1.0f, 1.0f};
+
+        std::vector<Matrix3f> matrices;
+        matrices.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            matrices.emplace_back(dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), dist(rng), dist(rng),
+                                  dist(rng));
+        return matrices;
+    }
+}
+
+LUX_BENCHMARK(Matrix3f_Multiply)
+{
+    auto a = RandomMatrices(Count, 1);
+    auto b = RandomMatrices(Count, 2);
+    std::vector<Matrix3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            static_cast<void>(out[i] = a[i] * b[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix3f_MultiplyVector)
+{
+    auto m = RandomMatrices(Count, 1);
+    std::vector<Vector3f> v(Count, Vector3f(0.3f, -1.2f, 2.0f));
+    std::vector<Vector3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = m[i] * v[i];
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix3f_Transpose)
+{
+    auto m = RandomMatrices(Count, 3);
+    std::vector<Matrix3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            static_cast<void>(out[i] = m[i].Transpose());
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix3f_Determinant)
+{
+    auto m = RandomMatrices(Count, 4);
+
+    state.Run(Count, [&]
+    {
+        float sum = 0.0f;
+        for (size_t i = 0; i < Count; ++i)
+            sum += m[i].Determinant();
+        bench::DoNotOptimize(sum);
+    });
+}
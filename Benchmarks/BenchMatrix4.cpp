@@ -0,0 +1,221 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/Matrix.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t Count = 1024;
+
+    std::vector<Matrix4f> RandomMatrices(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {-1.0f, 1.0f};
+
+        std::vector<Matrix4f> matrices;
+        matrices.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            matrices.push_back(Matrix4f::Translate(Vector3f(dist(rng), dist(rng), dist(rng))) *
+                               Matrix4f::Rotate(dist(rng) * 3.0f, Vector3f(dist(rng), dist(rng), 1.0f)) *
+                               Matrix4f::Scale(1.5f + dist(rng)));
+        return matrices;
+    }
+
+    // The scalar paths Matrix4f used before the kernels, kept as the baseline
+
+    Matrix4f LegacyMultiply(const Matrix4f& a, const Matrix4f& b)
+    {
+        return Matrix4f(a[0].Dot(b.GetCol(0)), a[0].Dot(b.GetCol(1)), a[0].Dot(b.GetCol(2)), a[0].Dot(b.GetCol(3)),
+                        a[1].Dot(b.GetCol(0)), a[1].Dot(b.GetCol(1)), a[1].Dot(b.GetCol(2)), a[1].Dot(b.GetCol(3)),
+                        a[2].Dot(b.GetCol(0)), a[2].Dot(b.GetCol(1)), a[2].Dot(b.GetCol(2)), a[2].Dot(b.GetCol(3)),
+                        a[3].Dot(b.GetCol(0)), a[3].Dot(b.GetCol(1)), a[3].Dot(b.GetCol(2)), a[3].Dot(b.GetCol(3)));
+    }
+
+    Vector4f LegacyMultiply(const Matrix4f& m, const Vector4f& v)
+    {
+        return Vector4f {m[0].Dot(v), m[1].Dot(v), m[2].Dot(v), m[3].Dot(v)};
+    }
+
+    Matrix4f LegacyTranspose(const Matrix4f& m)
+    {
+        return Matrix4f(m[0][0], m[0][1], m[0][2], m[0][3],
+                        m[1][0], m[1][1], m[1][2], m[1][3],
+                        m[2][0], m[2][1], m[2][2], m[2][3],
+                        m[3][0], m[3][1], m[3][2], m[3][3]);
+    }
+
+    float LegacyCofactor(const Matrix4f& m, int row, int col)
+    {
+        float minor[3][3];
+        int r = 0;
+        for (int i = 0; i < 4; ++i)
+        {
+            if (i == row) continue;
+            int c = 0;
+            for (int j = 0; j < 4; ++j)
+            {
+                if (j == col) continue;
+                minor[r][c++] = m.At(i, j);
+            }
+            r++;
+        }
+
+        float detMinor = minor[0][0] * (minor[1][1] * minor[2][2] - minor[1][2] * minor[2][1]) -
+                         minor[0][1] * (minor[1][0] * minor[2][2] - minor[1][2] * minor[2][0]) +
+                         minor[0][2] * (minor[1][0] * minor[2][1] - minor[1][1] * minor[2][0]);
+
+        return ((row + col) % 2 == 0 ? 1.0f : -1.0f) * detMinor;
+    }
+
+    Matrix4f LegacyInverse(const Matrix4f& m)
+    {
+        float invDet = 1 / m.Determinant();
+        Matrix4f result;
+        for (int i = 0; i < 4; ++i)
+            for (int j = 0; j < 4; ++j)
+                result[i][j] = LegacyCofactor(m, j, i) * invDet;
+
+        return result;
+    }
+}
+
+LUX_BENCHMARK(Matrix4f_Multiply_Legacy)
+{
+    auto a = RandomMatrices(Count, 1);
+    auto b = RandomMatrices(Count, 2);
+    std::vector<Matrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = LegacyMultiply(a[i], b[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix4f_Multiply)
+{
+    auto a = RandomMatrices(Count, 1);
+    auto b = RandomMatrices(Count, 2);
+    std::vector<Matrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = a[i] * b[i];
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix4f_MultiplyVector_Legacy)
+{
+    auto m = RandomMatrices(Count, 3);
+    std::vector<Vector4f> out(Count);
+    Vector4f v {1.0f, 2.0f, 3.0f, 1.0f};
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = LegacyMultiply(m[i], v);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix4f_MultiplyVector)
+{
+    auto m = RandomMatrices(Count, 3);
+    std::vector<Vector4f> out(Count);
+    Vector4f v {1.0f, 2.0f, 3.0f, 1.0f};
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = m[i] * v;
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix4f_Transpose_Legacy)
+{
+    auto m = RandomMatrices(Count, 4);
+    std::vector<Matrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = LegacyTranspose(m[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix4f_Transpose)
+{
+    auto m = RandomMatrices(Count, 4);
+    std::vector<Matrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = m[i].Transpose();
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix4f_Inverse_Legacy)
+{
+    auto m = RandomMatrices(Count, 5);
+    std::vector<Matrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = LegacyInverse(m[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix4f_Inverse)
+{
+    auto m = RandomMatrices(Count, 5);
+    for (auto& matrix : m)
+        matrix.SetShape(MatShape::GENERAL);
+    std::vector<Matrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = m[i].Inverse();
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix4f_InverseAffine)
+{
+    auto m = RandomMatrices(Count, 5);
+    std::vector<Matrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = m[i].InverseAffine();
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Matrix4f_InverseRigid)
+{
+    auto m = RandomMatrices(Count, 5);
+    for (auto& matrix : m)
+        matrix = Matrix4f::LookAt(Vector3f(matrix.At(0, 3), matrix.At(1, 3), 5.0f), Vector3f(0.0f, 0.0f, 0.0f), Y_AXIS);
+    std::vector<Matrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = m[i].InverseRigid();
+        bench::DoNotOptimize(out.data());
+    });
+}
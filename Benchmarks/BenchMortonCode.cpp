@@ -0,0 +1,106 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Utils/MortonCode.hpp"
+
+using namespace lux;
+
+/*  Elements/s reads as Morton keys per second. The _MagicBits variant always runs the
+ *  shift and mask fallback, so a BMI2 build reports both paths.
+ *----------------------------------------------------------------------------------------*/
+namespace
+{
+    constexpr size_t Keys = 1 << 16;
+    constexpr size_t Positions = 1'000'000;
+
+    std::vector<uint32_t> MakeCoordinates()
+    {
+        std::mt19937 rng {12};
+        std::uniform_int_distribution<uint32_t> dist {0, (1u << 21) - 1};
+        std::vector<uint32_t> coordinates(Keys * 3);
+        for (auto& c : coordinates)
+            c = dist(rng);
+        return coordinates;
+    }
+
+    std::vector<math::Vector3f> MakePositions()
+    {
+        std::mt19937 rng {13};
+        std::uniform_real_distribution<float> dist {-1000.0f, 1000.0f};
+        std::vector<math::Vector3f> positions(Positions);
+        for (auto& p : positions)
+            p = math::Vector3f {dist(rng), dist(rng), dist(rng)};
+        return positions;
+    }
+}
+
+LUX_BENCHMARK(MortonEncode3D64)
+{
+    auto c = MakeCoordinates();
+    std::vector<uint64_t> keys(Keys);
+
+    state.Run(Keys, [&]
+    {
+        for (size_t i = 0; i < Keys; ++i)
+            keys[i] = MortonEncode3D<uint64_t>(c[i * 3], c[i * 3 + 1], c[i * 3 + 2]);
+        bench::DoNotOptimize(keys.data());
+    });
+}
+
+LUX_BENCHMARK(MortonEncode3D64_MagicBits)
+{
+    auto c = MakeCoordinates();
+    std::vector<uint64_t> keys(Keys);
+
+    state.Run(Keys, [&]
+    {
+        for (size_t i = 0; i < Keys; ++i)
+            keys[i] = detail::Part1By2(uint64_t {c[i * 3]}) | (detail::Part1By2(uint64_t {c[i * 3 + 1]}) << 1) |
+                      (detail::Part1By2(uint64_t {c[i * 3 + 2]}) << 2);
+        bench::DoNotOptimize(keys.data());
+    });
+}
+
+LUX_BENCHMARK(MortonDecode3D64)
+{
+    auto c = MakeCoordinates();
+    std::vector<uint64_t> keys(Keys);
+    for (size_t i = 0; i < Keys; ++i)
+        keys[i] = MortonEncode3D<uint64_t>(c[i * 3], c[i * 3 + 1], c[i * 3 + 2]);
+
+    state.Run(Keys, [&]
+    {
+        for (size_t i = 0; i < Keys; ++i)
+        {
+            const auto [x, y, z] = MortonDecode3D(keys[i]);
+            c[i * 3] = x; c[i * 3 + 1] = y; c[i * 3 + 2] = z;
+        }
+        bench::DoNotOptimize(c.data());
+    });
+}
+
+LUX_BENCHMARK(MortonKeys_1M)
+{
+    auto positions = MakePositions();
+    const math::AABB bounds = math::AABB::FromPoints(positions);
+    std::vector<uint64_t> keys(Positions);
+
+    state.Run(Positions, [&]
+    {
+        ComputeMortonKeys(positions, bounds, keys);
+        bench::DoNotOptimize(keys.data());
+    });
+}
+
+LUX_BENCHMARK(MortonOrder_1M)
+{
+    auto positions = MakePositions();
+    const math::AABB bounds = math::AABB::FromPoints(positions);
+    std::vector<uint32_t> order(Positions);
+
+    state.Run(Positions, [&]
+    {
+        MortonOrder(positions, bounds, order);
+        bench::DoNotOptimize(order.data());
+    });
+}
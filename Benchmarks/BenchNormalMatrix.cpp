@@ -0,0 +1,57 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/NormalMatrix.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+
+    std::vector<PackedMatrix4f> RandomModels(size_t count)
+    {
+        std::mt19937 rng {5};
+        std::uniform_real_distribution<float> dist {-1.0f, 1.0f};
+
+        std::vector<PackedMatrix4f> models;
+        models.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            models.push_back(PackedMatrix4f::From(Matrix4f::Translate(Vector3f(dist(rng), dist(rng), dist(rng))) *
+                                                  Matrix4f::Rotate(dist(rng) * 3.0f, Vector3f(dist(rng), 1.0f, dist(rng))) *
+                                                  Matrix4f::Scale(Vector3f(1.5f, 0.5f, 2.0f))));
+        return models;
+    }
+}
+
+// Baseline: a general inverse and a transpose per matrix, what the vertex shader did per vertex
+LUX_BENCHMARK(NormalMatrix_Inverse)
+{
+    auto models = RandomModels(Count);
+    std::vector<PackedNormalMatrix> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+        {
+            const Matrix4f inverse = models[i].ToMatrix4().Inverse();
+            for (size_t c = 0; c < 3; ++c)
+                for (size_t r = 0; r < 3; ++r)
+                    out[i].data[c * 4 + r] = inverse.At(c, r);
+        }
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(NormalMatrix_Batch)
+{
+    auto models = RandomModels(Count);
+    std::vector<PackedNormalMatrix> out(Count);
+
+    state.Run(Count, [&]
+    {
+        ComputeNormalMatrices(models, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
@@ -0,0 +1,67 @@
+#include <cstdint>
+#include <filesystem>
+#include "Benchmark.hpp"
+#include "../include/Memory/ArenaAllocator.hpp"
+#include "../include/Memory/MemoryTracker.hpp"
+#include "../include/Renderer/Mesh/MeshParsers/ObjParser.hpp"
+
+#ifndef LUX_ASSET_DIR
+#define LUX_ASSET_DIR "assets"
+#endif
+
+using namespace lux;
+
+namespace
+{
+    const std::filesystem::path CastlePath = std::filesystem::path{LUX_ASSET_DIR} / "castle.obj";
+
+    template<typename Fn>
+    size_t CountAllocations(Fn&& fn)
+    {
+        // The benchmark executable links the operator new hook, see Benchmarks/CMakeLists.txt
+        const uint64_t before = MemoryTracker::GetSnapshot().heapAllocations;
+        fn();
+        return MemoryTracker::GetSnapshot().heapAllocations - before;
+    }
+}
+
+// Baseline: every token, table and history node from the global heap
+LUX_BENCHMARK(ObjParse_Castle_Heap)
+{
+    if (!std::filesystem::exists(CastlePath))
+        return state.Skip(CastlePath.string() + " not found");
+
+    auto parse = [&]
+    {
+        OBJParser parser;
+        MeshData mesh = parser.ParseMesh(CastlePath);
+        bench::DoNotOptimize(mesh.vertices.data());
+    };
+
+    state.SetCounter("allocs/parse", static_cast<double>(CountAllocations(parse)));
+    state.Run(1, parse);
+}
+
+// Scratch data from an arena kept across parses, only the output geometry reaches the heap
+LUX_BENCHMARK(ObjParse_Castle_Arena)
+{
+    if (!std::filesystem::exists(CastlePath))
+        return state.Skip(CastlePath.string() + " not found");
+
+    Arena arena {1024 * 1024};
+    ArenaResource scratch {arena};
+
+    auto parse = [&]
+    {
+        {
+            OBJParser parser {&scratch};
+            MeshData mesh = parser.ParseMesh(CastlePath);
+            bench::DoNotOptimize(mesh.vertices.data());
+        }
+        arena.Reset();
+    };
+
+    parse();  // First parse grows the arena to its working size
+    state.SetCounter("allocs/parse", static_cast<double>(CountAllocations(parse)));
+    state.Run(1, parse);
+}
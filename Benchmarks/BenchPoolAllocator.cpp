@@ -0,0 +1,54 @@
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Memory/PoolAllocator.hpp"
+
+using namespace lux;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+
+    struct Listener
+    {
+        uint32_t id;
+        float weight;
+        void* owner;
+        Listener* next;
+    };
+}
+
+// Baseline: general heap, objects freed in a different order than allocated
+LUX_BENCHMARK(Pool_NewDelete)
+{
+    std::vector<Listener*> objects(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            objects[i] = new Listener{static_cast<uint32_t>(i), 1.0f, nullptr, nullptr};
+        bench::DoNotOptimize(objects.data());
+
+        for (size_t i = 0; i < Count; i += 2)
+            delete objects[i];
+        for (size_t i = 1; i < Count; i += 2)
+            delete objects[i];
+    });
+}
+
+LUX_BENCHMARK(Pool_NewDeletePooled)
+{
+    PoolAllocator pool {64 * 1024, sizeof(Listener)};
+    std::vector<Listener*> objects(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            objects[i] = pool.New<Listener>(Listener{static_cast<uint32_t>(i), 1.0f, nullptr, nullptr});
+        bench::DoNotOptimize(objects.data());
+
+        for (size_t i = 0; i < Count; i += 2)
+            pool.Delete(objects[i]);
+        for (size_t i = 1; i < Count; i += 2)
+            pool.Delete(objects[i]);
+    });
+}
@@ -0,0 +1,212 @@
+#include <cmath>
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/Quatf.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+
+    std::vector<Quatf> RandomRotations(unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {-1.0f, 1.0f};
+
+        std::vector<Quatf> rotations;
+        rotations.reserve(Count);
+        for (size_t i = 0; i < Count; ++i)
+            rotations.push_back(Quatf {dist(rng), dist(rng), dist(rng), dist(rng)}.Normalize());
+        return rotations;
+    }
+
+    std::vector<Qf> ToTemplate(const std::vector<Quatf>& rotations)
+    {
+        std::vector<Qf> out;
+        out.reserve(rotations.size());
+        for (const Quatf& q : rotations)
+            out.push_back(q.ToQuaternion());
+        return out;
+    }
+
+    // What interpolation looks like with Quaternion<float> today: acos, sines and the generic operators
+    Qf TemplateSlerp(const Qf& a, Qf b, float t)
+    {
+        float dot = Dot(a, b);
+        if (dot < 0.0f)
+        {
+            b = -b;
+            dot = -dot;
+        }
+
+        float angle = std::acos(std::min(dot, 1.0f));
+        float s = std::sin(angle);
+        if (s < 1e-6f)
+            return Normalize(a * (1.0f - t) + b * t);
+
+        return a * (std::sin((1.0f - t) * angle) / s) + b * (std::sin(t * angle) / s);
+    }
+}
+
+LUX_BENCHMARK(Quaternion_Template_Multiply)
+{
+    auto a = ToTemplate(RandomRotations(1));
+    auto b = ToTemplate(RandomRotations(2));
+    std::vector<Qf> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = a[i] * b[i];
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quatf_Multiply)
+{
+    auto a = RandomRotations(1);
+    auto b = RandomRotations(2);
+    std::vector<Quatf> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = a[i] * b[i];
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quatf_Multiply_Batch)
+{
+    auto a = RandomRotations(1);
+    auto b = RandomRotations(2);
+    std::vector<Quatf> out(Count);
+
+    state.Run(Count, [&]
+    {
+        Multiply(a, b, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+// q * (0, v) * conj(q)
+LUX_BENCHMARK(Quaternion_Template_Rotate)
+{
+    auto q = ToTemplate(RandomRotations(1));
+    std::vector<Qf> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = q[i] * Qf(0.0f, 1.0f, 2.0f, 3.0f) * Conj(q[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quatf_Rotate_Batch)
+{
+    auto q = RandomRotations(1);
+    std::vector<Vector3f> in(Count, Vector3f {1.0f, 2.0f, 3.0f});
+    std::vector<Vector3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        Rotate(q, in, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quaternion_Template_Slerp)
+{
+    auto a = ToTemplate(RandomRotations(1));
+    auto b = ToTemplate(RandomRotations(2));
+    std::vector<Qf> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = TemplateSlerp(a[i], b[i], 0.3f);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quatf_Slerp)
+{
+    auto a = RandomRotations(1);
+    auto b = RandomRotations(2);
+    std::vector<Quatf> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = Slerp(a[i], b[i], 0.3f);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quatf_Slerp_Batch)
+{
+    auto a = RandomRotations(1);
+    auto b = RandomRotations(2);
+    std::vector<Quatf> out(Count);
+
+    state.Run(Count, [&]
+    {
+        Slerp(a, b, 0.3f, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quatf_Nlerp_Batch)
+{
+    auto a = RandomRotations(1);
+    auto b = RandomRotations(2);
+    std::vector<Quatf> out(Count);
+
+    state.Run(Count, [&]
+    {
+        Nlerp(a, b, 0.3f, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quaternion_Template_ToRotationMatrix)
+{
+    auto q = ToTemplate(RandomRotations(1));
+    std::vector<RotationMatrix<float>> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = ToRotationMatrix(q[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quatf_ToMatrix4)
+{
+    auto q = RandomRotations(1);
+    std::vector<Matrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = q[i].ToMatrix4();
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Quatf_ToMatrices_Batch)
+{
+    auto q = RandomRotations(1);
+    std::vector<PackedMatrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        ToMatrices(q, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
@@ -0,0 +1,97 @@
+#include <barrier>
+#include <thread>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Memory/SlabAllocator.hpp"
+
+using namespace lux;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+    constexpr size_t Threads = 4;
+
+    // Sizes of small job-side objects: command packets, cull batches, parse tokens
+    size_t SizeOf(size_t i) noexcept { return 16 + (i * 40) % 496; }
+
+    struct HeapAllocator
+    {
+        static void* Allocate(size_t size) { return operator new(size); }
+        static void Free(void* ptr) noexcept { operator delete(ptr); }
+    };
+
+    struct SlabHeap
+    {
+        SlabAllocator& allocator;
+
+        void* Allocate(size_t size) const { return allocator.Allocate(size); }
+        void Free(void* ptr) const noexcept { allocator.Free(ptr); }
+    };
+
+    template<typename Allocator>
+    void MixedSizes(bench::State& state, Allocator allocator)
+    {
+        std::vector<void*> blocks(Count);
+
+        state.Run(Count, [&]
+        {
+            for (size_t i = 0; i < Count; ++i)
+                blocks[i] = allocator.Allocate(SizeOf(i));
+            bench::DoNotOptimize(blocks.data());
+
+            for (size_t i = 0; i < Count; i += 2)
+                allocator.Free(blocks[i]);
+            for (size_t i = 1; i < Count; i += 2)
+                allocator.Free(blocks[i]);
+        });
+    }
+
+    // Every worker allocates a batch, then frees the batch of the worker next to it
+    template<typename Allocator>
+    void CrossThread(bench::State& state, Allocator allocator)
+    {
+        std::vector<std::vector<void*>> blocks(Threads, std::vector<void*>(Count));
+
+        state.Run(Count * Threads, [&]
+        {
+            std::barrier sync {static_cast<std::ptrdiff_t>(Threads)};
+            std::vector<std::thread> workers;
+            for (size_t t = 0; t < Threads; ++t)
+                workers.emplace_back([&, t]
+                {
+                    for (size_t i = 0; i < Count; ++i)
+                        blocks[t][i] = allocator.Allocate(SizeOf(i));
+
+                    sync.arrive_and_wait();
+
+                    for (void* block : blocks[(t + 1) % Threads])
+                        allocator.Free(block);
+                });
+
+            for (std::thread& worker : workers)
+                worker.join();
+        });
+    }
+}
+
+LUX_BENCHMARK(Slab_MixedSizes_NewDelete)
+{
+    MixedSizes(state, HeapAllocator{});
+}
+
+LUX_BENCHMARK(Slab_MixedSizes_Slab)
+{
+    SlabAllocator allocator;
+    MixedSizes(state, SlabHeap{allocator});
+}
+
+LUX_BENCHMARK(Slab_CrossThread_NewDelete)
+{
+    CrossThread(state, HeapAllocator{});
+}
+
+LUX_BENCHMARK(Slab_CrossThread_Slab)
+{
+    SlabAllocator allocator;
+    CrossThread(state, SlabHeap{allocator});
+}
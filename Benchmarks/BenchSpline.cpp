@@ -0,0 +1,102 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/Geometry/Spline.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t ControlPoints = 64;
+    constexpr size_t Samples = 4096;
+
+    Spline MakePath()
+    {
+        std::mt19937 rng {6};
+        std::uniform_real_distribution<float> jitter {-5.0f, 5.0f};
+        std::vector<Vector3f> points;
+        for (size_t i = 0; i < ControlPoints; ++i)
+            points.push_back(Vector3f {static_cast<float>(i) * 10.0f, jitter(rng), jitter(rng)});
+        return Spline {SplineType::CATMULL_ROM, points};
+    }
+
+    std::vector<float> MakeParameters(float scale)
+    {
+        std::mt19937 rng {7};
+        std::uniform_real_distribution<float> dist {0.0f, scale};
+        std::vector<float> values(Samples);
+        for (auto& value : values)
+            value = dist(rng);
+        return values;
+    }
+
+    struct Output
+    {
+        std::vector<float> x = std::vector<float>(Samples);
+        std::vector<float> y = std::vector<float>(Samples);
+        std::vector<float> z = std::vector<float>(Samples);
+
+        Vector3Stream Stream() { return {x, y, z}; }
+    };
+}
+
+LUX_BENCHMARK(SplineEvaluate_Scalar)
+{
+    Spline spline = MakePath();
+    auto t = MakeParameters(1.0f);
+    Output out;
+
+    state.Run(Samples, [&]
+    {
+        for (size_t i = 0; i < Samples; ++i)
+        {
+            const Vector3f p = spline.Evaluate(t[i]);
+            out.x[i] = p.GetX(); out.y[i] = p.GetY(); out.z[i] = p.GetZ();
+        }
+        bench::DoNotOptimize(out.x.data());
+    });
+}
+
+LUX_BENCHMARK(SplineEvaluate_Batch)
+{
+    Spline spline = MakePath();
+    auto t = MakeParameters(1.0f);
+    Output out;
+
+    state.Run(Samples, [&]
+    {
+        spline.Evaluate(t, out.Stream());
+        bench::DoNotOptimize(out.x.data());
+    });
+}
+
+LUX_BENCHMARK(SplineEvaluateAtDistance_Scalar)
+{
+    Spline spline = MakePath();
+    auto distances = MakeParameters(spline.Length());
+    Output out;
+
+    state.Run(Samples, [&]
+    {
+        for (size_t i = 0; i < Samples; ++i)
+        {
+            const Vector3f p = spline.EvaluateAtDistance(distances[i]);
+            out.x[i] = p.GetX(); out.y[i] = p.GetY(); out.z[i] = p.GetZ();
+        }
+        bench::DoNotOptimize(out.x.data());
+    });
+}
+
+LUX_BENCHMARK(SplineEvaluateAtDistance_Batch)
+{
+    Spline spline = MakePath();
+    auto distances = MakeParameters(spline.Length());
+    Output out;
+
+    state.Run(Samples, [&]
+    {
+        spline.EvaluateAtDistance(distances, out.Stream());
+        bench::DoNotOptimize(out.x.data());
+    });
+}
@@ -0,0 +1,90 @@
+#include <cmath>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/Transform.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+
+    std::vector<Transform> MakeTransforms()
+    {
+        std::vector<Transform> transforms;
+        transforms.reserve(Count);
+        for (size_t i = 0; i < Count; ++i)
+        {
+            float half = 0.001f * static_cast<float>(i);
+            transforms.emplace_back(Vector3f{static_cast<float>(i), 1.0f, -2.0f},
+                                    Qf(std::cos(half), 0.0f, std::sin(half), 0.0f),
+                                    Vector3f{1.0f, 2.0f, 0.5f});
+        }
+        return transforms;
+    }
+
+    // The previous representation: three full matrices multiplied per instance
+    struct MatrixTransform
+    {
+        Matrix4f translation;
+        Matrix4f scale;
+        Matrix4f rotation;
+    };
+}
+
+LUX_BENCHMARK(Transform_ThreeMatrixProduct)
+{
+    std::vector<MatrixTransform> transforms;
+    for (size_t i = 0; i < Count; ++i)
+        transforms.push_back({Matrix4f::Translate(Vector3f{static_cast<float>(i), 1.0f, -2.0f}),
+                              Matrix4f::Scale(Vector3f{1.0f, 2.0f, 0.5f}),
+                              Matrix4f::Rotate(0.002f * static_cast<float>(i), Vector3f{0.0f, 1.0f, 0.0f})});
+    std::vector<PackedMatrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = PackedMatrix4f::From(transforms[i].translation * transforms[i].rotation * transforms[i].scale);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Transform_ToMatrix4)
+{
+    auto transforms = MakeTransforms();
+    std::vector<PackedMatrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = PackedMatrix4f::From(transforms[i].ToMatrix4());
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+// Static scene: every matrix comes from the cache
+LUX_BENCHMARK(Transform_CachedMatrix)
+{
+    auto transforms = MakeTransforms();
+    std::vector<PackedMatrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = PackedMatrix4f::From(transforms[i].GetMatrix());
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Transform_ComposeMatrices)
+{
+    auto transforms = MakeTransforms();
+    std::vector<PackedMatrix4f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        ComposeMatrices(transforms, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
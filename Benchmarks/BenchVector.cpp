@@ -0,0 +1,98 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/Vector.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t Count = 4096;
+
+    template<typename V, size_t N>
+    std::vector<V> RandomVectors(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {-10.0f, 10.0f};
+
+        std::vector<V> vectors(count);
+        for (auto& v : vectors)
+            for (size_t i = 0; i < N; ++i)
+                v[i] = dist(rng);
+        return vectors;
+    }
+
+    template<typename V, size_t N>
+    void BenchAdd(bench::State& state)
+    {
+        auto a = RandomVectors<V, N>(Count, 1);
+        auto b = RandomVectors<V, N>(Count, 2);
+        std::vector<V> out(Count);
+
+        state.Run(Count, [&]
+        {
+            for (size_t i = 0; i < Count; ++i)
+                out[i] = a[i] + b[i];
+            bench::DoNotOptimize(out.data());
+        });
+    }
+
+    template<typename V, size_t N>
+    void BenchDot(bench::State& state)
+    {
+        auto a = RandomVectors<V, N>(Count, 1);
+        auto b = RandomVectors<V, N>(Count, 2);
+
+        state.Run(Count, [&]
+        {
+            float sum = 0.0f;
+            for (size_t i = 0; i < Count; ++i)
+                sum += a[i].Dot(b[i]);
+            bench::DoNotOptimize(sum);
+        });
+    }
+
+    template<typename V, size_t N>
+    void BenchNormalize(bench::State& state)
+    {
+        auto in = RandomVectors<V, N>(Count, 3);
+        std::vector<V> out(Count);
+
+        state.Run(Count, [&]
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                out[i] = in[i];
+                V::Normalize(out[i]);
+            }
+            bench::DoNotOptimize(out.data());
+        });
+    }
+}
+
+LUX_BENCHMARK(Vector2f_Add) { BenchAdd<Vector2f, 2>(state); }
+LUX_BENCHMARK(Vector2f_Dot) { BenchDot<Vector2f, 2>(state); }
+LUX_BENCHMARK(Vector2f_Normalize) { BenchNormalize<Vector2f, 2>(state); }
+
+LUX_BENCHMARK(Vector3f_Add) { BenchAdd<Vector3f, 3>(state); }
+LUX_BENCHMARK(Vector3f_Dot) { BenchDot<Vector3f, 3>(state); }
+LUX_BENCHMARK(Vector3f_Normalize) { BenchNormalize<Vector3f, 3>(state); }
+
+LUX_BENCHMARK(Vector3f_Cross)
+{
+    auto a = RandomVectors<Vector3f, 3>(Count, 1);
+    auto b = RandomVectors<Vector3f, 3>(Count, 2);
+    std::vector<Vector3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = Cross(a[i], b[i]);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Vector4f_Add) { BenchAdd<Vector4f, 4>(state); }
+LUX_BENCHMARK(Vector4f_Dot) { BenchDot<Vector4f, 4>(state); }
+LUX_BENCHMARK(Vector4f_Normalize) { BenchNormalize<Vector4f, 4>(state); }
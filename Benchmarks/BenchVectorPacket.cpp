@@ -0,0 +1,67 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/VectorPacket.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+// Same data and counts as the Vector3f_* benchmarks so the two can be compared directly
+namespace
+{
+    constexpr size_t Count = 4096;
+    static_assert(Count % Vector3Packet::Lanes == 0);
+
+    std::vector<Vector3f> RandomVectors(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {-10.0f, 10.0f};
+
+        std::vector<Vector3f> vectors;
+        vectors.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+            vectors.emplace_back(dist(rng), dist(rng), dist(rng));
+        return vectors;
+    }
+}
+
+LUX_BENCHMARK(Vector3Packet_Dot)
+{
+    auto a = RandomVectors(Count, 1);
+    auto b = RandomVectors(Count, 2);
+
+    state.Run(Count, [&]
+    {
+        simd::FloatN sum = simd::SplatN(0.0f);
+        for (size_t i = 0; i < Count; i += Vector3Packet::Lanes)
+            sum = simd::AddN(sum, Dot(Vector3Packet::Load(a, i), Vector3Packet::Load(b, i)));
+        bench::DoNotOptimize(sum);
+    });
+}
+
+LUX_BENCHMARK(Vector3Packet_Cross)
+{
+    auto a = RandomVectors(Count, 1);
+    auto b = RandomVectors(Count, 2);
+    std::vector<Vector3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; i += Vector3Packet::Lanes)
+            Cross(Vector3Packet::Load(a, i), Vector3Packet::Load(b, i)).Store(out, i);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(Vector3Packet_Normalize)
+{
+    auto in = RandomVectors(Count, 3);
+    std::vector<Vector3f> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; i += Vector3Packet::Lanes)
+            Normalize(Vector3Packet::Load(in, i)).Store(out, i);
+        bench::DoNotOptimize(out.data());
+    });
+}
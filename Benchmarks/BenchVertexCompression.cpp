@@ -0,0 +1,83 @@
+#include <random>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Math/VertexCompression.hpp"
+
+using namespace lux;
+using namespace lux::math;
+
+namespace
+{
+    constexpr size_t Count = 65536;
+
+    std::vector<StandardVertex> RandomVertices(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {-1.0f, 1.0f};
+
+        std::vector<StandardVertex> vertices;
+        vertices.reserve(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vector3f n {dist(rng), dist(rng), dist(rng) + 0.01f};
+            n.Normalize();
+            vertices.push_back({Vector3f{dist(rng), dist(rng), dist(rng)} * 10.0f, Vector2f{dist(rng), dist(rng)}, n});
+        }
+        return vertices;
+    }
+}
+
+// Baseline: the scalar helpers one vertex at a time
+LUX_BENCHMARK(CompressVertices_PerElement)
+{
+    auto in = RandomVertices(Count, 1);
+    const auto q = VertexQuantization::FromVertices(in);
+    std::vector<CompressedVertex> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+        {
+            CompressedVertex& v = out[i];
+            for (size_t k = 0; k < 3; ++k)
+                v.position[k] = PackUnorm16((in[i].position[k] - q.positionOffset[k]) / q.positionScale[k]);
+            for (size_t k = 0; k < 2; ++k)
+                v.uv[k] = PackUnorm16((in[i].uv[k] - q.uvOffset[k]) / q.uvScale[k]);
+
+            const auto normal = OctahedralEncode(in[i].normal);
+            v.normal[0] = normal[0];
+            v.normal[1] = normal[1];
+            v.padding = 0;
+        }
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(CompressVertices_Batch)
+{
+    auto in = RandomVertices(Count, 1);
+    const auto q = VertexQuantization::FromVertices(in);
+    std::vector<CompressedVertex> out(Count);
+
+    state.Run(Count, [&]
+    {
+        CompressVertices(in, q, out);
+        bench::DoNotOptimize(out.data());
+    });
+}
+
+LUX_BENCHMARK(DecompressVertex_PerElement)
+{
+    auto in = RandomVertices(Count, 2);
+    const auto q = VertexQuantization::FromVertices(in);
+    std::vector<CompressedVertex> compressed(Count);
+    CompressVertices(in, q, compressed);
+    std::vector<StandardVertex> out(Count);
+
+    state.Run(Count, [&]
+    {
+        for (size_t i = 0; i < Count; ++i)
+            out[i] = DecompressVertex(compressed[i], q);
+        bench::DoNotOptimize(out.data());
+    });
+}
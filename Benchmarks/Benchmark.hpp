@@ -0,0 +1,221 @@
+/*
+ * Project: TestProject
+ * File: Benchmark.hpp
+ * Author: olegfresi
+ * Created: 16/10/26 11:05
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+/*  Micro benchmark harness
+ *
+ *  Benchmarks register themselves with LUX_BENCHMARK and call State::Run once with the
+ *  body to time and the number of elements the body processes. The harness calibrates
+ *  the iteration count, keeps the best of a few repetitions and reports ns per call and
+ *  elements per second. Nothing here touches the window or the graphics context.
+ *
+ *  Results can be saved as JSON and a later run compared against them, the file is flat:
+ *
+ *      {"backend": "AVX2", "benchmarks": [{"name": "...", "ns_per_op": 1.0, "items_per_second": 1.0,
+ *                                           "iterations": 1}, ...]}
+ *--------------------------------------------------------------------------------*/
+namespace lux::bench
+{
+    /**
+     * @brief Keeps the compiler from discarding a value computed inside a benchmark body
+     */
+    template<typename T>
+    inline void DoNotOptimize(const T& value) noexcept
+    {
+#if defined(__GNUC__) || defined(__clang__)
+        asm volatile("" : : "r,m"(value) : "memory");
+#else
+        static const void* volatile sink;
+        sink = &value;
+#endif
+    }
+
+    struct Result
+    {
+        std::string name;
+        size_t iterations = 0;
+        double nsPerOp = 0.0;
+        double itemsPerSecond = 0.0;
+        std::vector<std::pair<std::string, double>> counters;
+        std::string skipped;
+    };
+
+    class State
+    {
+    public:
+        explicit State(std::string name)
+        {
+            m_result.name = std::move(name);
+        }
+
+        /**
+         * @brief Times fn until the measurement window is filled
+         * @param itemsPerCall Number of elements fn processes per call, used for elements/sec
+         */
+        template<typename Fn>
+        void Run(size_t itemsPerCall, Fn&& fn)
+        {
+            using Clock = std::chrono::steady_clock;
+
+            auto measure = [&](size_t iterations)
+            {
+                auto start = Clock::now();
+                for (size_t i = 0; i < iterations; ++i)
+                    fn();
+
+                return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+            };
+
+            size_t iterations = 1;
+            double elapsed = measure(iterations);
+            while (elapsed < CalibrationNs && iterations < (size_t{1} << 40))
+            {
+                iterations *= 2;
+                elapsed = measure(iterations);
+            }
+
+            iterations = std::max<size_t>(1, static_cast<size_t>(iterations * (MeasureNs / std::max(elapsed, 1.0))));
+
+            double best = measure(iterations);
+            for (int rep = 1; rep < Repetitions; ++rep)
+                best = std::min(best, measure(iterations));
+
+            m_result.iterations = iterations;
+            m_result.nsPerOp = best / static_cast<double>(iterations);
+            m_result.itemsPerSecond = static_cast<double>(itemsPerCall) * 1e9 / m_result.nsPerOp;
+        }
+
+        /**
+         * @brief Reports an extra figure printed next to the timing, e.g. allocations per call
+         */
+        void SetCounter(std::string name, double value) { m_result.counters.emplace_back(std::move(name), value); }
+
+        /**
+         * @brief Marks the benchmark as not run, e.g. when an input file is missing, and Run is not called
+         */
+        void Skip(std::string reason) { m_result.skipped = std::move(reason); }
+
+        [[nodiscard]] const Result& GetResult() const noexcept { return m_result; }
+
+    private:
+        static constexpr double CalibrationNs = 10e6;
+        static constexpr double MeasureNs = 100e6;
+        static constexpr int Repetitions = 3;
+
+        Result m_result;
+    };
+
+    /**
+     * @brief Saves results in the layout described above, benchmark names are plain identifiers so nothing is escaped
+     */
+    inline bool WriteJson(const std::string& path, const char* backend, const std::vector<Result>& results)
+    {
+        std::ofstream file {path};
+        if (!file)
+            return false;
+
+        file.precision(10);
+        file << "{\n  \"backend\": \"" << backend << "\",\n  \"benchmarks\": [";
+        for (size_t i = 0; i < results.size(); ++i)
+        {
+            const Result& r = results[i];
+            file << (i ? ",\n" : "\n") << "    {\"name\": \"" << r.name << "\", \"ns_per_op\": " << r.nsPerOp
+                 << ", \"items_per_second\": " << r.itemsPerSecond << ", \"iterations\": " << r.iterations << "}";
+        }
+        file << "\n  ]\n}\n";
+
+        return static_cast<bool>(file);
+    }
+
+    /**
+     * @brief Reads name -> ns/op from a file written by WriteJson, empty if the file cannot be read
+     *
+     * Not a general JSON parser, it only picks the name and ns_per_op fields out of that layout.
+     */
+    inline std::unordered_map<std::string, double> ReadBaseline(const std::string& path)
+    {
+        std::unordered_map<std::string, double> baseline;
+        std::ifstream file {path};
+        if (!file)
+            return baseline;
+
+        std::stringstream buffer;
+        buffer << file.rdbuf();
+        const std::string text = buffer.str();
+
+        constexpr std::string_view nameKey = "\"name\": \"";
+        constexpr std::string_view timeKey = "\"ns_per_op\":";
+
+        for (size_t pos = text.find(nameKey); pos != std::string::npos; pos = text.find(nameKey, pos))
+        {
+            const size_t begin = pos + nameKey.size();
+            const size_t end = text.find('"', begin);
+            const size_t time = text.find(timeKey, end);
+            if (end == std::string::npos || time == std::string::npos)
+                break;
+
+            baseline[text.substr(begin, end - begin)] = std::strtod(text.c_str() + time + timeKey.size(), nullptr);
+            pos = time;
+        }
+
+        return baseline;
+    }
+
+    using BenchmarkFn = void(*)(State&);
+
+    inline std::vector<std::pair<const char*, BenchmarkFn>>& Registry()
+    {
+        static std::vector<std::pair<const char*, BenchmarkFn>> benchmarks;
+        return benchmarks;
+    }
+
+    inline bool Register(const char* name, BenchmarkFn fn)
+    {
+        Registry().emplace_back(name, fn);
+        return true;
+    }
+}
+
+#define LUX_BENCHMARK(name)                                                      \
+    static void name(lux::bench::State& state);                                  \
+    [[maybe_unused]] static const bool name##Registered = lux::bench::Register(#name, name); \
+    static void name(lux::bench::State& state)
@@ -0,0 +1,108 @@
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+#include "Benchmark.hpp"
+#include "../include/Application/Logger.hpp"
+#include "../include/Math/Simd/Simd.hpp"
+
+using namespace lux;
+
+/*  Usage
+ *
+ *      LuxBenchmarks [filter] [--json out.json] [--baseline base.json] [--threshold percent]
+ *
+ *  filter keeps the benchmarks whose name contains it. --baseline adds the change against a
+ *  previous --json run and the exit code is 1 when a benchmark got slower than the threshold
+ *  (10% by default), so the suite can gate CI.
+ *--------------------------------------------------------------------------------*/
+int main(int argc, char** argv)
+{
+    Log::Init();
+
+    const char* filter = nullptr;
+    std::string jsonPath;
+    std::string baselinePath;
+    double threshold = 10.0;
+
+    for (int i = 1; i < argc; ++i)
+    {
+        const bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--json") == 0 && hasValue)
+            jsonPath = argv[++i];
+        else if (std::strcmp(argv[i], "--baseline") == 0 && hasValue)
+            baselinePath = argv[++i];
+        else if (std::strcmp(argv[i], "--threshold") == 0 && hasValue)
+            threshold = std::strtod(argv[++i], nullptr);
+        else if (argv[i][0] != '-')
+            filter = argv[i];
+        else
+        {
+            std::fprintf(stderr, "usage: %s [filter] [--json out.json] [--baseline base.json] [--threshold percent]\n", argv[0]);
+            return 2;
+        }
+    }
+
+    const auto baseline = baselinePath.empty() ? std::unordered_map<std::string, double>{} : bench::ReadBaseline(baselinePath);
+    if (!baselinePath.empty() && baseline.empty())
+    {
+        std::fprintf(stderr, "cannot read baseline %s\n", baselinePath.c_str());
+        return 2;
+    }
+
+    std::printf("Lux math benchmarks, SIMD backend: %s\n\n", math::simd::BackendName());
+    std::printf("%-44s %14s %16s %12s%s\n", "Benchmark", "ns/op", "elements/s", "iterations", baseline.empty() ? "" : "    vs baseline");
+
+    std::vector<bench::Result> results;
+    int regressions = 0;
+
+    for (const auto& [name, fn] : bench::Registry())
+    {
+        if (filter && std::strstr(name, filter) == nullptr)
+            continue;
+
+        bench::State state {name};
+        fn(state);
+
+        const auto& result = state.GetResult();
+        if (!result.skipped.empty())
+        {
+            std::printf("%-44s skipped: %s\n", result.name.c_str(), result.skipped.c_str());
+            continue;
+        }
+
+        std::printf("%-44s %14.2f %16.4g %12zu", result.name.c_str(), result.nsPerOp, result.itemsPerSecond,
+                    result.iterations);
+
+        if (auto it = baseline.find(result.name); it != baseline.end() && it->second > 0.0)
+        {
+            const double change = (result.nsPerOp / it->second - 1.0) * 100.0;
+            const bool regressed = change > threshold;
+            regressions += regressed;
+            std::printf("    %+8.1f%%%s", change, regressed ? "  REGRESSION" : "");
+        }
+        else if (!baseline.empty())
+            std::printf("    %9s", "new");
+
+        for (const auto& [counter, value] : result.counters)
+            std::printf("    %s=%.6g", counter.c_str(), value);
+
+        std::printf("\n");
+        results.push_back(result);
+    }
+
+    if (!jsonPath.empty() && !bench::WriteJson(jsonPath, math::simd::BackendName(), results))
+    {
+        std::fprintf(stderr, "cannot write %s\n", jsonPath.c_str());
+        return 2;
+    }
+
+    if (regressions > 0)
+    {
+        std::printf("\n%d benchmark(s) slower than the baseline by more than %.1f%%\n", regressions, threshold);
+        return 1;
+    }
+
+    return 0;
+}
@@ -9,6 +9,11 @@ layout (location = 4) in vec4 i_col1;
 layout (location = 5) in vec4 i_col2;
 layout (location = 6) in vec4 i_col3;
 
+// Normal matrix of the instance, Mesh uploads it next to the model matrix
+layout (location = 7) in vec3 i_normal0;
+layout (location = 8) in vec3 i_normal1;
+layout (location = 9) in vec3 i_normal2;
+
 
 out vec2 TexCoords;
 
@@ -28,17 +33,20 @@ uniform bool useInstancing;
 void main()
 {
     mat4 m;
+    mat3 normalMatrix;
     if (useInstancing)
     {
         m = mat4(i_col0, i_col1, i_col2, i_col3);
+        normalMatrix = mat3(i_normal0, i_normal1, i_normal2);
     }
     else
     {
         m = model;
+        normalMatrix = mat3(transpose(inverse(m)));
     }
     vec4 worldPos = m * vec4(aPos, 1.0);
     vs_out.FragPos = vec3(worldPos);
-    vs_out.Normal = mat3(transpose(inverse(m))) * aNormal;
+    vs_out.Normal = normalMatrix * aNormal;
     vs_out.TexCoords = aTexCoords;
     vs_out.FragPosLightSpace = lightSpaceMatrix * worldPos;
     gl_Position = projection * view * worldPos;
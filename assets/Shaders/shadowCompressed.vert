@@ -0,0 +1,66 @@
+#version 410 core
+
+// Layout::Compressed(): unorm16 position and uv, snorm16 octahedral normal
+layout (location = 0) in vec3 aPos;
+layout (location = 1) in vec2 aTexCoords;
+layout (location = 2) in vec2 aNormal;
+
+layout (location = 3) in vec4 i_col0;
+layout (location = 4) in vec4 i_col1;
+layout (location = 5) in vec4 i_col2;
+layout (location = 6) in vec4 i_col3;
+
+// Normal matrix of the instance, Mesh uploads it next to the model matrix
+layout (location = 7) in vec3 i_normal0;
+layout (location = 8) in vec3 i_normal1;
+layout (location = 9) in vec3 i_normal2;
+
+
+out vec2 TexCoords;
+
+out VS_OUT {
+    vec3 FragPos;
+    vec3 Normal;
+    vec2 TexCoords;
+    vec4 FragPosLightSpace;
+} vs_out;
+
+uniform mat4 model;
+uniform mat4 view;
+uniform mat4 projection;
+uniform mat4 lightSpaceMatrix;
+uniform bool useInstancing;
+
+uniform vec3 positionOffset;
+uniform vec3 positionScale;
+uniform vec4 uvScaleOffset;
+
+vec3 OctahedralDecode(vec2 e)
+{
+    vec3 n = vec3(e, 1.0 - abs(e.x) - abs(e.y));
+    float t = max(-n.z, 0.0);
+    n.xy += mix(vec2(t), vec2(-t), greaterThanEqual(n.xy, vec2(0.0)));
+    return normalize(n);
+}
+
+void main()
+{
+    mat4 m;
+    mat3 normalMatrix;
+    if (useInstancing)
+    {
+        m = mat4(i_col0, i_col1, i_col2, i_col3);
+        normalMatrix = mat3(i_normal0, i_normal1, i_normal2);
+    }
+    else
+    {
+        m = model;
+        normalMatrix = mat3(transpose(inverse(m)));
+    }
+    vec4 worldPos = m * vec4(positionOffset + aPos * positionScale, 1.0);
+    vs_out.FragPos = vec3(worldPos);
+    vs_out.Normal = normalMatrix * OctahedralDecode(aNormal);
+    vs_out.TexCoords = aTexCoords * uvScaleOffset.xy + uvScaleOffset.zw;
+    vs_out.FragPosLightSpace = lightSpaceMatrix * worldPos;
+    gl_Position = projection * view * worldPos;
+}
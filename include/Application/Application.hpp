@@ -41,6 +41,8 @@
 #include "../Input/Keyboard.hpp"
 #include "../Input/Mouse.hpp"
 #include "../Input/Gamepad.hpp"
+#include "../Memory/FrameAllocator.hpp"
+#include "../Memory/MemoryTracker.hpp"
 
 namespace lux
 {
@@ -159,6 +161,8 @@ namespace lux
         Scope<Keyboard> m_keyboard;
         Scope<Gamepad> m_gamepad;
 
+        FrameAllocator m_frameAllocator;
+
         bool isRunning = true;
         double m_lastFrameTime = 0.0f;
     };
@@ -56,6 +56,7 @@ namespace lux
 
     static const int WindowSamples = 4;
     static const int TextureUnits = 32;
+    static constexpr double MemoryDumpInterval = 10.0;   // Seconds between two memory summaries in the log
 
     static constexpr bool IsBigEndian = []
     {
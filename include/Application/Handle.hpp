@@ -0,0 +1,266 @@
+/*
+ * Project: TestProject
+ * File: Handle.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 18:20
+ *
+ * Copyright © 2026 olegfresi
+ *
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ *
+ *     https://opensource.org/licenses/MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include "Pointers.hpp"
+#include "Assertion.hpp"
+
+/*  Generational handles
+ *
+ *  A Handle<T> is a 32 or 64-bit integer naming an object registered in a HandleTable<T>: a slot
+ *  index, the generation of that slot and the type of the object. Render code stores and passes
+ *  handles instead of Ref<T> copies, no reference count is touched and a handle to an object that
+ *  was removed, or to an object of another type, resolves to null instead of to whatever took the
+ *  slot over.
+ *
+ *        +------------+------------------+--------------+
+ *  32 bit | TYPE 4     | GENERATION 8     | INDEX 20     |
+ *  64 bit | TYPE 16    | GENERATION 16    | INDEX 32     |
+ *        +------------+------------------+--------------+
+ *
+ *  The table keeps one TaggedPointer per slot, its tag holds the slot generation. Removing an
+ *  object bumps the generation; a slot whose generation would wrap is retired, so a stale handle
+ *  never validates again. The table does not own the objects and is not thread safe.
+ *--------------------------------------------------------------------------------*/
+namespace lux
+{
+    class Mesh;
+    class Texture2D;
+    class Shader;
+    class Buffer;
+
+    /**
+     * @brief Type stored in a handle, values from USER up are free for game side resources
+     */
+    enum class HandleType : uint8_t
+    {
+        NONE = 0,
+        MESH,
+        TEXTURE,
+        SHADER,
+        BUFFER,
+        USER = 8
+    };
+
+    template<typename T>
+    inline constexpr HandleType HandleTypeOf = HandleType::NONE;
+
+    template<> inline constexpr HandleType HandleTypeOf<Mesh> = HandleType::MESH;
+    template<> inline constexpr HandleType HandleTypeOf<Texture2D> = HandleType::TEXTURE;
+    template<> inline constexpr HandleType HandleTypeOf<Shader> = HandleType::SHADER;
+    template<> inline constexpr HandleType HandleTypeOf<Buffer> = HandleType::BUFFER;
+
+    template<typename Word>
+    struct HandleLayout;
+
+    template<>
+    struct HandleLayout<uint32_t>
+    {
+        static constexpr uint32_t IndexBits = 20;
+        static constexpr uint32_t GenerationBits = 8;
+        static constexpr uint32_t TypeBits = 4;
+    };
+
+    template<>
+    struct HandleLayout<uint64_t>
+    {
+        static constexpr uint32_t IndexBits = 32;
+        static constexpr uint32_t GenerationBits = 16;
+        static constexpr uint32_t TypeBits = 16;
+    };
+
+    template<typename T, typename Word = uint32_t>
+    class Handle
+    {
+        using Layout = HandleLayout<Word>;
+
+    public:
+        static constexpr HandleType Type = HandleTypeOf<std::remove_const_t<T>>;
+        static constexpr Word MaxIndex = (Word{1} << Layout::IndexBits) - 1;
+        static constexpr Word MaxGeneration = (Word{1} << Layout::GenerationBits) - 1;
+
+        static_assert(Type != HandleType::NONE, "Handle: T has no HandleType, specialize HandleTypeOf");
+        static_assert(static_cast<Word>(Type) < (Word{1} << Layout::TypeBits), "Handle: HandleType does not fit the type bits");
+
+        constexpr Handle() noexcept = default;
+
+        constexpr Handle(Word index, Word generation) noexcept :
+            m_value{(index & MaxIndex) | (generation & MaxGeneration) << Layout::IndexBits | TypeBits} {}
+
+        /**
+         * @brief Handle from GetValue(), null if value names an object of another type
+         */
+        [[nodiscard]] static constexpr Handle FromValue(Word value) noexcept
+        {
+            Handle handle;
+            if ((value >> TypeShift) == static_cast<Word>(Type))
+                handle.m_value = value;
+            return handle;
+        }
+
+        [[nodiscard]] constexpr Word GetValue() const noexcept { return m_value; }
+        [[nodiscard]] constexpr Word GetIndex() const noexcept { return m_value & MaxIndex; }
+        [[nodiscard]] constexpr Word GetGeneration() const noexcept { return (m_value >> Layout::IndexBits) & MaxGeneration; }
+        [[nodiscard]] constexpr HandleType GetType() const noexcept { return static_cast<HandleType>(m_value >> TypeShift); }
+
+        [[nodiscard]] constexpr bool IsNull() const noexcept { return m_value == 0; }
+        constexpr explicit operator bool() const noexcept { return m_value != 0; }
+
+        constexpr bool operator==(const Handle&) const noexcept = default;
+
+    private:
+        static constexpr uint32_t TypeShift = Layout::IndexBits + Layout::GenerationBits;
+        static constexpr Word TypeBits = static_cast<Word>(Type) << TypeShift;
+
+        Word m_value = 0;
+    };
+
+    template<typename T>
+    using Handle64 = Handle<T, uint64_t>;
+
+    using MeshHandle = Handle<Mesh>;
+    using TextureHandle = Handle<Texture2D>;
+    using ShaderHandle = Handle<Shader>;
+    using BufferHandle = Handle<Buffer>;
+
+    /**
+     * @brief Slot table resolving handles to objects owned elsewhere
+     */
+    template<typename T, typename Word = uint32_t>
+    class HandleTable
+    {
+    public:
+        using HandleT = Handle<T, Word>;
+
+        static_assert(HandleT::MaxGeneration <= UINT16_MAX, "HandleTable: generations live in the 16 bit pointer tag");
+
+        /**
+         * @brief Registers object, which has to stay alive and in place until it is removed
+         */
+        [[nodiscard]] HandleT Insert(NonOwnPtr<T> object)
+        {
+            CORE_ASSERT(object, "HandleTable: cannot insert a null object")
+
+            Word index;
+            if (!m_free.empty())
+            {
+                index = m_free.back();
+                m_free.pop_back();
+                m_slots[index].SetUnderlying(object);
+            }
+            else
+            {
+                if (m_slots.size() > HandleT::MaxIndex)
+                    throw std::length_error("HandleTable: out of slots");
+
+                // Room for every slot on the free list, so Remove() cannot throw
+                m_slots.emplace_back(object);
+                m_free.reserve(m_slots.capacity());
+                index = static_cast<Word>(m_slots.size() - 1);
+            }
+
+            ++m_size;
+            return HandleT{index, m_slots[index].GetTag()};
+        }
+
+        /**
+         * @brief Unregisters the object, every copy of handle resolves to null from now on
+         * @return false if handle was already stale
+         */
+        bool Remove(HandleT handle) noexcept
+        {
+            if (!Contains(handle))
+                return false;
+
+            Slot& slot = m_slots[handle.GetIndex()];
+            slot.SetUnderlying(nullptr);
+            --m_size;
+
+            if (slot.GetTag() < HandleT::MaxGeneration)
+            {
+                slot.SetTag(static_cast<uint16_t>(slot.GetTag() + 1));
+                m_free.push_back(static_cast<Word>(handle.GetIndex()));
+            }
+
+            return true;
+        }
+
+        /**
+         * @brief The object, or null if handle is null, stale or from another table of the same type
+         */
+        [[nodiscard]] NonOwnPtr<T> Get(HandleT handle) const noexcept
+        {
+            // The null handle has no type and fails the first test
+            if (handle.GetType() != HandleT::Type || handle.GetIndex() >= m_slots.size())
+                return nullptr;
+
+            const Slot& slot = m_slots[handle.GetIndex()];
+            return slot.GetTag() == handle.GetGeneration() ? slot.GetUnderlying() : nullptr;
+        }
+
+        [[nodiscard]] T& At(HandleT handle) const
+        {
+            if (NonOwnPtr<T> object = Get(handle))
+                return *object;
+
+            throw std::out_of_range("HandleTable: stale or invalid handle");
+        }
+
+        [[nodiscard]] bool Contains(HandleT handle) const noexcept { return Get(handle) != nullptr; }
+
+        [[nodiscard]] size_t GetSize() const noexcept { return m_size; }
+        [[nodiscard]] bool IsEmpty() const noexcept { return m_size == 0; }
+
+        /**
+         * @brief Slots ever created, retired ones included
+         */
+        [[nodiscard]] size_t GetSlotCount() const noexcept { return m_slots.size(); }
+
+    private:
+        using Slot = TaggedPointer<T>;
+
+        std::vector<Slot> m_slots;
+        std::vector<Word> m_free;
+        size_t m_size = 0;
+    };
+}
+
+template<typename T, typename Word>
+struct std::hash<lux::Handle<T, Word>>
+{
+    size_t operator()(lux::Handle<T, Word> handle) const noexcept { return std::hash<Word>{}(handle.GetValue()); }
+};
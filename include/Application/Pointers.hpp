@@ -29,29 +29,92 @@
  * SOFTWARE.
  */
 #pragma once
+#include <bit>
+#include <cstdint>
 #include <memory>
+#include <type_traits>
 #include "spdlog/fmt/bundled/chrono.h"
 
 namespace lux
 {
+    // Lets the allocator-aware overloads below take std::allocator_arg calls from the plain ones
+    template<typename ... Args>
+    inline constexpr bool StartsWithAllocatorArg = false;
+    template<typename First, typename ... Rest>
+    inline constexpr bool StartsWithAllocatorArg<First, Rest...> = std::is_same_v<std::remove_cvref_t<First>, std::allocator_arg_t>;
+
     template<typename T>
     using Ref = std::shared_ptr<T>;
-    template<typename T, typename ... Args>
+    template<typename T, typename ... Args> requires (!StartsWithAllocatorArg<Args...>)
     constexpr Ref<T> CreateRef(Args&& ... args)
     {
         static_assert(std::is_constructible_v<T, Args&&...>, "CreateRef: T is not constructible form Args");
         return std::make_shared<T>(std::forward<Args>(args)...);
     }
 
-    template <typename T>
-    using Scope = std::unique_ptr<T>;
-    template<typename T, typename ... Args>
+    /**
+     * @brief Ref whose object and control block come from alloc, e.g. a SlabStdAllocator
+     */
+    template<typename T, typename Alloc, typename ... Args>
+    Ref<T> CreateRef(std::allocator_arg_t, const Alloc& alloc, Args&& ... args)
+    {
+        static_assert(std::is_constructible_v<T, Args&&...>, "CreateRef: T is not constructible form Args");
+        return std::allocate_shared<T>(alloc, std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Deleter of a Scope made by the allocator-aware CreateScope, destroys and deallocates through Alloc
+     */
+    template<typename T, typename Alloc>
+    class AllocatorDeleter
+    {
+    public:
+        using Allocator = typename std::allocator_traits<Alloc>::template rebind_alloc<T>;
+        using Traits = std::allocator_traits<Allocator>;
+
+        AllocatorDeleter() = default;
+        explicit AllocatorDeleter(const Alloc& alloc) noexcept : m_alloc{alloc} {}
+
+        void operator()(T* ptr) noexcept
+        {
+            Traits::destroy(m_alloc, ptr);
+            Traits::deallocate(m_alloc, ptr, 1);
+        }
+
+    private:
+        [[no_unique_address]] Allocator m_alloc;
+    };
+
+    template <typename T, typename Deleter = std::default_delete<T>>
+    using Scope = std::unique_ptr<T, Deleter>;
+    template<typename T, typename ... Args> requires (!StartsWithAllocatorArg<Args...>)
     constexpr Scope<T> CreateScope(Args&&... args)
     {
         static_assert(std::is_constructible_v<T, Args&&...>, "CreateRef: T is not constructible form Args");
         return std::make_unique<T>(std::forward<Args>(args)...);
     }
 
+    template<typename T, typename Alloc, typename ... Args>
+    Scope<T, AllocatorDeleter<T, Alloc>> CreateScope(std::allocator_arg_t, const Alloc& alloc, Args&&... args)
+    {
+        static_assert(std::is_constructible_v<T, Args&&...>, "CreateScope: T is not constructible form Args");
+
+        using Deleter = AllocatorDeleter<T, Alloc>;
+        typename Deleter::Allocator allocator {alloc};
+        T* ptr = Deleter::Traits::allocate(allocator, 1);
+        try
+        {
+            Deleter::Traits::construct(allocator, ptr, std::forward<Args>(args)...);
+        }
+        catch (...)
+        {
+            Deleter::Traits::deallocate(allocator, ptr, 1);
+            throw;
+        }
+
+        return Scope<T, Deleter>{ptr, Deleter{alloc}};
+    }
+
     template<typename T>
     using NonOwnPtr = T*;
 
@@ -59,17 +122,20 @@ namespace lux
     /*   TAGGED POINTER INTERNAL STRUCTURE
 
          | <tag bits> | <address bits> |
-           16 bits   Max Addressable Space - 16 bits
+           16 bits      48 bits, the lowest log2(Alignment) of them always zero
+
+         x86-64 and AArch64 user space addresses fit in 48 bits, so the upper 16 bits of a 64-bit
+         pointer are free for a tag. A pointer to an Alignment aligned object also has log2(Alignment)
+         low bits that are always zero and can hold small flags. GetUnderlying() masks both away and
+         sign extends bit 47, which gives back the canonical address.
 
-         | <tag bits> |  -->  1 bit for representing null pointer
-                              1 bit for representing memory coming from heap
-                              5 bits for encoding pointed type
-                              6 bits for encoding alignment
+        +----------------+----------------------------------------------+---------------------------+
+        | TAG 16 bits    | ADDRESS 48 bits                              | LOW BITS log2(Alignment)  |
+        +----------------+----------------------------------------------+---------------------------+
+                                                64 bit pointer
 
-        +-------------+------------------+------------------+-------------------+----------------------+----------------+
-        | TYPE 7 bits | ALIGNMENT 6 bits | STACK/HEAP 1 bit | NULL_POINTER 1 bit| HAS DESTRUCTOR 1 bit | ADDRESS 48 bit |
-        +-------------+------------------+------------------+-------------------+----------------------+----------------+
-                                                    64 bit pointer
+         32-bit targets have no spare address bits, there the tag is a separate 16-bit member and
+         only the low bits are packed.
     */
 
     using word_t = uintptr_t;
@@ -77,35 +143,85 @@ namespace lux
     template<typename T, size_t Alignment = alignof(T)>
     class TaggedPointer
     {
+        static_assert(std::has_single_bit(Alignment), "TaggedPointer: alignment must be a power of two");
+
+        // Without spare upper address bits the tag is stored next to the pointer
+        struct NoTag
+        {
+            bool operator==(const NoTag&) const noexcept = default;
+        };
+
     public:
-        TaggedPointer() : m_underlying{nullptr} {}
-        explicit TaggedPointer(T* ptr) noexcept : m_underlying{ptr} { static_assert(sizeof(word_t) <= 4, "Too small address set"); }
-        TaggedPointer(const TaggedPointer& other) noexcept : m_underlying{other.m_underlying} {}
-        TaggedPointer(TaggedPointer&& other) noexcept : m_underlying{std::move(other.m_underlying)} {}
-        ~TaggedPointer() = default;
+        static constexpr bool Packed = sizeof(word_t) == 8;
+        static constexpr word_t TagBits = 16;
+        static constexpr word_t AddressBits = Packed ? (sizeof(word_t) << 3) - TagBits : sizeof(word_t) << 3;
+        static constexpr word_t LowBits = std::countr_zero(Alignment);
+        static constexpr word_t LowMask = (word_t{1} << LowBits) - 1;
+
+        TaggedPointer() noexcept = default;
+        explicit TaggedPointer(T* ptr, uint16_t tag = 0) noexcept : m_word{Pack(ptr, 0)} { SetTag(tag); }
+
+        [[nodiscard]] T* GetUnderlying() const noexcept
+        {
+            if constexpr (Packed)
+            {
+                const auto address = static_cast<intptr_t>(m_word << TagBits) >> TagBits;
+                return reinterpret_cast<T*>(static_cast<word_t>(address) & ~LowMask);
+            }
+            else
+                return reinterpret_cast<T*>(m_word & ~LowMask);
+        }
+
+        /**
+         * @brief Points somewhere else, keeping the tag and the low bits
+         */
+        void SetUnderlying(T* ptr) noexcept
+        {
+            const uint16_t tag = GetTag();
+            m_word = Pack(ptr, GetLowBits());
+            SetTag(tag);
+        }
 
-        TaggedPointer& operator=(const TaggedPointer& other) noexcept
+        [[nodiscard]] uint16_t GetTag() const noexcept
         {
-            m_underlying = other;
-            return *this;
+            if constexpr (Packed)
+                return static_cast<uint16_t>(m_word >> TagShift);
+            else
+                return m_tag;
         }
 
-        TaggedPointer& operator=(TaggedPointer&& other) noexcept
+        void SetTag(uint16_t tag) noexcept
         {
-            m_underlying = std::move(other);
-            return *this;
+            if constexpr (Packed)
+                m_word = (m_word & AddressMask) | (word_t{tag} << TagShift);
+            else
+                m_tag = tag;
         }
 
-        T* operator->() const noexcept { return m_underlying; }
-        T& operator*()  const noexcept { return *m_underlying; }
+        /**
+         * @brief Flags kept in the alignment bits, bits past LowBits are dropped
+         */
+        [[nodiscard]] word_t GetLowBits() const noexcept { return m_word & LowMask; }
+        void SetLowBits(word_t bits) noexcept { m_word = (m_word & ~LowMask) | (bits & LowMask); }
 
-        T* GetUnderlying() const noexcept { return m_underlying; }
+        T* operator->() const noexcept { return GetUnderlying(); }
+        T& operator*()  const noexcept { return *GetUnderlying(); }
+
+        explicit operator bool() const noexcept { return GetUnderlying() != nullptr; }
+
+        bool operator==(const TaggedPointer&) const noexcept = default;
 
     private:
+        // Zero when unpacked, so no shift below reaches the width of word_t
+        static constexpr word_t TagShift = Packed ? AddressBits : 0;
+        static constexpr word_t AddressMask = Packed ? (word_t{1} << TagShift) - 1 : ~word_t{0};
+
+        word_t m_word = 0;
+        [[no_unique_address]] std::conditional_t<Packed, NoTag, uint16_t> m_tag {};
 
-        static constexpr uint64_t m_upperTagBits = 16;
-        static constexpr uint64_t m_lowerTagBits = std::log2(alignof(T));
-        static constexpr uint64_t m_addressBits = (sizeof(word_t) << 3) - m_upperTagBits;
-        T* m_underlying;
+        static word_t Pack(T* ptr, word_t lowBits) noexcept
+        {
+            return (reinterpret_cast<word_t>(ptr) & AddressMask) | (lowBits & LowMask);
+        }
     };
-}
+}
\ No newline at end of file
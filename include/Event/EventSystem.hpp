@@ -31,11 +31,11 @@
 #pragma once
 #include <functional>
 #include <queue>
-#include <any>
 #include <typeindex>
 #include <vector>
 #include <unordered_map>
 #include "../Application/HashedString.hpp"
+#include "../Memory/PoolAllocator.hpp"
 
 namespace lux
 {
@@ -49,12 +49,27 @@ namespace lux
         struct ListenerWrapper
         {
             uint32_t id;
-            std::function<void(std::any)> callback;
+            std::function<void(const void*)> callback;
         };
 
+        // Queued events live in pool chunks, the few that do not fit one go to the heap; both count as EVENT memory
+        struct QueuedEvent
+        {
+            std::type_index type;
+            void* event;
+            void (*destroy)(PoolAllocator&, void*);
+        };
+
+        static constexpr size_t EventChunkSize = 64;
+        static constexpr size_t EventPoolSize = 16 * 1024;
+
+        template <typename Event>
+        static constexpr bool FitsEventChunk = sizeof(Event) <= EventChunkSize && alignof(Event) <= PoolAllocator::ChunkAlignment;
+
         std::unordered_map<std::type_index , std::vector<ListenerWrapper>> mListeners;
-        std::queue<std::any> mEventQueue;
+        std::queue<QueuedEvent> mEventQueue;
         std::queue<std::function<void()>> mTasks;
+        PoolAllocator mEventPool {EventPoolSize, EventChunkSize, MemoryTag::EVENT};
 
     public:
 
@@ -67,9 +82,9 @@ namespace lux
         template <typename Event>
         void RegisterListener(uint32_t listenerId, std::function<void(const Event&)> callback)
         {
-            auto wrapper = [callback](std::any event)
+            auto wrapper = [callback](const void* event)
             {
-                callback(std::any_cast<const Event&>(event));
+                callback(*static_cast<const Event*>(event));
             };
             mListeners[typeid(Event)].push_back({listenerId, wrapper});
         }
@@ -103,7 +118,21 @@ namespace lux
         void PostEvent(Args&&... args)
         {
             static_assert(std::is_constructible_v<Event, Args&&...>, "PostEvent: Event is not constructible form Args");
-            mEventQueue.push(Event(((std::forward<Args>( args )))...));
+
+            if constexpr (FitsEventChunk<Event>)
+            {
+                mEventQueue.push({typeid(Event), mEventPool.New<Event>(std::forward<Args>(args)...),
+                                  [](PoolAllocator& pool, void* event) { pool.Delete(static_cast<Event*>(event)); }});
+            }
+            else
+            {
+                mEventQueue.push({typeid(Event), new Event(std::forward<Args>(args)...), [](PoolAllocator&, void* event)
+                {
+                    delete static_cast<Event*>(event);
+                    MemoryTracker::OnFree(MemoryTag::EVENT, sizeof(Event));
+                }});
+                MemoryTracker::OnAllocate(MemoryTag::EVENT, sizeof(Event));
+            }
         }
 
         template <typename Task>
@@ -116,21 +145,35 @@ namespace lux
         {
             while (!mEventQueue.empty())
             {
-                std::any event = std::move(mEventQueue.front());
+                const QueuedEvent event = mEventQueue.front();
                 mEventQueue.pop();
 
-                auto it = mListeners.find(event.type());
+                // Released even if a listener throws
+                struct Release
+                {
+                    PoolAllocator& pool;
+                    const QueuedEvent& event;
+                    ~Release() { event.destroy(pool, event.event); }
+                } release {mEventPool, event};
+
+                auto it = mListeners.find(event.type);
                 if (it != mListeners.end())
                 {
                     for (const auto& listener : it->second)
-                        listener.callback(event);
+                        listener.callback(event.event);
                 }
             }
             return;
         }
 
         EventDispatcher() = default;
-        ~EventDispatcher() = default;
+
+        ~EventDispatcher()
+        {
+            for (; !mEventQueue.empty(); mEventQueue.pop())
+                mEventQueue.front().destroy(mEventPool, mEventQueue.front().event);
+        }
+
         EventDispatcher(const EventDispatcher&) = delete;
         EventDispatcher& operator=(const EventDispatcher&) = delete;
         EventDispatcher(EventDispatcher&&) = default;
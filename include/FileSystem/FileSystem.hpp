@@ -30,8 +30,10 @@
  */
 #pragma once
 #include <string>
+#include <string_view>
 #include <vector>
 #include <filesystem>
+#include <memory_resource>
 #include "../Application/Assertion.hpp"
 
 struct FileSystem
@@ -42,6 +44,17 @@ struct FileSystem
     static std::string ToUpper(const std::string& s);
     static std::string ToLower(const std::string& s);
 
-    static std::vector<std::string> Split(std::string line, const std::string& delim);
+    static std::vector<std::string> Split(std::string_view line, std::string_view delim);
+
+    /**
+     * @brief Same tokens as Split(), allocated from resource (e.g. the arena of a load job)
+     */
+    static std::pmr::vector<std::pmr::string> Split(std::string_view line, std::string_view delim,
+                                                    std::pmr::memory_resource* resource);
+
+    /**
+     * @brief Replaces the content of tokens, whose capacity and short tokens need no new allocation in a parse loop
+     */
+    static void Split(std::string_view line, std::string_view delim, std::pmr::vector<std::pmr::string>& tokens);
     static std::vector<std::filesystem::path> GetFilesInDirectory(const std::string& directoryPath);
 };
\ No newline at end of file
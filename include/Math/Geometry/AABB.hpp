@@ -0,0 +1,86 @@
+/*
+ * Project: TestProject
+ * File: AABB.hpp
+ * Author: olegfresi
+ * Created: 16/10/26 13:10
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <limits>
+#include <span>
+#include "../Vector.hpp"
+
+namespace lux::math
+{
+    /**
+     * @brief Axis aligned bounding box stored as its min and max corners
+     */
+    struct AABB
+    {
+        Vector3f min;
+        Vector3f max;
+
+        [[nodiscard]] Vector3f Center() const noexcept
+        {
+            return (min + max) * 0.5f;
+        }
+
+        [[nodiscard]] Vector3f Extents() const noexcept
+        {
+            return (max - min) * 0.5f;
+        }
+
+        [[nodiscard]] bool Contains(const Vector3f& point) const noexcept
+        {
+            return point.GetX() >= min.GetX() && point.GetX() <= max.GetX() &&
+                   point.GetY() >= min.GetY() && point.GetY() <= max.GetY() &&
+                   point.GetZ() >= min.GetZ() && point.GetZ() <= max.GetZ();
+        }
+
+        void Expand(const Vector3f& point) noexcept
+        {
+            min = Vector3f{std::min(min.GetX(), point.GetX()), std::min(min.GetY(), point.GetY()),
+                           std::min(min.GetZ(), point.GetZ())};
+            max = Vector3f{std::max(max.GetX(), point.GetX()), std::max(max.GetY(), point.GetY()),
+                           std::max(max.GetZ(), point.GetZ())};
+        }
+
+        /**
+         * @brief Smallest box containing every point, an inverted (empty) box for an empty span
+         */
+        [[nodiscard]] static AABB FromPoints(std::span<const Vector3f> points) noexcept
+        {
+            constexpr float inf = std::numeric_limits<float>::infinity();
+            AABB box{Vector3f{inf, inf, inf}, Vector3f{-inf, -inf, -inf}};
+
+            for (const auto& point : points)
+                box.Expand(point);
+
+            return box;
+        }
+    };
+}
@@ -28,4 +28,26 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#pragma once
\ No newline at end of file
+#pragma once
+#include "Line.hpp"
+
+namespace lux::math
+{
+    /**
+     * @brief Points within radius of the segment start-end
+     */
+    struct Capsule
+    {
+        Vector3f start;
+        Vector3f end;
+        float radius = 0.0f;
+
+        [[nodiscard]] Line Axis() const noexcept { return {start, end}; }
+
+        [[nodiscard]] bool Contains(const Vector3f& point) const noexcept
+        {
+            const Vector3f d = point - Axis().ClosestPoint(point);
+            return d.Dot(d) <= radius * radius;
+        }
+    };
+}
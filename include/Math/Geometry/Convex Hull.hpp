@@ -28,4 +28,592 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#pragma once
\ No newline at end of file
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cfloat>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include <thread>
+#include <vector>
+#include "Plane.hpp"
+#include "../../Memory/ArenaAllocator.hpp"
+
+/*  Quickhull
+ *
+ *  3D convex hull of a point cloud, meant for cheap collision and occlusion proxies of
+ *  heavy meshes. The hull is kept as triangles linked by half-edges. Faces live in fixed
+ *  size chunks carved out of Arena blocks, and faces removed while the hull grows are
+ *  recycled through a free list, so the structure never touches the general heap once
+ *  warm.
+ *
+ *  The point furthest outside the current hull is always added next. Stopping once the
+ *  hull reaches ConvexHullSettings::maxVertices therefore yields the best greedy
+ *  simplification. Such a hull lies inside the full one and may leave input points
+ *  outside.
+ *
+ *  For large inputs, the partition of all points over the initial tetrahedron, which is
+ *  the only pass over the whole input, is split across threads. The result does not
+ *  depend on the thread count.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math
+{
+    struct ConvexHullSettings
+    {
+        /** @brief Upper bound on the hull vertices, at least 4 */
+        size_t maxVertices = std::numeric_limits<size_t>::max();
+
+        /** @brief Inputs with at least this many points are partitioned on several threads */
+        size_t parallelThreshold = size_t{1} << 16;
+
+        /** @brief Worker threads for the partition, 0 uses std::thread::hardware_concurrency() */
+        uint32_t threadCount = 0;
+    };
+
+    /**
+     * @brief Triangulated convex hull, triangles wind counter-clockwise seen from outside
+     *
+     * Empty when the input has fewer than four points that are not coplanar.
+     */
+    struct ConvexHull
+    {
+        std::vector<Vector3f> vertices;
+        std::vector<uint32_t> indices;
+
+        [[nodiscard]] bool Empty() const noexcept { return indices.empty(); }
+        [[nodiscard]] size_t TriangleCount() const noexcept { return indices.size() / 3; }
+    };
+
+    namespace detail
+    {
+        class QuickHull
+        {
+        public:
+            QuickHull(std::span<const Vector3f> points, const ConvexHullSettings& settings) noexcept :
+                m_points{points}, m_settings{settings}
+            {
+                CORE_ASSERT(points.size() < None, "QuickHull: too many points")
+            }
+
+            [[nodiscard]] ConvexHull Build()
+            {
+                if (m_points.size() < 4 || !BuildSimplex())
+                    return {};
+
+                while (!m_queue.empty())
+                {
+                    std::pop_heap(m_queue.begin(), m_queue.end(), QueueOrder);
+                    const QueueEntry entry = m_queue.back();
+                    m_queue.pop_back();
+
+                    HullFace* face = entry.face;
+                    if (!face->alive || face->generation != entry.generation || face->furthest == None)
+                        continue;
+
+                    if (m_liveFaces / 2 + 2 >= m_settings.maxVertices)
+                        break;
+
+                    AddPoint(face);
+                }
+
+                return Extract();
+            }
+
+        private:
+            static constexpr uint32_t None = std::numeric_limits<uint32_t>::max();
+            static constexpr size_t FacesPerChunk = 64;
+            static constexpr size_t ChunksPerArena = 32;
+
+            struct HullFace;
+
+            struct HalfEdge
+            {
+                HalfEdge* twin = nullptr;
+                HullFace* face = nullptr;
+                uint32_t origin = None;
+            };
+
+            struct HullFace
+            {
+                std::array<HalfEdge, 3> edges;
+                Plane plane;
+                uint32_t outsideHead = None;
+                uint32_t furthest = None;
+                float furthestDistance = 0.0f;
+                uint32_t generation = 0;
+                bool alive = false;
+                bool visible = false;
+                HullFace* nextFree = nullptr;
+            };
+
+            struct FaceChunk
+            {
+                std::array<HullFace, FacesPerChunk> faces;
+            };
+
+            struct QueueEntry
+            {
+                float distance;
+                HullFace* face;
+                uint32_t generation;
+            };
+
+            struct HorizonEdge
+            {
+                uint32_t from;
+                uint32_t to;
+                HalfEdge* twin;
+            };
+
+            struct VisitEntry
+            {
+                HullFace* face;
+                uint8_t start;
+                uint8_t step;
+            };
+
+            /** Outside lists of the four simplex faces built by one partition worker */
+            struct PartitionLists
+            {
+                std::array<uint32_t, 4> head;
+                std::array<uint32_t, 4> tail;
+                std::array<uint32_t, 4> furthest;
+                std::array<float, 4> distance;
+            };
+
+            std::span<const Vector3f> m_points;
+            ConvexHullSettings m_settings;
+            float m_epsilon = 0.0f;
+
+            std::vector<Scope<Arena>> m_arenas;
+            std::vector<FaceChunk*> m_chunks;
+            size_t m_chunksInArena = ChunksPerArena;
+            size_t m_facesInChunk = FacesPerChunk;
+            HullFace* m_freeFaces = nullptr;
+            size_t m_liveFaces = 0;
+
+            std::vector<uint32_t> m_nextOutside;
+            std::vector<QueueEntry> m_queue;
+            std::vector<VisitEntry> m_stack;
+            std::vector<HullFace*> m_visible;
+            std::vector<HorizonEdge> m_horizon;
+            std::vector<HullFace*> m_newFaces;
+            std::vector<uint32_t> m_orphans;
+
+            static bool QueueOrder(const QueueEntry& a, const QueueEntry& b) noexcept
+            {
+                return a.distance < b.distance;
+            }
+
+            static HalfEdge* Next(HalfEdge* edge) noexcept
+            {
+                auto& edges = edge->face->edges;
+                return &edges[(edge - edges.data() + 1) % 3];
+            }
+
+            HullFace* AllocateFace(uint32_t a, uint32_t b, uint32_t c)
+            {
+                HullFace* face = m_freeFaces;
+                if (face)
+                    m_freeFaces = face->nextFree;
+                else
+                {
+                    if (m_facesInChunk == FacesPerChunk)
+                    {
+                        if (m_chunksInArena == ChunksPerArena)
+                        {
+                            m_arenas.push_back(CreateScope<Arena>(ChunksPerArena * (sizeof(FaceChunk) + alignof(FaceChunk))));
+                            m_chunksInArena = 0;
+                        }
+
+                        m_chunks.push_back(m_arenas.back()->Create<FaceChunk>());
+                        ++m_chunksInArena;
+                        m_facesInChunk = 0;
+                    }
+
+                    face = &m_chunks.back()->faces[m_facesInChunk++];
+                }
+
+                const uint32_t generation = face->generation + 1;
+                *face = HullFace{};
+                face->generation = generation;
+                face->alive = true;
+
+                const std::array<uint32_t, 3> origins{a, b, c};
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    face->edges[i].face = face;
+                    face->edges[i].origin = origins[i];
+                }
+
+                face->plane = Plane::FromPoints(m_points[a], m_points[b], m_points[c]);
+                ++m_liveFaces;
+                return face;
+            }
+
+            void FreeFace(HullFace* face) noexcept
+            {
+                face->alive = false;
+                face->nextFree = m_freeFaces;
+                m_freeFaces = face;
+                --m_liveFaces;
+            }
+
+            void PushOutside(HullFace* face, uint32_t point, float distance) noexcept
+            {
+                m_nextOutside[point] = face->outsideHead;
+                face->outsideHead = point;
+
+                if (face->furthest == None || distance > face->furthestDistance)
+                {
+                    face->furthest = point;
+                    face->furthestDistance = distance;
+                }
+            }
+
+            void Enqueue(HullFace* face)
+            {
+                if (face->furthest == None)
+                    return;
+
+                m_queue.push_back({face->furthestDistance, face, face->generation});
+                std::push_heap(m_queue.begin(), m_queue.end(), QueueOrder);
+            }
+
+            bool BuildSimplex()
+            {
+                const size_t count = m_points.size();
+
+                std::array<uint32_t, 6> extremes{};
+                for (uint32_t i = 1; i < count; ++i)
+                {
+                    for (size_t axis = 0; axis < 3; ++axis)
+                    {
+                        if (m_points[i][axis] < m_points[extremes[axis * 2]][axis])
+                            extremes[axis * 2] = i;
+                        if (m_points[i][axis] > m_points[extremes[axis * 2 + 1]][axis])
+                            extremes[axis * 2 + 1] = i;
+                    }
+                }
+
+                float maxCoordinates = 0.0f;
+                for (size_t axis = 0; axis < 3; ++axis)
+                    maxCoordinates += std::max(std::abs(m_points[extremes[axis * 2]][axis]),
+                                               std::abs(m_points[extremes[axis * 2 + 1]][axis]));
+                m_epsilon = 3.0f * FLT_EPSILON * maxCoordinates;
+
+                uint32_t i0 = extremes[0], i1 = extremes[1];
+                float best = 0.0f;
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    const Vector3f d = m_points[extremes[axis * 2 + 1]] - m_points[extremes[axis * 2]];
+                    if (d.Dot(d) > best)
+                    {
+                        best = d.Dot(d);
+                        i0 = extremes[axis * 2];
+                        i1 = extremes[axis * 2 + 1];
+                    }
+                }
+
+                if (std::sqrt(best) <= m_epsilon)
+                    return false;
+
+                const Vector3f lineDirection = m_points[i1] - m_points[i0];
+                uint32_t i2 = None;
+                best = 0.0f;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const Vector3f c = Cross(lineDirection, m_points[i] - m_points[i0]);
+                    if (c.Dot(c) > best)
+                    {
+                        best = c.Dot(c);
+                        i2 = i;
+                    }
+                }
+
+                if (i2 == None || std::sqrt(best) / lineDirection.Length() <= m_epsilon)
+                    return false;
+
+                Plane base = Plane::FromPoints(m_points[i0], m_points[i1], m_points[i2]);
+                uint32_t i3 = None;
+                best = 0.0f;
+                for (uint32_t i = 0; i < count; ++i)
+                {
+                    const float distance = std::abs(base.SignedDistance(m_points[i]));
+                    if (distance > best)
+                    {
+                        best = distance;
+                        i3 = i;
+                    }
+                }
+
+                if (i3 == None || best <= m_epsilon)
+                    return false;
+
+                // The apex must lie behind the base so every face normal points outside
+                if (base.SignedDistance(m_points[i3]) > 0.0f)
+                    std::swap(i1, i2);
+
+                std::array<HullFace*, 4> faces
+                {
+                    AllocateFace(i0, i1, i2),
+                    AllocateFace(i1, i0, i3),
+                    AllocateFace(i2, i1, i3),
+                    AllocateFace(i0, i2, i3)
+                };
+
+                for (HullFace* face : faces)
+                    for (HalfEdge& edge : face->edges)
+                        for (HullFace* other : faces)
+                            for (HalfEdge& candidate : other->edges)
+                                if (candidate.origin == Next(&edge)->origin && Next(&candidate)->origin == edge.origin)
+                                    edge.twin = &candidate;
+
+                Partition(faces, {i0, i1, i2, i3});
+
+                for (HullFace* face : faces)
+                    Enqueue(face);
+
+                return true;
+            }
+
+            void PartitionRange(const std::array<HullFace*, 4>& faces, const std::array<uint32_t, 4>& simplex,
+                                uint32_t begin, uint32_t end, PartitionLists& lists) noexcept
+            {
+                lists.head.fill(None);
+                lists.tail.fill(None);
+                lists.furthest.fill(None);
+                lists.distance.fill(0.0f);
+
+                for (uint32_t i = begin; i < end; ++i)
+                {
+                    if (std::find(simplex.begin(), simplex.end(), i) != simplex.end())
+                        continue;
+
+                    size_t target = 0;
+                    float best = m_epsilon;
+                    for (size_t f = 0; f < 4; ++f)
+                    {
+                        const float distance = faces[f]->plane.SignedDistance(m_points[i]);
+                        if (distance > best)
+                        {
+                            best = distance;
+                            target = f + 1;
+                        }
+                    }
+
+                    if (target-- == 0)
+                        continue;
+
+                    m_nextOutside[i] = None;
+                    if (lists.head[target] == None)
+                        lists.head[target] = i;
+                    else
+                        m_nextOutside[lists.tail[target]] = i;
+                    lists.tail[target] = i;
+
+                    if (lists.furthest[target] == None || best > lists.distance[target])
+                    {
+                        lists.furthest[target] = i;
+                        lists.distance[target] = best;
+                    }
+                }
+            }
+
+            void Partition(const std::array<HullFace*, 4>& faces, const std::array<uint32_t, 4>& simplex)
+            {
+                const auto count = static_cast<uint32_t>(m_points.size());
+                m_nextOutside.assign(count, None);
+
+                uint32_t threads = 1;
+                if (count >= m_settings.parallelThreshold)
+                {
+                    threads = m_settings.threadCount ? m_settings.threadCount : std::thread::hardware_concurrency();
+                    threads = std::clamp<uint32_t>(threads, 1, count);
+                }
+
+                std::vector<PartitionLists> lists(threads);
+                const uint32_t step = (count + threads - 1) / threads;
+                auto range = [&](uint32_t t)
+                {
+                    const uint32_t begin = std::min(count, t * step);
+                    PartitionRange(faces, simplex, begin, std::min(count, begin + step), lists[t]);
+                };
+
+                if (threads == 1)
+                    range(0);
+                else
+                {
+                    std::vector<std::thread> workers;
+                    workers.reserve(threads - 1);
+                    for (uint32_t t = 1; t < threads; ++t)
+                        workers.emplace_back(range, t);
+
+                    range(0);
+                    for (auto& worker : workers)
+                        worker.join();
+                }
+
+                // Chain the per thread lists in range order, which keeps the result independent of the thread count
+                for (size_t f = 0; f < 4; ++f)
+                {
+                    HullFace* face = faces[f];
+                    uint32_t tail = None;
+
+                    for (const PartitionLists& part : lists)
+                    {
+                        if (part.head[f] == None)
+                            continue;
+
+                        if (tail == None)
+                            face->outsideHead = part.head[f];
+                        else
+                            m_nextOutside[tail] = part.head[f];
+                        tail = part.tail[f];
+
+                        if (face->furthest == None || part.distance[f] > face->furthestDistance)
+                        {
+                            face->furthest = part.furthest[f];
+                            face->furthestDistance = part.distance[f];
+                        }
+                    }
+                }
+            }
+
+            void ComputeHorizon(HullFace* face, const Vector3f& eye)
+            {
+                m_visible.clear();
+                m_horizon.clear();
+
+                face->visible = true;
+                m_visible.push_back(face);
+                m_stack.push_back({face, 0, 0});
+
+                // Depth first walk over the visible faces, crossing each edge counter-clockwise so the
+                // horizon comes out as a closed loop in winding order
+                while (!m_stack.empty())
+                {
+                    VisitEntry& top = m_stack.back();
+                    if (top.step == 3)
+                    {
+                        m_stack.pop_back();
+                        continue;
+                    }
+
+                    HalfEdge* edge = &top.face->edges[(top.start + top.step++) % 3];
+                    HullFace* neighbor = edge->twin->face;
+                    if (neighbor->visible)
+                        continue;
+
+                    if (neighbor->plane.SignedDistance(eye) > m_epsilon)
+                    {
+                        neighbor->visible = true;
+                        m_visible.push_back(neighbor);
+                        const auto twinIndex = static_cast<uint8_t>(edge->twin - neighbor->edges.data());
+                        m_stack.push_back({neighbor, static_cast<uint8_t>((twinIndex + 1) % 3), 0});
+                    }
+                    else
+                        m_horizon.push_back({edge->origin, Next(edge)->origin, edge->twin});
+                }
+            }
+
+            void AddPoint(HullFace* face)
+            {
+                const uint32_t eyeIndex = face->furthest;
+                const Vector3f& eye = m_points[eyeIndex];
+
+                ComputeHorizon(face, eye);
+
+                m_orphans.clear();
+                for (HullFace* visible : m_visible)
+                {
+                    for (uint32_t point = visible->outsideHead; point != None; point = m_nextOutside[point])
+                        if (point != eyeIndex)
+                            m_orphans.push_back(point);
+
+                    FreeFace(visible);
+                }
+
+                m_newFaces.clear();
+                for (const HorizonEdge& horizon : m_horizon)
+                {
+                    HullFace* newFace = AllocateFace(horizon.from, horizon.to, eyeIndex);
+                    newFace->edges[0].twin = horizon.twin;
+                    horizon.twin->twin = &newFace->edges[0];
+                    m_newFaces.push_back(newFace);
+                }
+
+                for (size_t i = 0; i < m_newFaces.size(); ++i)
+                {
+                    HullFace* current = m_newFaces[i];
+                    HullFace* next = m_newFaces[(i + 1) % m_newFaces.size()];
+                    CORE_ASSERT(current->edges[1].origin == next->edges[0].origin, "QuickHull: horizon is not a closed loop")
+
+                    current->edges[1].twin = &next->edges[2];
+                    next->edges[2].twin = &current->edges[1];
+                }
+
+                for (uint32_t point : m_orphans)
+                {
+                    HullFace* target = nullptr;
+                    float best = m_epsilon;
+                    for (HullFace* newFace : m_newFaces)
+                    {
+                        const float distance = newFace->plane.SignedDistance(m_points[point]);
+                        if (distance > best)
+                        {
+                            best = distance;
+                            target = newFace;
+                        }
+                    }
+
+                    if (target)
+                        PushOutside(target, point, best);
+                }
+
+                for (HullFace* newFace : m_newFaces)
+                    Enqueue(newFace);
+            }
+
+            ConvexHull Extract() const
+            {
+                ConvexHull hull;
+                std::vector<uint32_t> remap(m_points.size(), None);
+                hull.indices.reserve(m_liveFaces * 3);
+
+                for (const FaceChunk* chunk : m_chunks)
+                {
+                    for (const HullFace& face : chunk->faces)
+                    {
+                        if (!face.alive)
+                            continue;
+
+                        for (const HalfEdge& edge : face.edges)
+                        {
+                            uint32_t& index = remap[edge.origin];
+                            if (index == None)
+                            {
+                                index = static_cast<uint32_t>(hull.vertices.size());
+                                hull.vertices.push_back(m_points[edge.origin]);
+                            }
+
+                            hull.indices.push_back(index);
+                        }
+                    }
+                }
+
+                return hull;
+            }
+        };
+    }
+
+    /**
+     * @brief Builds the convex hull of points with quickhull
+     */
+    [[nodiscard]] inline ConvexHull BuildConvexHull(std::span<const Vector3f> points, const ConvexHullSettings& settings = {})
+    {
+        return detail::QuickHull{points, settings}.Build();
+    }
+}
@@ -0,0 +1,223 @@
+/*
+ * Project: TestProject
+ * File: Frustum.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 09:40
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include "AABB.hpp"
+#include "Plane.hpp"
+#include "Sphere.hpp"
+#include "../BatchTransform.hpp"
+#include "../Matrix4.hpp"
+#include "../Simd/Simd.hpp"
+
+/*  View frustum
+ *
+ *  Six normalized planes with the normals pointing inside, extracted from a clip matrix with
+ *  the Gribb/Hartmann method. The clip matrix is read the way operator*(Vector4) applies it,
+ *  clip = m * Vector4(p, 1), and the GL clip volume -w <= x, y, z <= w is assumed. A bound is
+ *  culled only when it lies completely behind one plane, so the tests are conservative: bounds
+ *  near the frustum corners may be reported visible.
+ *
+ *  The batch kernels take bounds as SoA streams, test FloatLanes of them per step against all
+ *  six planes and append the indices of the visible ones to a compacted list.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math
+{
+    struct Frustum
+    {
+        enum PlaneIndex : uint8_t { LEFT = 0, RIGHT, BOTTOM, TOP, NEAR, FAR };
+
+        std::array<Plane, 6> planes;
+
+        /**
+         * @brief Extracts the frustum of a matrix mapping world space to clip space
+         * @param viewProjection See Camera::GetViewProjection()
+         */
+        [[nodiscard]] static Frustum FromMatrix(const Matrix4f& viewProjection) noexcept
+        {
+            const float* m = viewProjection.Data();
+            auto combine = [m](size_t row, float sign)
+            {
+                const Plane plane{Vector3f{m[12] + sign * m[row * 4 + 0], m[13] + sign * m[row * 4 + 1],
+                                           m[14] + sign * m[row * 4 + 2]},
+                                  m[15] + sign * m[row * 4 + 3]};
+                return plane.Normalize();
+            };
+
+            return {{ combine(0, 1.0f), combine(0, -1.0f),
+                      combine(1, 1.0f), combine(1, -1.0f),
+                      combine(2, 1.0f), combine(2, -1.0f) }};
+        }
+
+        [[nodiscard]] bool Intersects(const Sphere& sphere) const noexcept
+        {
+            for (const auto& plane : planes)
+                if (plane.SignedDistance(sphere.center) < -sphere.radius)
+                    return false;
+
+            return true;
+        }
+
+        [[nodiscard]] bool Intersects(const AABB& box) const noexcept
+        {
+            const Vector3f center = box.Center();
+            const Vector3f extents = box.Extents();
+
+            for (const auto& plane : planes)
+            {
+                const float radius = std::abs(plane.normal.GetX()) * extents.GetX() +
+                                     std::abs(plane.normal.GetY()) * extents.GetY() +
+                                     std::abs(plane.normal.GetZ()) * extents.GetZ();
+
+                if (plane.SignedDistance(center) < -radius)
+                    return false;
+            }
+
+            return true;
+        }
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief Appends base + lane for every set bit of mask, writing one slot per lane without branching
+         *
+         * The slot after the last visible index may be overwritten, which stays in bounds as long as
+         * the output holds one slot per input bound.
+         */
+        inline size_t AppendVisible(uint32_t mask, uint32_t base, uint32_t* visible, size_t count) noexcept
+        {
+            for (uint32_t lane = 0; lane < simd::FloatLanes; ++lane)
+            {
+                visible[count] = base + lane;
+                count += (mask >> lane) & 1u;
+            }
+
+            return count;
+        }
+    }
+
+    /**
+     * @brief Writes the indices of the spheres intersecting the frustum to visible, in ascending order
+     * @return Number of visible spheres
+     */
+    inline size_t CullSpheres(const Frustum& frustum, ConstVector3Stream centers, std::span<const float> radii,
+                              std::span<uint32_t> visible) noexcept
+    {
+        using namespace simd;
+        const size_t count = centers.Size();
+        CORE_ASSERT(radii.size() == count, "CullSpheres: radii and centers differ in size")
+        CORE_ASSERT(visible.size() >= count, "CullSpheres: output span too small")
+
+        constexpr size_t L = FloatLanes;
+        size_t visibleCount = 0;
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            const FloatN cx = LoadN(centers.x.data() + i);
+            const FloatN cy = LoadN(centers.y.data() + i);
+            const FloatN cz = LoadN(centers.z.data() + i);
+            const FloatN negRadius = SubN(SplatN(0.0f), LoadN(radii.data() + i));
+
+            FloatN inside = SplatN(std::bit_cast<float>(~0u));
+            for (const auto& plane : frustum.planes)
+            {
+                const FloatN distance = MulAddN(SplatN(plane.normal.GetX()), cx,
+                                        MulAddN(SplatN(plane.normal.GetY()), cy,
+                                        MulAddN(SplatN(plane.normal.GetZ()), cz, SplatN(plane.distance))));
+                inside = AndN(inside, LessEqualN(negRadius, distance));
+            }
+
+            visibleCount = detail::AppendVisible(MaskBitsN(inside), static_cast<uint32_t>(i), visible.data(), visibleCount);
+        }
+
+        for (; i < count; ++i)
+        {
+            const Sphere sphere{Vector3f{centers.x[i], centers.y[i], centers.z[i]}, radii[i]};
+            visible[visibleCount] = static_cast<uint32_t>(i);
+            visibleCount += frustum.Intersects(sphere);
+        }
+
+        return visibleCount;
+    }
+
+    /**
+     * @brief Writes the indices of the boxes (center, half extents) intersecting the frustum to visible
+     * @return Number of visible boxes
+     */
+    inline size_t CullAABBs(const Frustum& frustum, ConstVector3Stream centers, ConstVector3Stream extents,
+                            std::span<uint32_t> visible) noexcept
+    {
+        using namespace simd;
+        const size_t count = centers.Size();
+        CORE_ASSERT(extents.Size() == count, "CullAABBs: extents and centers differ in size")
+        CORE_ASSERT(visible.size() >= count, "CullAABBs: output span too small")
+
+        constexpr size_t L = FloatLanes;
+        size_t visibleCount = 0;
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            const FloatN cx = LoadN(centers.x.data() + i);
+            const FloatN cy = LoadN(centers.y.data() + i);
+            const FloatN cz = LoadN(centers.z.data() + i);
+            const FloatN ex = LoadN(extents.x.data() + i);
+            const FloatN ey = LoadN(extents.y.data() + i);
+            const FloatN ez = LoadN(extents.z.data() + i);
+
+            FloatN inside = SplatN(std::bit_cast<float>(~0u));
+            for (const auto& plane : frustum.planes)
+            {
+                const float nx = plane.normal.GetX(), ny = plane.normal.GetY(), nz = plane.normal.GetZ();
+                const FloatN distance = MulAddN(SplatN(nx), cx, MulAddN(SplatN(ny), cy, MulAddN(SplatN(nz), cz, SplatN(plane.distance))));
+                const FloatN radius = MulAddN(SplatN(std::abs(nx)), ex, MulAddN(SplatN(std::abs(ny)), ey, MulN(SplatN(std::abs(nz)), ez)));
+                inside = AndN(inside, LessEqualN(SubN(SplatN(0.0f), radius), distance));
+            }
+
+            visibleCount = detail::AppendVisible(MaskBitsN(inside), static_cast<uint32_t>(i), visible.data(), visibleCount);
+        }
+
+        for (; i < count; ++i)
+        {
+            const Vector3f center{centers.x[i], centers.y[i], centers.z[i]};
+            const Vector3f extent{extents.x[i], extents.y[i], extents.z[i]};
+            visible[visibleCount] = static_cast<uint32_t>(i);
+            visibleCount += frustum.Intersects(AABB{center - extent, center + extent});
+        }
+
+        return visibleCount;
+    }
+}
@@ -0,0 +1,332 @@
+/*
+ * Project: TestProject
+ * File: Intersection.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 11:05
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <optional>
+#include <span>
+#include "AABB.hpp"
+#include "Capsule.hpp"
+#include "Plane.hpp"
+#include "Ray.hpp"
+#include "Sphere.hpp"
+#include "Triangle.hpp"
+#include "../Simd/Simd.hpp"
+
+namespace lux::math
+{
+    /**
+     * @brief Determinants below this are treated as a ray parallel to the triangle
+     */
+    inline constexpr float RayTriangleEpsilon = 1e-8f;
+
+    /**
+     * @brief Möller-Trumbore, both faces. Returns the ray parameter of the hit
+     */
+    [[nodiscard]] inline std::optional<float> Intersect(const Ray& ray, const Triangle& triangle) noexcept
+    {
+        const Vector3f e1 = triangle.b - triangle.a;
+        const Vector3f e2 = triangle.c - triangle.a;
+        const Vector3f p = Cross(ray.direction, e2);
+        const float det = e1.Dot(p);
+        if (std::abs(det) <= RayTriangleEpsilon)
+            return std::nullopt;
+
+        const float invDet = 1.0f / det;
+        const Vector3f s = ray.origin - triangle.a;
+        const float u = s.Dot(p) * invDet;
+        const Vector3f q = Cross(s, e1);
+        const float v = ray.direction.Dot(q) * invDet;
+        const float t = e2.Dot(q) * invDet;
+
+        if (u < 0.0f || v < 0.0f || u + v > 1.0f || t < 0.0f)
+            return std::nullopt;
+
+        return t;
+    }
+
+    /**
+     * @brief Slab test. Returns the ray parameter where the ray enters the box, 0 when it starts inside
+     */
+    [[nodiscard]] inline std::optional<float> Intersect(const Ray& ray, const AABB& box) noexcept
+    {
+        float tMin = 0.0f;
+        float tMax = std::numeric_limits<float>::infinity();
+
+        for (size_t axis = 0; axis < 3; ++axis)
+        {
+            const float invDir = 1.0f / ray.direction[axis];
+            const float t1 = (box.min[axis] - ray.origin[axis]) * invDir;
+            const float t2 = (box.max[axis] - ray.origin[axis]) * invDir;
+            tMin = std::max(tMin, std::min(t1, t2));
+            tMax = std::min(tMax, std::max(t1, t2));
+        }
+
+        if (tMin > tMax)
+            return std::nullopt;
+
+        return tMin;
+    }
+
+    [[nodiscard]] inline bool Intersects(const Sphere& sphere, const Plane& plane) noexcept
+    {
+        return std::abs(plane.SignedDistance(sphere.center)) <= sphere.radius;
+    }
+
+    [[nodiscard]] inline bool Intersects(const Capsule& capsule, const Sphere& sphere) noexcept
+    {
+        const Vector3f d = sphere.center - capsule.Axis().ClosestPoint(sphere.center);
+        const float r = capsule.radius + sphere.radius;
+        return d.Dot(d) <= r * r;
+    }
+
+    /*  Batched intersection tests
+     *
+     *  One query (a ray, a plane, a capsule) against a span of primitives, FloatLanes primitives
+     *  per step with the query broadcast to every lane, plus a scalar tail. The primitives stay
+     *  in their usual array-of-structs layout and are transposed on load. Results come back per
+     *  primitive: the hit distance (infinity on a miss) for rays, a 0/1 flag for overlaps. Every
+     *  function returns the number of hits.
+     *--------------------------------------------------------------------------------*/
+    namespace detail
+    {
+        template<typename Primitive>
+        [[nodiscard]] inline const float* FloatsOf(std::span<const Primitive> primitives, size_t i) noexcept
+        {
+            static_assert(sizeof(Primitive) % sizeof(float) == 0);
+            return reinterpret_cast<const float*>(primitives.data() + i);
+        }
+
+        inline size_t StoreHitFlags(uint32_t bits, uint8_t* hits) noexcept
+        {
+            for (size_t lane = 0; lane < simd::FloatLanes; ++lane)
+                hits[lane] = static_cast<uint8_t>((bits >> lane) & 1u);
+
+            return static_cast<size_t>(std::popcount(bits));
+        }
+    }
+
+    inline size_t IntersectTriangles(const Ray& ray, std::span<const Triangle> triangles, std::span<float> distances) noexcept
+    {
+        using namespace simd;
+        CORE_ASSERT(distances.size() >= triangles.size(), "IntersectTriangles: output span too small")
+
+        constexpr size_t L = FloatLanes;
+        constexpr size_t stride = sizeof(Triangle) / sizeof(float);
+        constexpr float inf = std::numeric_limits<float>::infinity();
+
+        const FloatN ox = SplatN(ray.origin.GetX()), oy = SplatN(ray.origin.GetY()), oz = SplatN(ray.origin.GetZ());
+        const FloatN dx = SplatN(ray.direction.GetX()), dy = SplatN(ray.direction.GetY()), dz = SplatN(ray.direction.GetZ());
+        const FloatN zero = SplatN(0.0f);
+        const FloatN one = SplatN(1.0f);
+        const FloatN epsilon = SplatN(RayTriangleEpsilon);
+
+        const size_t count = triangles.size();
+        size_t hits = 0;
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            const float* src = detail::FloatsOf(triangles, i);
+
+            const FloatN ax = LoadStridedN(src + 0, stride), ay = LoadStridedN(src + 1, stride), az = LoadStridedN(src + 2, stride);
+            const FloatN e1x = SubN(LoadStridedN(src + 3, stride), ax);
+            const FloatN e1y = SubN(LoadStridedN(src + 4, stride), ay);
+            const FloatN e1z = SubN(LoadStridedN(src + 5, stride), az);
+            const FloatN e2x = SubN(LoadStridedN(src + 6, stride), ax);
+            const FloatN e2y = SubN(LoadStridedN(src + 7, stride), ay);
+            const FloatN e2z = SubN(LoadStridedN(src + 8, stride), az);
+
+            // p = d x e2, det = e1 . p
+            const FloatN px = SubN(MulN(dy, e2z), MulN(dz, e2y));
+            const FloatN py = SubN(MulN(dz, e2x), MulN(dx, e2z));
+            const FloatN pz = SubN(MulN(dx, e2y), MulN(dy, e2x));
+            const FloatN det = MulAddN(e1x, px, MulAddN(e1y, py, MulN(e1z, pz)));
+            const FloatN invDet = DivN(one, det);
+
+            // s = o - a, q = s x e1
+            const FloatN sx = SubN(ox, ax), sy = SubN(oy, ay), sz = SubN(oz, az);
+            const FloatN u = MulN(MulAddN(sx, px, MulAddN(sy, py, MulN(sz, pz))), invDet);
+            const FloatN qx = SubN(MulN(sy, e1z), MulN(sz, e1y));
+            const FloatN qy = SubN(MulN(sz, e1x), MulN(sx, e1z));
+            const FloatN qz = SubN(MulN(sx, e1y), MulN(sy, e1x));
+            const FloatN v = MulN(MulAddN(dx, qx, MulAddN(dy, qy, MulN(dz, qz))), invDet);
+            const FloatN t = MulN(MulAddN(e2x, qx, MulAddN(e2y, qy, MulN(e2z, qz))), invDet);
+
+            const FloatN hit = AndN(AndN(LessN(epsilon, AbsN(det)), AndN(LessEqualN(zero, u), LessEqualN(zero, v))),
+                                    AndN(LessEqualN(AddN(u, v), one), LessEqualN(zero, t)));
+
+            StoreN(distances.data() + i, SelectN(hit, t, SplatN(inf)));
+            hits += static_cast<size_t>(std::popcount(MaskBitsN(hit)));
+        }
+
+        for (; i < count; ++i)
+        {
+            const std::optional<float> t = Intersect(ray, triangles[i]);
+            distances[i] = t.value_or(inf);
+            hits += t.has_value();
+        }
+
+        return hits;
+    }
+
+    inline size_t IntersectAABBs(const Ray& ray, std::span<const AABB> boxes, std::span<float> distances) noexcept
+    {
+        using namespace simd;
+        CORE_ASSERT(distances.size() >= boxes.size(), "IntersectAABBs: output span too small")
+
+        constexpr size_t L = FloatLanes;
+        constexpr size_t stride = sizeof(AABB) / sizeof(float);
+        constexpr float inf = std::numeric_limits<float>::infinity();
+
+        const FloatN ox = SplatN(ray.origin.GetX()), oy = SplatN(ray.origin.GetY()), oz = SplatN(ray.origin.GetZ());
+        const FloatN ix = SplatN(1.0f / ray.direction.GetX());
+        const FloatN iy = SplatN(1.0f / ray.direction.GetY());
+        const FloatN iz = SplatN(1.0f / ray.direction.GetZ());
+
+        const size_t count = boxes.size();
+        size_t hits = 0;
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            const float* src = detail::FloatsOf(boxes, i);
+
+            const FloatN t1x = MulN(SubN(LoadStridedN(src + 0, stride), ox), ix);
+            const FloatN t1y = MulN(SubN(LoadStridedN(src + 1, stride), oy), iy);
+            const FloatN t1z = MulN(SubN(LoadStridedN(src + 2, stride), oz), iz);
+            const FloatN t2x = MulN(SubN(LoadStridedN(src + 3, stride), ox), ix);
+            const FloatN t2y = MulN(SubN(LoadStridedN(src + 4, stride), oy), iy);
+            const FloatN t2z = MulN(SubN(LoadStridedN(src + 5, stride), oz), iz);
+
+            const FloatN tMin = MaxN(MaxN(MinN(t1x, t2x), MinN(t1y, t2y)), MaxN(MinN(t1z, t2z), SplatN(0.0f)));
+            const FloatN tMax = MinN(MinN(MaxN(t1x, t2x), MaxN(t1y, t2y)), MaxN(t1z, t2z));
+            const FloatN hit = LessEqualN(tMin, tMax);
+
+            StoreN(distances.data() + i, SelectN(hit, tMin, SplatN(inf)));
+            hits += static_cast<size_t>(std::popcount(MaskBitsN(hit)));
+        }
+
+        for (; i < count; ++i)
+        {
+            const std::optional<float> t = Intersect(ray, boxes[i]);
+            distances[i] = t.value_or(inf);
+            hits += t.has_value();
+        }
+
+        return hits;
+    }
+
+    /**
+     * @brief hits[i] = Intersects(spheres[i], plane)
+     */
+    inline size_t IntersectSpheres(const Plane& plane, std::span<const Sphere> spheres, std::span<uint8_t> hits) noexcept
+    {
+        using namespace simd;
+        CORE_ASSERT(hits.size() >= spheres.size(), "IntersectSpheres: output span too small")
+
+        constexpr size_t L = FloatLanes;
+        const FloatN nx = SplatN(plane.normal.GetX()), ny = SplatN(plane.normal.GetY()), nz = SplatN(plane.normal.GetZ());
+        const FloatN d = SplatN(plane.distance);
+
+        const size_t count = spheres.size();
+        size_t hitCount = 0;
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            FloatN cx, cy, cz, r;
+            LoadLaneQuadsN(detail::FloatsOf(spheres, i), 4, cx, cy, cz, r);
+
+            const FloatN distance = MulAddN(nx, cx, MulAddN(ny, cy, MulAddN(nz, cz, d)));
+            hitCount += detail::StoreHitFlags(MaskBitsN(LessEqualN(AbsN(distance), r)), hits.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            hits[i] = Intersects(spheres[i], plane);
+            hitCount += hits[i];
+        }
+
+        return hitCount;
+    }
+
+    /**
+     * @brief hits[i] = Intersects(capsule, spheres[i])
+     */
+    inline size_t IntersectSpheres(const Capsule& capsule, std::span<const Sphere> spheres, std::span<uint8_t> hits) noexcept
+    {
+        using namespace simd;
+        CORE_ASSERT(hits.size() >= spheres.size(), "IntersectSpheres: output span too small")
+
+        constexpr size_t L = FloatLanes;
+        const Vector3f axis = capsule.end - capsule.start;
+        const float lengthSq = axis.Dot(axis);
+
+        const FloatN sx = SplatN(capsule.start.GetX()), sy = SplatN(capsule.start.GetY()), sz = SplatN(capsule.start.GetZ());
+        const FloatN ax = SplatN(axis.GetX()), ay = SplatN(axis.GetY()), az = SplatN(axis.GetZ());
+        const FloatN invLengthSq = SplatN(lengthSq > 0.0f ? 1.0f / lengthSq : 0.0f);
+        const FloatN radius = SplatN(capsule.radius);
+        const FloatN zero = SplatN(0.0f);
+        const FloatN one = SplatN(1.0f);
+
+        const size_t count = spheres.size();
+        size_t hitCount = 0;
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            FloatN cx, cy, cz, r;
+            LoadLaneQuadsN(detail::FloatsOf(spheres, i), 4, cx, cy, cz, r);
+
+            // Closest point on the axis: start + axis * clamp(dot(c - start, axis) / |axis|^2, 0, 1)
+            const FloatN rx = SubN(cx, sx), ry = SubN(cy, sy), rz = SubN(cz, sz);
+            const FloatN t = MinN(MaxN(MulN(MulAddN(rx, ax, MulAddN(ry, ay, MulN(rz, az))), invLengthSq), zero), one);
+
+            const FloatN qx = SubN(rx, MulN(ax, t)), qy = SubN(ry, MulN(ay, t)), qz = SubN(rz, MulN(az, t));
+            const FloatN distanceSq = MulAddN(qx, qx, MulAddN(qy, qy, MulN(qz, qz)));
+            const FloatN reach = AddN(r, radius);
+
+            hitCount += detail::StoreHitFlags(MaskBitsN(LessEqualN(distanceSq, MulN(reach, reach))), hits.data() + i);
+        }
+
+        for (; i < count; ++i)
+        {
+            hits[i] = Intersects(capsule, spheres[i]);
+            hitCount += hits[i];
+        }
+
+        return hitCount;
+    }
+}
@@ -28,4 +28,36 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#pragma once
\ No newline at end of file
+#pragma once
+#include <algorithm>
+#include "../Vector.hpp"
+
+namespace lux::math
+{
+    /**
+     * @brief Line segment from start to end
+     */
+    struct Line
+    {
+        Vector3f start;
+        Vector3f end;
+
+        [[nodiscard]] Vector3f Direction() const noexcept { return end - start; }
+
+        [[nodiscard]] float Length() const noexcept { return Direction().Length(); }
+
+        /**
+         * @brief Point of the segment closest to point
+         */
+        [[nodiscard]] Vector3f ClosestPoint(const Vector3f& point) const noexcept
+        {
+            const Vector3f d = Direction();
+            const float lengthSq = d.Dot(d);
+            if (lengthSq == 0.0f)
+                return start;
+
+            const float t = std::clamp((point - start).Dot(d) / lengthSq, 0.0f, 1.0f);
+            return start + d * t;
+        }
+    };
+}
@@ -28,4 +28,45 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#pragma once
\ No newline at end of file
+#pragma once
+#include "../Vector.hpp"
+
+namespace lux::math
+{
+    /**
+     * @brief Plane of the points p with Dot(normal, p) + distance == 0
+     *
+     * The normal points to the positive half space. Distances are in world units only when the
+     * normal has unit length, see Normalize().
+     */
+    struct Plane
+    {
+        Vector3f normal {0.0f, 1.0f, 0.0f};
+        float distance = 0.0f;
+
+        [[nodiscard]] static Plane FromPointNormal(const Vector3f& point, const Vector3f& normal) noexcept
+        {
+            Vector3f n = Vector3f{normal}.Normalize();
+            return {n, -n.Dot(point)};
+        }
+
+        /**
+         * @brief Plane through three points, the normal follows the counter-clockwise winding a, b, c
+         */
+        [[nodiscard]] static Plane FromPoints(const Vector3f& a, const Vector3f& b, const Vector3f& c) noexcept
+        {
+            return FromPointNormal(a, Cross(b - a, c - a));
+        }
+
+        [[nodiscard]] float SignedDistance(const Vector3f& point) const noexcept
+        {
+            return normal.Dot(point) + distance;
+        }
+
+        [[nodiscard]] Plane Normalize() const noexcept
+        {
+            const float invLength = 1.0f / normal.Length();
+            return {normal * invLength, distance * invLength};
+        }
+    };
+}
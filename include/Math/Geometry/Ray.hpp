@@ -28,4 +28,22 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#pragma once
\ No newline at end of file
+#pragma once
+#include "../Vector.hpp"
+
+namespace lux::math
+{
+    /**
+     * @brief Half line origin + t * direction, t >= 0. The direction does not need to be normalized
+     */
+    struct Ray
+    {
+        Vector3f origin;
+        Vector3f direction {0.0f, 0.0f, -1.0f};
+
+        [[nodiscard]] Vector3f At(float t) const noexcept
+        {
+            return origin + direction * t;
+        }
+    };
+}
@@ -28,4 +28,27 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#pragma once
\ No newline at end of file
+#pragma once
+#include "../Vector.hpp"
+
+namespace lux::math
+{
+    struct Sphere
+    {
+        Vector3f center;
+        float radius = 0.0f;
+
+        [[nodiscard]] bool Contains(const Vector3f& point) const noexcept
+        {
+            const Vector3f d = point - center;
+            return d.Dot(d) <= radius * radius;
+        }
+
+        [[nodiscard]] bool Intersects(const Sphere& other) const noexcept
+        {
+            const Vector3f d = other.center - center;
+            const float r = radius + other.radius;
+            return d.Dot(d) <= r * r;
+        }
+    };
+}
@@ -28,4 +28,305 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#pragma once
\ No newline at end of file
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <span>
+#include <vector>
+#include "../BatchTransform.hpp"
+#include "../Simd/Simd.hpp"
+
+/*  Cubic splines
+ *
+ *  Catmull-Rom, cubic Bezier and uniform B-spline curves share one representation: each
+ *  segment is turned into the power basis a u^3 + b u^2 + c u + d once at construction,
+ *  so evaluation does not depend on the curve type. The parameter t in [0, 1] runs over
+ *  the whole curve, one 1 / SegmentCount() step per segment.
+ *
+ *  An arc-length table sampled per segment maps distances along the curve back to the
+ *  parameter with a binary search, which gives constant speed motion through
+ *  EvaluateAtDistance(). Nothing allocates after construction.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math
+{
+    enum class SplineType : uint8_t
+    {
+        CATMULL_ROM = 0,   // Passes through every control point but the first and the last
+        BEZIER = 1,        // 3n + 1 points, passes through every third one
+        B_SPLINE = 2       // Uniform cubic B-spline, C2 continuous, passes through none
+    };
+
+    class Spline
+    {
+    public:
+        static constexpr size_t DefaultSamplesPerSegment = 16;
+
+        Spline(SplineType type, std::span<const Vector3f> controlPoints, size_t samplesPerSegment = DefaultSamplesPerSegment) :
+            m_type{type}, m_samplesPerSegment{std::max<size_t>(samplesPerSegment, 1)}
+        {
+            const size_t step = type == SplineType::BEZIER ? 3 : 1;
+            CORE_ASSERT(controlPoints.size() >= 4, "Spline: a cubic segment needs four control points")
+            CORE_ASSERT(type != SplineType::BEZIER || controlPoints.size() % 3 == 1, "Spline: a Bezier spline needs 3n + 1 control points")
+
+            m_segmentCount = (controlPoints.size() - 4) / step + 1;
+            m_coefficients.resize(12 * m_segmentCount);
+
+            const auto& basis = Basis(type);
+            for (size_t segment = 0; segment < m_segmentCount; ++segment)
+            {
+                const Vector3f* p = controlPoints.data() + segment * step;
+                for (size_t axis = 0; axis < 3; ++axis)
+                    for (size_t power = 0; power < 4; ++power)
+                        m_coefficients[(axis * 4 + power) * m_segmentCount + segment] =
+                            basis[power][0] * p[0][axis] + basis[power][1] * p[1][axis] +
+                            basis[power][2] * p[2][axis] + basis[power][3] * p[3][axis];
+            }
+
+            BuildArcLengthTable();
+        }
+
+        [[nodiscard]] SplineType GetType() const noexcept { return m_type; }
+        [[nodiscard]] size_t SegmentCount() const noexcept { return m_segmentCount; }
+        [[nodiscard]] float Length() const noexcept { return m_arcLengths.back(); }
+
+        [[nodiscard]] Vector3f Evaluate(float t) const noexcept
+        {
+            const auto [segment, u] = Locate(t * static_cast<float>(m_segmentCount));
+            return EvaluateSegment(segment, u);
+        }
+
+        /**
+         * @brief First derivative with respect to t
+         */
+        [[nodiscard]] Vector3f Tangent(float t) const noexcept
+        {
+            const auto [segment, u] = Locate(t * static_cast<float>(m_segmentCount));
+            float result[3];
+            for (size_t axis = 0; axis < 3; ++axis)
+            {
+                const float a = Coefficient(axis, 0, segment), b = Coefficient(axis, 1, segment), c = Coefficient(axis, 2, segment);
+                result[axis] = ((3.0f * a * u + 2.0f * b) * u + c) * static_cast<float>(m_segmentCount);
+            }
+
+            return {result[0], result[1], result[2]};
+        }
+
+        /**
+         * @brief Parameter t of the point distance units along the curve, clamped to [0, Length()]
+         */
+        [[nodiscard]] float ParameterAtDistance(float distance) const noexcept
+        {
+            const size_t sample = FindSample(distance);
+            return (static_cast<float>(sample) + SampleFraction(sample, distance)) /
+                   static_cast<float>(m_samplesPerSegment * m_segmentCount);
+        }
+
+        [[nodiscard]] Vector3f EvaluateAtDistance(float distance) const noexcept
+        {
+            return Evaluate(ParameterAtDistance(distance));
+        }
+
+        /**
+         * @brief out[i] = Evaluate(t[i])
+         */
+        void Evaluate(std::span<const float> t, Vector3Stream out) const noexcept
+        {
+            CORE_ASSERT(out.Size() >= t.size(), "Spline::Evaluate: output stream too small")
+            EvaluateBatch<false>(t, out);
+        }
+
+        /**
+         * @brief out[i] = EvaluateAtDistance(distances[i])
+         */
+        void EvaluateAtDistance(std::span<const float> distances, Vector3Stream out) const noexcept
+        {
+            CORE_ASSERT(out.Size() >= distances.size(), "Spline::EvaluateAtDistance: output stream too small")
+            EvaluateBatch<true>(distances, out);
+        }
+
+    private:
+        using BasisMatrix = std::array<std::array<float, 4>, 4>;
+
+        SplineType m_type;
+        size_t m_segmentCount = 0;
+        size_t m_samplesPerSegment;
+        std::vector<float> m_coefficients;   // [axis][power][segment], power 0 is the u^3 term
+        std::vector<float> m_arcLengths;     // Distance at the samples u = k / m_samplesPerSegment
+
+        /**
+         * @brief Rows give the u^3, u^2, u and constant terms as weights of the four control points
+         */
+        static const BasisMatrix& Basis(SplineType type) noexcept
+        {
+            static constexpr BasisMatrix catmullRom
+            {{
+                { -0.5f,  1.5f, -1.5f,  0.5f },
+                {  1.0f, -2.5f,  2.0f, -0.5f },
+                { -0.5f,  0.0f,  0.5f,  0.0f },
+                {  0.0f,  1.0f,  0.0f,  0.0f }
+            }};
+
+            static constexpr BasisMatrix bezier
+            {{
+                { -1.0f,  3.0f, -3.0f,  1.0f },
+                {  3.0f, -6.0f,  3.0f,  0.0f },
+                { -3.0f,  3.0f,  0.0f,  0.0f },
+                {  1.0f,  0.0f,  0.0f,  0.0f }
+            }};
+
+            static constexpr BasisMatrix bSpline
+            {{
+                { -1.0f / 6.0f,  3.0f / 6.0f, -3.0f / 6.0f, 1.0f / 6.0f },
+                {  3.0f / 6.0f, -6.0f / 6.0f,  3.0f / 6.0f, 0.0f },
+                { -3.0f / 6.0f,  0.0f,         3.0f / 6.0f, 0.0f },
+                {  1.0f / 6.0f,  4.0f / 6.0f,  1.0f / 6.0f, 0.0f }
+            }};
+
+            switch (type)
+            {
+                case SplineType::BEZIER: return bezier;
+                case SplineType::B_SPLINE: return bSpline;
+                default: return catmullRom;
+            }
+        }
+
+        [[nodiscard]] float Coefficient(size_t axis, size_t power, size_t segment) const noexcept
+        {
+            return m_coefficients[(axis * 4 + power) * m_segmentCount + segment];
+        }
+
+        /**
+         * @brief Splits a parameter in segment units into the segment index and the local u in [0, 1]
+         */
+        [[nodiscard]] std::pair<size_t, float> Locate(float parameter) const noexcept
+        {
+            parameter = std::clamp(parameter, 0.0f, static_cast<float>(m_segmentCount));
+            const size_t segment = std::min(static_cast<size_t>(parameter), m_segmentCount - 1);
+            return {segment, parameter - static_cast<float>(segment)};
+        }
+
+        [[nodiscard]] Vector3f EvaluateSegment(size_t segment, float u) const noexcept
+        {
+            float result[3];
+            for (size_t axis = 0; axis < 3; ++axis)
+                result[axis] = ((Coefficient(axis, 0, segment) * u + Coefficient(axis, 1, segment)) * u +
+                                Coefficient(axis, 2, segment)) * u + Coefficient(axis, 3, segment);
+
+            return {result[0], result[1], result[2]};
+        }
+
+        /**
+         * @brief Index of the last sample at or before distance, at most the second to last one
+         */
+        [[nodiscard]] size_t FindSample(float distance) const noexcept
+        {
+            // Branchless binary search: the compare selects the half with a conditional move, so
+            // random distances do not pay a mispredicted branch per step
+            const float* base = m_arcLengths.data();
+            size_t length = m_arcLengths.size() - 1;
+            while (length > 1)
+            {
+                const size_t half = length / 2;
+                base = base[half] <= distance ? base + half : base;
+                length -= half;
+            }
+
+            return static_cast<size_t>(base - m_arcLengths.data());
+        }
+
+        [[nodiscard]] float SampleFraction(size_t sample, float distance) const noexcept
+        {
+            const float span = m_arcLengths[sample + 1] - m_arcLengths[sample];
+            return span > 0.0f ? std::clamp((distance - m_arcLengths[sample]) / span, 0.0f, 1.0f) : 0.0f;
+        }
+
+        void BuildArcLengthTable()
+        {
+            const size_t samples = m_segmentCount * m_samplesPerSegment;
+            m_arcLengths.resize(samples + 1);
+            m_arcLengths[0] = 0.0f;
+
+            const float step = 1.0f / static_cast<float>(m_samplesPerSegment);
+            Vector3f previous = EvaluateSegment(0, 0.0f);
+            for (size_t k = 1; k <= samples; ++k)
+            {
+                const size_t segment = std::min((k - 1) / m_samplesPerSegment, m_segmentCount - 1);
+                const float u = static_cast<float>(k - segment * m_samplesPerSegment) * step;
+                const Vector3f current = EvaluateSegment(segment, u);
+
+                m_arcLengths[k] = m_arcLengths[k - 1] + (current - previous).Length();
+                previous = current;
+            }
+        }
+
+        /**
+         * @brief Turns each lane's input into a parameter in segment units, then gathers the segment coefficients
+         * and evaluates all lanes at once
+         */
+        template<bool ByDistance>
+        void EvaluateBatch(std::span<const float> input, Vector3Stream out) const noexcept
+        {
+            using namespace simd;
+            constexpr size_t L = FloatLanes;
+            const size_t count = input.size();
+            const FloatN segments = SplatN(static_cast<float>(m_segmentCount));
+            const FloatN lastSegment = SplatN(static_cast<float>(m_segmentCount - 1));
+            const float invSamples = 1.0f / static_cast<float>(m_samplesPerSegment);
+
+            alignas(32) uint32_t sampleIndex[L];
+            alignas(32) uint32_t segmentIndex[L];
+
+            size_t i = 0;
+            for (; i + L <= count; i += L)
+            {
+                FloatN parameter;
+                if constexpr (ByDistance)
+                {
+                    // FindSample for all lanes at once, sample indices stay exact as floats
+                    const FloatN distance = LoadN(input.data() + i);
+                    FloatN sample = SplatN(0.0f);
+                    for (size_t length = m_arcLengths.size() - 1; length > 1; length -= length / 2)
+                    {
+                        const FloatN probe = AddN(sample, SplatN(static_cast<float>(length / 2)));
+                        StoreIndicesN(sampleIndex, probe);
+                        sample = SelectN(LessEqualN(GatherN(m_arcLengths.data(), sampleIndex), distance), probe, sample);
+                    }
+
+                    StoreIndicesN(sampleIndex, sample);
+                    const FloatN start = GatherN(m_arcLengths.data(), sampleIndex);
+                    const FloatN span = SubN(GatherN(m_arcLengths.data() + 1, sampleIndex), start);
+                    FloatN fraction = MinN(MaxN(DivN(SubN(distance, start), span), SplatN(0.0f)), SplatN(1.0f));
+                    fraction = SelectN(LessN(SplatN(0.0f), span), fraction, SplatN(0.0f));
+                    parameter = MulN(AddN(sample, fraction), SplatN(invSamples));
+                }
+                else
+                    parameter = MinN(MaxN(MulN(LoadN(input.data() + i), segments), SplatN(0.0f)), segments);
+
+                const FloatN segmentStart = MinN(FloorN(parameter), lastSegment);
+                StoreIndicesN(segmentIndex, segmentStart);
+                const FloatN u = SubN(parameter, segmentStart);
+
+                float* outputs[3] = {out.x.data() + i, out.y.data() + i, out.z.data() + i};
+                for (size_t axis = 0; axis < 3; ++axis)
+                {
+                    const float* base = m_coefficients.data() + axis * 4 * m_segmentCount;
+                    FloatN result = GatherN(base, segmentIndex);
+                    result = MulAddN(result, u, GatherN(base + m_segmentCount, segmentIndex));
+                    result = MulAddN(result, u, GatherN(base + 2 * m_segmentCount, segmentIndex));
+                    result = MulAddN(result, u, GatherN(base + 3 * m_segmentCount, segmentIndex));
+                    StoreN(outputs[axis], result);
+                }
+            }
+
+            for (; i < count; ++i)
+            {
+                const Vector3f point = ByDistance ? EvaluateAtDistance(input[i]) : Evaluate(input[i]);
+                out.x[i] = point.GetX();
+                out.y[i] = point.GetY();
+                out.z[i] = point.GetZ();
+            }
+        }
+    };
+}
@@ -28,4 +28,27 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#pragma once
\ No newline at end of file
+#pragma once
+#include "../Vector.hpp"
+
+namespace lux::math
+{
+    /**
+     * @brief Triangle a, b, c; the front face is the counter-clockwise one, as in OpenGL
+     */
+    struct Triangle
+    {
+        Vector3f a;
+        Vector3f b;
+        Vector3f c;
+
+        /**
+         * @brief Unnormalized face normal, its length is twice the area
+         */
+        [[nodiscard]] Vector3f Normal() const noexcept { return Cross(b - a, c - a); }
+
+        [[nodiscard]] float Area() const noexcept { return Normal().Length() * 0.5f; }
+
+        [[nodiscard]] Vector3f Centroid() const noexcept { return (a + b + c) * (1.0f / 3.0f); }
+    };
+}
@@ -0,0 +1,127 @@
+/*
+ * Project: TestProject
+ * File: Half.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 09:40
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <bit>
+#include <cstdint>
+#include <span>
+#include "Simd/Simd.hpp"
+#include "../Application/Assertion.hpp"
+
+#if !defined(LUX_SIMD_SCALAR) && (defined(__F16C__) || (defined(_MSC_VER) && defined(__AVX2__)))
+    #define LUX_MATH_F16C
+#endif
+
+/*  Half precision floats
+ *
+ *  IEEE 754 binary16 stored as uint16_t. Conversions from float round to nearest even,
+ *  overflow to infinity, keep subnormals and turn NaNs into quiet NaNs, so the scalar and
+ *  the F16C paths give bit identical results. Every half converts to float exactly.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math
+{
+    [[nodiscard]] constexpr uint16_t FloatToHalf(float value) noexcept
+    {
+        uint32_t f = std::bit_cast<uint32_t>(value);
+        const uint32_t sign = (f >> 16) & 0x8000u;
+        f &= 0x7FFFFFFFu;
+
+        // at least 2^16: infinity, or NaN with the quiet bit set
+        if (f >= 0x47800000u)
+            return static_cast<uint16_t>(sign | (f > 0x7F800000u ? 0x7E00u : 0x7C00u));
+
+        // below 2^-14 the result is subnormal: adding 0.5 lines the half mantissa up with the float one
+        if (f < 0x38800000u)
+        {
+            const float aligned = std::bit_cast<float>(f) + 0.5f;
+            return static_cast<uint16_t>(sign | (std::bit_cast<uint32_t>(aligned) - 0x3F000000u));
+        }
+
+        // rebias the exponent from 127 to 15 and round to nearest even, a carry moves into the exponent
+        const uint32_t odd = (f >> 13) & 1u;
+        f += 0xC8000FFFu + odd;
+        return static_cast<uint16_t>(sign | (f >> 13));
+    }
+
+    [[nodiscard]] constexpr float HalfToFloat(uint16_t half) noexcept
+    {
+        const uint32_t sign = static_cast<uint32_t>(half & 0x8000u) << 16;
+        const uint32_t bits = half & 0x7FFFu;
+
+        if (bits >= 0x7C00u)
+            return std::bit_cast<float>(sign | 0x7F800000u | ((bits & 0x3FFu) << 13));
+
+        if (bits < 0x0400u)
+        {
+            const float magnitude = static_cast<float>(bits) * 0x1p-24f;
+            return sign ? -magnitude : magnitude;
+        }
+
+        return std::bit_cast<float>(sign | ((bits << 13) + 0x38000000u));
+    }
+
+    /**
+     * @brief Converts in[i] to half precision into out[i], with F16C when the target has it
+     */
+    inline void FloatToHalf(std::span<const float> in, std::span<uint16_t> out) noexcept
+    {
+        CORE_ASSERT(out.size() >= in.size(), "Output span is smaller than the input")
+
+        size_t i = 0;
+#if defined(LUX_MATH_F16C)
+        for (; i + 8 <= in.size(); i += 8)
+        {
+            const __m128i halves = _mm256_cvtps_ph(_mm256_loadu_ps(in.data() + i), _MM_FROUND_TO_NEAREST_INT);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out.data() + i), halves);
+        }
+#endif
+        for (; i < in.size(); ++i)
+            out[i] = FloatToHalf(in[i]);
+    }
+
+    /**
+     * @brief Converts the halves in[i] to float into out[i], with F16C when the target has it
+     */
+    inline void HalfToFloat(std::span<const uint16_t> in, std::span<float> out) noexcept
+    {
+        CORE_ASSERT(out.size() >= in.size(), "Output span is smaller than the input")
+
+        size_t i = 0;
+#if defined(LUX_MATH_F16C)
+        for (; i + 8 <= in.size(); i += 8)
+        {
+            const __m128i halves = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in.data() + i));
+            _mm256_storeu_ps(out.data() + i, _mm256_cvtph_ps(halves));
+        }
+#endif
+        for (; i < in.size(); ++i)
+            out[i] = HalfToFloat(in[i]);
+    }
+}
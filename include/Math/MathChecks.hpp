@@ -0,0 +1,55 @@
+/*
+ * Project: TestProject
+ * File: MathChecks.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 10:25
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+
+/*  Access checking policy
+ *
+ *  LUX_MATH_CHECKS selects what the index based accessors of the vector and matrix types
+ *  (operator[], At, GetRow, GetCol) do with an index out of range:
+ *
+ *      0   nothing, the access is a plain array read the optimizer can fold into the caller
+ *      1   throw std::out_of_range (Vector3 also logs the index through CORE_ERROR)
+ *
+ *  Left undefined it follows NDEBUG, so debug builds check and release builds do not.
+ *  CMake forwards the LUX_MATH_CHECKS cache variable when it is set.
+ *--------------------------------------------------------------------------------*/
+#if !defined(LUX_MATH_CHECKS)
+    #if defined(NDEBUG)
+        #define LUX_MATH_CHECKS 0
+    #else
+        #define LUX_MATH_CHECKS 1
+    #endif
+#endif
+
+namespace lux::math
+{
+    inline constexpr bool CheckedAccess = LUX_MATH_CHECKS != 0;
+}
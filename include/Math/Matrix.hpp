@@ -30,6 +30,7 @@
  */
 #pragma once
 #include "Matrix3.hpp"
+#include "PackedMatrix4.hpp"
 
 namespace lux::math
 {
@@ -54,23 +55,16 @@ namespace lux::math
 
     inline const Matrix4d Identity4d = Matrix4d::Identity();
 
-    static constexpr std::vector<float> MatricesAsFloatVector(const std::vector<Matrix4f>& matrices)
+    /**
+     * @brief Flattens matrices into column-major floats, sixteen per matrix
+     * @note Prefer PackMatrices, whose output can be uploaded without the extra copy
+     */
+    inline std::vector<float> MatricesAsFloatVector(const std::vector<Matrix4f>& matrices)
     {
-        std::vector<float> matrixData;
-        matrixData.reserve(matrices.size() * 16);
+        std::vector<float> matrixData(matrices.size() * 16);
         for (size_t i = 0; i < matrices.size(); ++i)
-        {
-            const auto& matrix = matrices[i];
-            for (int col = 0; col < 4; ++col)
-            {
-                const auto& column = matrix.GetCol(col);
-                matrixData.push_back(column.GetX());
-                matrixData.push_back(column.GetY());
-                matrixData.push_back(column.GetZ());
-                matrixData.push_back(column.GetW());
-            }
-        }
+            simd::Mat4Transpose(matrices[i].Data(), matrixData.data() + i * 16);
 
         return matrixData;
     }
-}
\ No newline at end of file
+}
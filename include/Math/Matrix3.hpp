@@ -133,7 +133,7 @@ namespace lux::math
 
         [[nodiscard]] constexpr const Vector3 <T> &operator[](size_t index) const
         {
-            if (index >= N)
+            if (CheckedAccess && index >= N)
                 throw std::out_of_range("Index out of range in matrix access");
 
             return m_data[index];
@@ -186,7 +186,7 @@ namespace lux::math
 
         [[nodiscard]] constexpr Vector3<T>& GetRow(unsigned int index) const
         {
-            if (index >= N)
+            if (CheckedAccess && index >= N)
                 throw std::out_of_range("Index out of range in matrix access");
 
             return m_data[index];
@@ -194,7 +194,7 @@ namespace lux::math
 
         [[nodiscard]] constexpr Vector3<T> GetCol(unsigned int index) const
         {
-            if (index >= N)
+            if (CheckedAccess && index >= N)
                 throw std::out_of_range("Index out of range in matrix access");
 
             return Vector3<T>{ m_data[0][index], m_data[1][index], m_data[2][index] };
@@ -29,8 +29,11 @@
  * SOFTWARE.
  */
 #pragma once
+#include <algorithm>
+#include <type_traits>
 #include "Vector.hpp"
 #include "MathUtils.hpp"
+#include "Simd/Matrix4Kernels.hpp"
 
 namespace lux::math
 {
@@ -40,11 +43,31 @@ namespace lux::math
         COLUMN_MAJOR
     };
 
+    /**
+     * @brief What is known about a matrix, used to pick the cheapest inverse
+     *
+     * AFFINE means the last row or the last column is (0, 0, 0, 1), RIGID additionally that the
+     * remaining 3x3 block is a rotation. The factories tag their results and anything else starts
+     * out GENERAL. A product keeps the weaker tag of its operands only if their translations sit
+     * in the same layout (a factor without translation fits either), mixing the two layouts
+     * gives a matrix that is affine in neither, so the product is tagged GENERAL.
+     */
+    enum class MatShape : uint8_t
+    {
+        GENERAL,
+        AFFINE,
+        RIGID
+    };
+
     /**
      * @brief 4x4 matrix class for 3D transformations
      * 
      * This class represents a 4x4 matrix used for 3D transformations such as
      * translation, rotation, scaling, and perspective projection.
+     * The determinant is not stored: Determinant() computes it when asked for, so
+     * temporaries cost only their sixteen elements and the type stays trivially copyable.
+     * A MatShape tag rides along in the padding next to the order so Inverse() can take the
+     * affine or rigid fast path on its own.
      * 
      * @tparam T The type of matrix elements (must be arithmetic)
      */
@@ -56,7 +79,6 @@ namespace lux::math
         Matrix4() : m_order(MatOrder::COLUMN_MAJOR)
         {
             SetIdentity();
-            det = 1.0f;
         }
 
         explicit Matrix4(T value, MatOrder order = MatOrder::COLUMN_MAJOR) : m_order{order}
@@ -67,8 +89,6 @@ namespace lux::math
             else
                 for (auto& row : m_data)
                     row = Vector4<T>(value);
-
-            det = Determinant();
         }
 
         Matrix4(const Vector4<T>& c0,
@@ -89,8 +109,6 @@ namespace lux::math
                     Vector4<T>(c0.w, c1.w, c2.w, c3.w)
                 };
             }
-
-            det = Determinant();
         }
 
 
@@ -116,8 +134,6 @@ namespace lux::math
                      Vector4<T> {m3, m7, m11, m15},
                      Vector4<T> {m4, m8, m12, m16}
                 };
-
-            det = Determinant();
         }
 
         explicit Matrix4(const NonOwnPtr<T> values, MatOrder order = MatOrder::COLUMN_MAJOR) : m_order(order)
@@ -130,17 +146,26 @@ namespace lux::math
                 for (size_t row = 0; row < 4; ++row)
                     for (size_t col = 0; col < 4; ++col)
                         m_data[row][col] = values[row * 4 + col];
-
-            det = Determinant();
         }
 
 
         explicit Matrix4(const std::array<T,16>& values,
-                         MatOrder order = MatOrder::COLUMN_MAJOR) : Matrix4{values.data(), order, Determinant()} {}
+                         MatOrder order = MatOrder::COLUMN_MAJOR) : Matrix4{values.data(), order} {}
 
-        constexpr Matrix4(const Matrix4 &m) noexcept: m_data {m.m_data}, m_order {m.m_order}, det {m.det} {}
+        constexpr Matrix4(const Matrix4 &m) noexcept = default;
 
-        constexpr Matrix4(Matrix4 &&m) noexcept: m_data {std::move(m.m_data)}, m_order {std::move(m.m_order)}, det {std::move(m.det)}  {}
+        constexpr Matrix4(Matrix4 &&m) noexcept = default;
+
+        /**
+         * @brief Copies sixteen values laid out like Data() (rows of the stored matrix) and tags the result
+         */
+        [[nodiscard]] static Matrix4 FromData(const T* data, MatShape shape = MatShape::GENERAL) noexcept
+        {
+            Matrix4 result {Uninitialized {}, shape};
+            for (size_t row = 0; row < 4; ++row, data += 4)
+                result.m_data[row] = Vector4<T>{data[0], data[1], data[2], data[3]};
+            return result;
+        }
 
         static constexpr Matrix4 Identity() noexcept
         {
@@ -151,44 +176,34 @@ namespace lux::math
                 0, 0, 1, 0,
                 0, 0, 0, 1,
                 MatOrder::COLUMN_MAJOR
-            };
+            }.WithShape(MatShape::RIGID);
         }
 
-        constexpr Matrix4 &operator=(const Matrix4& other) noexcept
-        {
-            if (this != &other)
-                m_data = other.m_data;
-
-            return *this;
-        }
+        constexpr Matrix4 &operator=(const Matrix4& other) noexcept = default;
 
-        constexpr Matrix4 &operator=(const Matrix4&& other) noexcept
-        {
-            if (this != &other)
-                m_data = std::move(other.m_data);
-
-            return *this;
-        }
+        constexpr Matrix4 &operator=(Matrix4&& other) noexcept = default;
 
         [[nodiscard]] constexpr const Vector4<T>& operator[](size_t index) const
         {
-            if (index >= N)
+            if (CheckedAccess && index >= N)
                 throw std::out_of_range("Index out of range in matrix access");
 
             return m_data[index];
         }
 
+        // Writable access may change any element, so the shape tag is dropped
         [[nodiscard]] constexpr Vector4<T>& operator[](size_t index)
         {
-            if (index >= N)
+            if (CheckedAccess && index >= N)
                 throw std::out_of_range("Index out of range in matrix access");
 
+            m_shape = MatShape::GENERAL;
             return m_data[index];
         }
 
         [[nodiscard]] constexpr T At(size_t row, size_t col) const
         {
-            if (row >= N || col >= N)
+            if (CheckedAccess && (row >= N || col >= N))
                 throw std::out_of_range("Index out of range in matrix access");
 
             return m_data[row][col];
@@ -200,8 +215,72 @@ namespace lux::math
         }
 
 
+        /**
+         * @brief Inverse of the matrix, through InverseRigid() or InverseAffine() when the shape tag allows it
+         * @throws std::runtime_error if the matrix is singular
+         */
         [[nodiscard]] constexpr Matrix4 Inverse() const
         {
+            switch (m_shape)
+            {
+                case MatShape::RIGID: return InverseRigid();
+                case MatShape::AFFINE: return InverseAffine();
+                default: return InverseGeneral();
+            }
+        }
+
+        /**
+         * @brief Inverse of an affine matrix: invert the 3x3 block, then map the translation through it
+         *
+         * Works on either layout (translation in the last column or in the last row); a matrix
+         * that is in neither falls back to the full inverse.
+         * @throws std::runtime_error if the 3x3 block is singular
+         */
+        [[nodiscard]] constexpr Matrix4 InverseAffine() const
+        {
+            return InverseAffine(m_shape == MatShape::RIGID ? MatShape::RIGID : MatShape::AFFINE);
+        }
+
+        /**
+         * @brief Inverse of a rotation plus translation: transpose the rotation, negate the rotated translation
+         *
+         * The caller guarantees the 3x3 block is orthonormal (scale would be silently dropped);
+         * a matrix that is not affine in either layout falls back to the full inverse.
+         */
+        [[nodiscard]] constexpr Matrix4 InverseRigid() const
+        {
+            return InverseAffine(MatShape::RIGID);
+        }
+
+        [[nodiscard]] constexpr MatShape GetShape() const noexcept { return m_shape; }
+
+        /**
+         * @brief Tags the matrix; the tag is a promise, a wrong one makes Inverse() return garbage
+         */
+        constexpr void SetShape(MatShape shape) noexcept { m_shape = shape; }
+
+        [[nodiscard]] constexpr Matrix4 WithShape(MatShape shape) const noexcept
+        {
+            Matrix4 result = *this;
+            result.m_shape = shape;
+            return result;
+        }
+
+    private:
+        [[nodiscard]] constexpr Matrix4 InverseGeneral() const
+        {
+            if constexpr (std::is_same_v<T, float>)
+                if (!std::is_constant_evaluated())
+                {
+                    Matrix4 result {Uninitialized {}};
+                    float det = simd::Mat4Inverse(Data(), result.MutableData());
+                    if (std::abs(det) <= EPSILON)
+                        throw std::runtime_error("Matrix is singular");
+
+                    return result;
+                }
+
+            T det = Determinant();
             if (abs(det) <= EPSILON)
                 throw std::runtime_error("Matrix is singular");
 
@@ -228,12 +307,114 @@ namespace lux::math
             return result;
         }
 
+        [[nodiscard]] constexpr bool IsLastRowIdentity() const noexcept
+        {
+            return m_data[3][0] == 0 && m_data[3][1] == 0 && m_data[3][2] == 0 && m_data[3][3] == 1;
+        }
+
+        [[nodiscard]] constexpr bool IsLastColIdentity() const noexcept
+        {
+            return m_data[0][3] == 0 && m_data[1][3] == 0 && m_data[2][3] == 0 && m_data[3][3] == 1;
+        }
+
+        [[nodiscard]] constexpr MatShape ProductShape(const Matrix4& other) const noexcept
+        {
+            const MatShape shape = std::min(m_shape, other.m_shape);
+            if (shape == MatShape::GENERAL)
+                return shape;
+
+            const bool sameLayout = (IsLastRowIdentity() && other.IsLastRowIdentity()) ||
+                                    (IsLastColIdentity() && other.IsLastColIdentity());
+            return sameLayout ? shape : MatShape::GENERAL;
+        }
+
+        // shape is RIGID to transpose the 3x3 block instead of inverting it, and is the tag of the result
+        [[nodiscard]] constexpr Matrix4 InverseAffine(MatShape shape) const
+        {
+            // operator* stores the product transposed, so a product of factories keeps its translation in
+            // row 3. Tags from operator* always match one layout, a wrong SetShape() promise may not
+            const bool translationInLastRow = IsLastColIdentity();
+            if (!translationInLastRow && !IsLastRowIdentity())
+                return InverseGeneral();
+
+            const bool rigid = shape == MatShape::RIGID;
+            if constexpr (std::is_same_v<T, float>)
+                if (!std::is_constant_evaluated())
+                {
+                    Matrix4 result {Uninitialized {}, shape};
+                    float det;
+                    if (translationInLastRow)
+                        det = rigid ? simd::Mat4InverseAffine<true, true>(Data(), result.MutableData())
+                                    : simd::Mat4InverseAffine<true, false>(Data(), result.MutableData());
+                    else
+                        det = rigid ? simd::Mat4InverseAffine<false, true>(Data(), result.MutableData())
+                                    : simd::Mat4InverseAffine<false, false>(Data(), result.MutableData());
+                    if (std::abs(det) <= EPSILON)
+                        throw std::runtime_error("Matrix is singular");
+
+                    return result;
+                }
+
+            // Read the storage as basis vectors b0-b2 in rows 0-2 and the translation in row 3
+            auto at = [&](size_t i, size_t j) { return translationInLastRow ? m_data[i][j] : m_data[j][i]; };
+
+            T inv[3][3];
+            if (rigid)
+            {
+                for (size_t i = 0; i < 3; ++i)
+                    for (size_t j = 0; j < 3; ++j)
+                        inv[i][j] = at(j, i);
+            }
+            else
+            {
+                // The columns of the inverse are b1 x b2, b2 x b0 and b0 x b1 over the determinant
+                T k[3][3];
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    const size_t a = (i + 1) % 3;
+                    const size_t b = (i + 2) % 3;
+                    k[i][0] = at(a, 1) * at(b, 2) - at(a, 2) * at(b, 1);
+                    k[i][1] = at(a, 2) * at(b, 0) - at(a, 0) * at(b, 2);
+                    k[i][2] = at(a, 0) * at(b, 1) - at(a, 1) * at(b, 0);
+                }
+
+                T det = at(0, 0) * k[0][0] + at(0, 1) * k[0][1] + at(0, 2) * k[0][2];
+                if (abs(det) <= EPSILON)
+                    throw std::runtime_error("Matrix is singular");
+
+                for (size_t i = 0; i < 3; ++i)
+                    for (size_t j = 0; j < 3; ++j)
+                        inv[i][j] = k[j][i] / det;
+            }
+
+            Matrix4 result;
+            for (size_t i = 0; i < 3; ++i)
+            {
+                T translation = -(at(3, 0) * inv[0][i] + at(3, 1) * inv[1][i] + at(3, 2) * inv[2][i]);
+                for (size_t j = 0; j < 3; ++j)
+                    (translationInLastRow ? result.m_data[i][j] : result.m_data[j][i]) = inv[i][j];
+                (translationInLastRow ? result.m_data[3][i] : result.m_data[i][3]) = translation;
+            }
+
+            result.m_shape = shape;
+            return result;
+        }
+
+    public:
         [[nodiscard]] constexpr Matrix4 Transpose() const noexcept
         {
+            if constexpr (std::is_same_v<T, float>)
+                if (!std::is_constant_evaluated())
+                {
+                    Matrix4 result {Uninitialized {}, m_shape};
+                    simd::Mat4Transpose(Data(), result.MutableData());
+                    return result;
+                }
+
             return Matrix4(m_data[0][0], m_data[0][1], m_data[0][2], m_data[0][3],
                                  m_data[1][0], m_data[1][1], m_data[1][2], m_data[1][3],
                                  m_data[2][0], m_data[2][1], m_data[2][2], m_data[2][3],
-                                 m_data[3][0], m_data[3][1], m_data[3][2], m_data[3][3]);
+                                 m_data[3][0], m_data[3][1], m_data[3][2], m_data[3][3]).WithShape(m_shape);
         }
 
         [[nodiscard]] constexpr MatOrder GetMatOrder() const noexcept { return m_order; }
@@ -254,7 +435,7 @@ namespace lux::math
 
         [[nodiscard]] constexpr Vector4<T> GetRow(size_t index) const
         {
-            if (index >= N)
+            if (CheckedAccess && index >= N)
                 throw std::out_of_range("Index out of range in matrix access");
 
             return m_data[index];
@@ -262,7 +443,7 @@ namespace lux::math
 
         [[nodiscard]] constexpr Vector4<T> GetCol(size_t index) const
         {
-            if (index >= N)
+            if (CheckedAccess && index >= N)
                 throw std::out_of_range("Index out of range in matrix access");
 
             return Vector4<T> {m_data[0][index], m_data[1][index], m_data[2][index], m_data[3][index]};
@@ -282,6 +463,14 @@ namespace lux::math
 
         [[nodiscard]] constexpr Matrix4 operator*(const Matrix4 &other) const
         {
+            if constexpr (std::is_same_v<T, float>)
+                if (!std::is_constant_evaluated())
+                {
+                    Matrix4 result {Uninitialized {}, ProductShape(other)};
+                    simd::Mat4Mul(Data(), other.Data(), result.MutableData());
+                    return result;
+                }
+
             return Matrix4(m_data[0].Dot(other.GetCol(0)),
                            m_data[0].Dot(other.GetCol(1)),
                            m_data[0].Dot(other.GetCol(2)),
@@ -297,7 +486,7 @@ namespace lux::math
                            m_data[3].Dot(other.GetCol(0)),
                            m_data[3].Dot(other.GetCol(1)),
                            m_data[3].Dot(other.GetCol(2)),
-                           m_data[3].Dot(other.GetCol(3)));
+                           m_data[3].Dot(other.GetCol(3))).WithShape(ProductShape(other));
         }
 
         [[nodiscard]] constexpr T Determinant() const noexcept
@@ -331,6 +520,14 @@ namespace lux::math
 
         [[nodiscard]] constexpr Vector4<T> operator*(const Vector4<T>& v) const noexcept
         {
+            if constexpr (std::is_same_v<T, float>)
+                if (!std::is_constant_evaluated())
+                {
+                    Vector4<T> result;
+                    simd::Mat4MulVec(Data(), reinterpret_cast<const float*>(&v), reinterpret_cast<float*>(&result));
+                    return result;
+                }
+
             return Vector4<T> {m_data[0].Dot(v), m_data[1].Dot(v), m_data[2].Dot(v), m_data[3].Dot(v)};
         }
 
@@ -355,12 +552,13 @@ namespace lux::math
                 0, 0, 1, v[2],
                 0, 0, 0, 1,
                 MatOrder::ROW_MAJOR
-            };
+            }.WithShape(MatShape::RIGID);
         }
 
         [[nodiscard]] static constexpr Matrix4 Scale(T scalar) noexcept
         {
-            return Matrix4 {scalar, 0, 0, 0, 0, scalar, 0, 0, 0, 0, scalar, 0, 0, 0, 0, 1, MatOrder::ROW_MAJOR};
+            return Matrix4 {scalar, 0, 0, 0, 0, scalar, 0, 0, 0, 0, scalar, 0, 0, 0, 0, 1, MatOrder::ROW_MAJOR}
+                .WithShape(MatShape::AFFINE);
         }
 
         [[nodiscard]] static constexpr Matrix4 Scale(const Vector3<T> &v) noexcept
@@ -372,7 +570,7 @@ namespace lux::math
                 0,    0,    v[2], 0,
                 0,    0,    0,    1,
                 MatOrder::ROW_MAJOR
-            };
+            }.WithShape(MatShape::AFFINE);
         }
 
         [[nodiscard]] static constexpr Matrix4 Rotate(const T angle, const Vector3<T> &axis = {0, 0, 1}) noexcept
@@ -399,7 +597,7 @@ namespace lux::math
 
                 0, 0, 0, 1,
                 MatOrder::ROW_MAJOR
-            };
+            }.WithShape(MatShape::RIGID);
         }
 
         [[nodiscard]] static constexpr Matrix4 Scale(const Matrix4& m, T scalar) noexcept
@@ -465,7 +663,7 @@ namespace lux::math
                0, 0, -2 / fn, -(far + near) / fn,
                0, 0, 0, 1,
                MatOrder::ROW_MAJOR
-          };
+          }.WithShape(MatShape::AFFINE);
         }
 
         static constexpr Matrix4 LookAt(const Vector3<T>& eye, const Vector3<T>& target, const Vector3<T>& upDir)
@@ -481,7 +679,7 @@ namespace lux::math
                -forward.GetX(), -forward.GetY(), -forward.GetZ(), Dot(forward, eye),
                0.0f, 0.0f, 0.0f, 1.0f,
                MatOrder::ROW_MAJOR
-           };
+           }.WithShape(MatShape::RIGID);
         }
 
         const float* Data() const { return reinterpret_cast<const float*>(m_data.data()); }
@@ -516,7 +714,16 @@ namespace lux::math
         static constexpr size_t N = 4;
         std::array<Vector4<T>, N> m_data;
         MatOrder m_order;
-        float det;
+        MatShape m_shape = MatShape::GENERAL;
+
+        // Skips the identity setup for results that a kernel overwrites entirely
+        // order and shape are set together: written one byte at a time, the two stores would not
+        // forward to the two byte load that copies them out of a returned temporary
+        struct Uninitialized {};
+        explicit Matrix4(Uninitialized, MatShape shape = MatShape::GENERAL) noexcept
+            : m_order{MatOrder::COLUMN_MAJOR}, m_shape{shape} {}
+
+        float* MutableData() noexcept { return reinterpret_cast<float*>(m_data.data()); }
 
         void SetIdentity() noexcept
         {
@@ -548,4 +755,6 @@ namespace lux::math
             return ((row + col) % 2 == 0 ? 1.0f : -1.0f) * detMinor;
         }
     };
+
+    static_assert(std::is_trivially_copyable_v<Matrix4<float>>, "Matrix4 must stay trivially copyable");
 }
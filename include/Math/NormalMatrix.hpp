@@ -0,0 +1,183 @@
+/*
+ * Project: TestProject
+ * File: NormalMatrix.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 12:05
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <array>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "Matrix.hpp"
+#include "PackedMatrix4.hpp"
+#include "VectorPacket.hpp"
+
+/*  Normal matrices
+ *
+ *  Normals transform with the inverse transpose of the model matrix's upper 3x3 block A. For
+ *  the affine matrices instances use it needs no general inverse: with a0, a1, a2 the columns
+ *  of A, inverse(A)^T has the columns
+ *
+ *      (a1 x a2) / det, (a2 x a0) / det, (a0 x a1) / det      det = a0 . (a1 x a2)
+ *
+ *  so one matrix costs three cross products, a dot and a division. The batch functions work
+ *  on simd::FloatLanes matrices per step. A singular block (det == 0) gives a zero matrix.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math
+{
+    /**
+     * @brief GPU-ready 3x3 normal matrix, three columns padded to 16 bytes
+     *
+     * Column c is at data[4 * c], the w slot is zero. Bound as three instanced vec3 attributes with
+     * a 48 byte stride, or read as a std140 mat3, it arrives in the shader without conversion.
+     */
+    struct alignas(16) PackedNormalMatrix
+    {
+        std::array<float, 12> data;
+
+        [[nodiscard]] constexpr float operator()(size_t row, size_t col) const noexcept { return data[col * 4 + row]; }
+
+        [[nodiscard]] const float* Data() const noexcept { return data.data(); }
+
+        [[nodiscard]] bool operator==(const PackedNormalMatrix& other) const noexcept = default;
+    };
+
+    static_assert(sizeof(PackedNormalMatrix) == 48);
+    static_assert(std::is_trivially_copyable_v<PackedNormalMatrix> && std::is_standard_layout_v<PackedNormalMatrix>);
+
+    namespace detail
+    {
+        /**
+         * @brief Cofactor columns scaled by 1 / det, written in the PackedNormalMatrix layout
+         */
+        inline void StoreNormalLanes(const Vector3Packet& a0, const Vector3Packet& a1, const Vector3Packet& a2,
+                                     float* out, size_t outStride) noexcept
+        {
+            const Vector3Packet c0 = Cross(a1, a2);
+            const Vector3Packet c1 = Cross(a2, a0);
+            const Vector3Packet c2 = Cross(a0, a1);
+
+            const simd::FloatN det = Dot(a0, c0);
+            const simd::FloatN invDet = simd::AndN(simd::DivN(simd::SplatN(1.0f), det),
+                                                   simd::LessN(simd::SplatN(0.0f), simd::AbsN(det)));
+            const simd::FloatN zero = simd::SplatN(0.0f);
+
+            const Vector3Packet n0 = c0 * invDet;
+            const Vector3Packet n1 = c1 * invDet;
+            const Vector3Packet n2 = c2 * invDet;
+
+            simd::StoreLaneQuadsN(out, outStride, n0.x, n0.y, n0.z, zero);
+            simd::StoreLaneQuadsN(out + 4, outStride, n1.x, n1.y, n1.z, zero);
+            simd::StoreLaneQuadsN(out + 8, outStride, n2.x, n2.y, n2.z, zero);
+        }
+
+        /**
+         * @brief Normal matrices of the FloatLanes models starting at m, modelStride floats apart
+         *
+         * The first three quads of a model are its columns when ColumnMajor, otherwise its rows.
+         */
+        template<bool ColumnMajor>
+        inline void NormalMatrixLanes(const float* m, size_t modelStride, float* out) noexcept
+        {
+            simd::FloatN q[3][4];
+            for (size_t k = 0; k < 3; ++k)
+                simd::LoadLaneQuadsN(m + 4 * k, modelStride, q[k][0], q[k][1], q[k][2], q[k][3]);
+
+            auto column = [&](size_t c)
+            {
+                if constexpr (ColumnMajor)
+                    return Vector3Packet {q[c][0], q[c][1], q[c][2]};
+                else
+                    return Vector3Packet {q[0][c], q[1][c], q[2][c]};
+            };
+
+            StoreNormalLanes(column(0), column(1), column(2), out, sizeof(PackedNormalMatrix) / sizeof(float));
+        }
+
+        template<bool ColumnMajor>
+        inline void ComputeNormalMatrices(const float* models, size_t count, size_t modelStride,
+                                          PackedNormalMatrix* out) noexcept
+        {
+            constexpr size_t L = simd::FloatLanes;
+
+            size_t i = 0;
+            for (; i + L <= count; i += L)
+                NormalMatrixLanes<ColumnMajor>(models + i * modelStride, modelStride, out[i].data.data());
+
+            if (i == count)
+                return;
+
+            // The remainder goes through a block padded with identity matrices so it is rounded the same way
+            std::array<float, 16 * L> block {};
+            for (size_t lane = 0; lane < L; ++lane)
+            {
+                float* dst = block.data() + lane * 16;
+                if (i + lane < count)
+                    std::copy_n(models + (i + lane) * modelStride, 12, dst);
+                else
+                    dst[0] = dst[5] = dst[10] = 1.0f;
+            }
+
+            std::array<PackedNormalMatrix, L> tail;
+            NormalMatrixLanes<ColumnMajor>(block.data(), 16, tail[0].data.data());
+            std::copy_n(tail.begin(), count - i, out + i);
+        }
+    }
+
+    /**
+     * @brief out[i] is the normal matrix of the affine GPU matrix models[i], only its upper 3x3 block is read
+     */
+    inline void ComputeNormalMatrices(std::span<const PackedMatrix4f> models, std::span<PackedNormalMatrix> out) noexcept
+    {
+        CORE_ASSERT(out.size() >= models.size(), "ComputeNormalMatrices: output span too small")
+        detail::ComputeNormalMatrices<true>(reinterpret_cast<const float*>(models.data()), models.size(),
+                                            sizeof(PackedMatrix4f) / sizeof(float), out.data());
+    }
+
+    /**
+     * @brief out[i] is the normal matrix of the affine matrix models[i], only its upper 3x3 block is read
+     */
+    inline void ComputeNormalMatrices(std::span<const Matrix4f> models, std::span<PackedNormalMatrix> out) noexcept
+    {
+        static_assert(sizeof(Matrix4f) % sizeof(float) == 0, "Batch kernels step through Matrix4f arrays in floats");
+
+        CORE_ASSERT(out.size() >= models.size(), "ComputeNormalMatrices: output span too small")
+
+        // Data() holds the rows of the matrix
+        detail::ComputeNormalMatrices<false>(reinterpret_cast<const float*>(models.data()), models.size(),
+                                             sizeof(Matrix4f) / sizeof(float), out.data());
+    }
+
+    [[nodiscard]] inline std::vector<PackedNormalMatrix> ComputeNormalMatrices(std::span<const PackedMatrix4f> models)
+    {
+        std::vector<PackedNormalMatrix> normals(models.size());
+        ComputeNormalMatrices(models, normals);
+        return normals;
+    }
+}
@@ -0,0 +1,94 @@
+/*
+ * Project: TestProject
+ * File: PackedMatrix4.hpp
+ * Author: olegfresi
+ * Created: 16/10/26 14:20
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <array>
+#include <cstring>
+#include <span>
+#include <type_traits>
+#include <vector>
+#include "Matrix4.hpp"
+
+namespace lux::math
+{
+    /**
+     * @brief GPU-ready storage for a Matrix4<float>
+     *
+     * Sixteen floats in column-major order, the layout glUniformMatrix4fv and the per-instance
+     * matrix attributes expect, aligned to a cache line. There is no order flag and no cached
+     * determinant, so arrays of it are plain memory that can be copied straight into buffers.
+     */
+    struct alignas(64) PackedMatrix4f
+    {
+        std::array<float, 16> data;
+
+        /**
+         * @brief Packs m so that column c holds m.GetCol(c)
+         */
+        [[nodiscard]] static PackedMatrix4f From(const Matrix4<float>& m) noexcept
+        {
+            PackedMatrix4f packed;
+            simd::Mat4Transpose(m.Data(), packed.data.data());
+            return packed;
+        }
+
+        [[nodiscard]] Matrix4<float> ToMatrix4() const noexcept
+        {
+            std::array<float, 16> rows;
+            simd::Mat4Transpose(data.data(), rows.data());
+            return Matrix4<float> {rows.data(), MatOrder::ROW_MAJOR};
+        }
+
+        [[nodiscard]] constexpr float operator()(size_t row, size_t col) const noexcept { return data[col * 4 + row]; }
+
+        [[nodiscard]] float Determinant() const noexcept { return simd::scalar::Mat4Determinant(data.data()); }
+
+        [[nodiscard]] const float* Data() const noexcept { return data.data(); }
+
+        [[nodiscard]] bool operator==(const PackedMatrix4f& other) const noexcept = default;
+    };
+
+    static_assert(sizeof(PackedMatrix4f) == 64 && alignof(PackedMatrix4f) == 64);
+    static_assert(std::is_trivially_copyable_v<PackedMatrix4f> && std::is_standard_layout_v<PackedMatrix4f>);
+
+    inline void PackMatrices(std::span<const Matrix4<float>> matrices, std::span<PackedMatrix4f> out) noexcept
+    {
+        CORE_ASSERT(out.size() >= matrices.size(), "PackMatrices: output span too small")
+        for (size_t i = 0; i < matrices.size(); ++i)
+            simd::Mat4Transpose(matrices[i].Data(), out[i].data.data());
+    }
+
+    [[nodiscard]] inline std::vector<PackedMatrix4f> PackMatrices(std::span<const Matrix4<float>> matrices)
+    {
+        std::vector<PackedMatrix4f> packed(matrices.size());
+        PackMatrices(matrices, packed);
+        return packed;
+    }
+}
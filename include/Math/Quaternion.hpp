@@ -37,6 +37,8 @@
 #include <iterator>
 #include <numbers>
 #include <cassert>
+#include <functional>
+#include <ostream>
 
 namespace lux::math
 {
@@ -135,7 +137,7 @@ namespace lux::math
          * Copy constructor, from a Quaternion with another value type.
          */
         template<typename T1>
-        explicit Quaternion(const Quaternion<T1>& y) : _a(y.a()), _b(y.b()), _c(y.c()), _d(y.d()) { }
+        explicit Quaternion(const Quaternion<T1>& y) : _a(y.A()), _b(y.B()), _c(y.C()), _d(y.D()) { }
 
         /**
          * Assignment operator, from a Quaternion with another value type.
@@ -143,10 +145,10 @@ namespace lux::math
         template<typename T1>
         Quaternion& operator=(const Quaternion<T1>& other)
         {
-            _a = other.a();
-            _b = other.b();
-            _c = other.c();
-            _d = other.d();
+            _a = other.A();
+            _b = other.B();
+            _c = other.C();
+            _d = other.D();
 
             return *this;
         }
@@ -308,7 +310,7 @@ namespace lux::math
 
         Quaternion operator-() const
         {
-            return {-_a, -_b, -_c, -_d};
+            return Quaternion(-_a, -_b, -_c, -_d);
         }
 
         Quaternion operator+=(T y)
@@ -399,10 +401,10 @@ namespace lux::math
         template<typename T1>
         Quaternion operator+=(const Quaternion<T1>& y)
         {
-            _a += y.a();
-            _b += y.b();
-            _c += y.c();
-            _d += y.d();
+            _a += y.A();
+            _b += y.B();
+            _c += y.C();
+            _d += y.D();
 
             return *this;
         }
@@ -425,10 +427,10 @@ namespace lux::math
         template<typename T1>
         Quaternion operator*=(const Quaternion<T1>& y) {
 
-            T at = _a * y.a() - _b * y.b() - _c * y.c() - _d * y.d();
-            T bt = _a * y.b() + _b * y.a() + _c * y.d() - _d * y.c();
-            T ct = _a * y.c() - _b * y.d() + _c * y.a() + _d * y.b();
-            T dt = _a * y.d() + _b * y.c() - _c * y.b() + _d * y.a();
+            T at = _a * y.A() - _b * y.B() - _c * y.C() - _d * y.D();
+            T bt = _a * y.B() + _b * y.A() + _c * y.D() - _d * y.C();
+            T ct = _a * y.C() - _b * y.D() + _c * y.A() + _d * y.B();
+            T dt = _a * y.D() + _b * y.C() - _c * y.B() + _d * y.A();
 
             _a = at;
             _b = bt;
@@ -450,10 +452,10 @@ namespace lux::math
 
             T n2 = y.NormSquared();
 
-            T at = _a * y.a() + _b * y.b() + _c * y.c() + _d * y.d();
-            T bt = -_a * y.b() + _b * y.a() - _c * y.d() + _d * y.c();
-            T ct = -_a * y.c() + _b * y.d() + _c * y.a() - _d * y.b();
-            T dt = -_a * y.d() - _b * y.c() + _c * y.b() + _d * y.a();
+            T at = _a * y.A() + _b * y.B() + _c * y.C() + _d * y.D();
+            T bt = -_a * y.B() + _b * y.A() - _c * y.D() + _d * y.C();
+            T ct = -_a * y.C() + _b * y.D() + _c * y.A() - _d * y.B();
+            T dt = -_a * y.D() - _b * y.C() + _c * y.B() + _d * y.A();
 
             _a = at / n2;
             _b = bt / n2;
@@ -565,17 +567,17 @@ namespace lux::math
     PolarRepresentation<T> ToPolarRepresentation(const Quaternion<T>& x)
     {
         T nu = x.UnrealNormSquared();
-        T n = std::sqrt(nu + x.a() * x.a());
+        T n = std::sqrt(nu + x.A() * x.A());
         assert(nu >= 0);
         if (nu > 0)
         {
-            T theta = std::acos(x.a() / n);
+            T theta = std::acos(x.A() / n);
             T ns = sqrt(nu);
-            return {{n, theta, x.b() / ns, x.c() / ns, x.d() / ns}};
+            return {{n, theta, x.B() / ns, x.C() / ns, x.D() / ns}};
         }
         const T pi = std::atan2(+0., -0.);
 
-        return {{n, n == x.a() ? 0 : pi, 0, 0, 0}};
+        return {{n, n == x.A() ? 0 : pi, 0, 0, 0}};
     }
 
     /**
@@ -593,7 +595,7 @@ namespace lux::math
     ComplexMatrix2D<T> ToComplexMatrix2D(const Quaternion<T>& x)
     {
         ComplexMatrix2D<T> cm;
-        cm[0][0] = {x.a(), x.b()}; cm[0][1] = {x.c(), x.d()};
+        cm[0][0] = {x.A(), x.B()}; cm[0][1] = {x.C(), x.D()};
         cm[1][0] = -Conj(cm[0][1]); cm[1][1] = Conj(cm[0][0]);
 
         return cm;
@@ -628,10 +630,10 @@ namespace lux::math
     RealMatrix4D<T> ToRealMatrix4D(const Quaternion<T>& x)
     {
         RealMatrix4D<T> rm;
-        rm[0] = {{x.a(), x.b(), x.c(), x.d()}};
-        rm[1] = {{-x.b(), x.a(), -x.d(), x.c()}};
-        rm[2] = {{-x.c(), x.d(), x.a(), -x.b()}};
-        rm[3] = {{-x.d(), -x.c(), x.b(), x.a()}};
+        rm[0] = {{x.A(), x.B(), x.C(), x.D()}};
+        rm[1] = {{-x.B(), x.A(), -x.D(), x.C()}};
+        rm[2] = {{-x.C(), x.D(), x.A(), -x.B()}};
+        rm[3] = {{-x.D(), -x.C(), x.B(), x.A()}};
 
         return rm;
     }
@@ -663,10 +665,10 @@ namespace lux::math
     template<typename T>
     RotationMatrix<T> ToRotationMatrix(const Quaternion<T>& x)
     {
-        T a2 = x.a() * x.a(), b2 = x.b() * x.b(), c2 = x.c() * x.c(), d2 = x.d() * x.d();
-        T ab = x.a() * x.b(), ac = x.a() * x.c(), ad = x.a() * x.d();
-        T bc = x.b() * x.c(), bd = x.b() * x.d();
-        T cd = x.c() * x.d();
+        T a2 = x.A() * x.A(), b2 = x.B() * x.B(), c2 = x.C() * x.C(), d2 = x.D() * x.D();
+        T ab = x.A() * x.B(), ac = x.A() * x.C(), ad = x.A() * x.D();
+        T bc = x.B() * x.C(), bd = x.B() * x.D();
+        T cd = x.C() * x.D();
         std::array<T, 3> r0{{a2 + b2 - c2 - d2, 2 * (bc - ad), 2 * (bd + ac)}};
         std::array<T, 3> r1{{2 * (bc + ad), a2 - b2 + c2 - d2, 2 * (cd - ab)}};
         std::array<T, 3> r2{{2 * (bd - ac), 2 * (cd + ab), a2 - b2 - c2 + d2}};
@@ -724,16 +726,16 @@ namespace lux::math
         assert(x.is_unit(eps));
         auto pi = std::numbers::pi;
 
-        T v = x.b()*x.c()+x.a()*x.d();
+        T v = x.B()*x.C()+x.A()*x.D();
         if (std::abs(v - 0.5) < eps)
-            return {{2*atan2(x.b(),x.a()), +pi/2, 0}};
+            return {{2*atan2(x.B(),x.A()), +pi/2, 0}};
 
         if (std::abs(v + 0.5) < eps)
-            return {{-2*atan2(x.b(),x.a()), -pi/2, 0}};
+            return {{-2*atan2(x.B(),x.A()), -pi/2, 0}};
 
-        return {{atan2(2*(x.a()*x.c() - x.b()*x.d()), 1-2*(x.c()*x.c()+x.d()*x.d())),
+        return {{atan2(2*(x.A()*x.C() - x.B()*x.D()), 1-2*(x.C()*x.C()+x.D()*x.D())),
                  std::asin(2*v),
-                 atan2(2*(x.a()*x.b()-x.c()*x.d()), 1-2*(x.b()*x.b()+x.d()*x.d()))}};
+                 atan2(2*(x.A()*x.B()-x.C()*x.D()), 1-2*(x.B()*x.B()+x.D()*x.D()))}};
     }
 
     /**
@@ -800,10 +802,10 @@ namespace lux::math
     {
         constexpr bool operator()(const Quaternion<T>& x, const Quaternion<T>& y) const
         {
-            return x.a() < y.a()
-                   || (x.a() == y.a() && x.b() < y.b())
-                   || (x.a() == y.a() && x.b() == y.b() && x.c() < y.c())
-                   || (x.a() == y.a() && x.b() == y.b() && x.c() == y.c() && x.d() < y.d());
+            return x.A() < y.A()
+                   || (x.A() == y.A() && x.B() < y.B())
+                   || (x.A() == y.A() && x.B() == y.B() && x.C() < y.C())
+                   || (x.A() == y.A() && x.B() == y.B() && x.C() == y.C() && x.D() < y.D());
         }
     };
 
@@ -813,7 +815,7 @@ namespace lux::math
     template<typename T>
     Quaternion<T> Conj(const Quaternion<T>& x)
     {
-        return {x.a(), -x.b(), -x.c(), -x.d()};
+        return Quaternion<T>(x.A(), -x.B(), -x.C(), -x.D());
     }
 
     template<typename T>
@@ -837,29 +839,29 @@ namespace lux::math
     template<typename T>
     T NormL0(const Quaternion<T>& x)
     {
-        return (x.a() != 0) + (x.b() != 0) + (x.c() != 0) + (x.d() != 0);
+        return (x.A() != 0) + (x.B() != 0) + (x.C() != 0) + (x.D() != 0);
     }
 
     template<typename T>
     T NormL1(const Quaternion<T>& x)
     {
-        return std::abs(x.a()) + std::abs(x.b()) + std::abs(x.c()) + std::abs(x.d());
+        return std::abs(x.A()) + std::abs(x.B()) + std::abs(x.C()) + std::abs(x.D());
     }
 
     template<typename T, typename T1>
     T NormLk(const Quaternion<T>& x, T1 k)
     {
-        return std::pow(std::pow(std::abs(x.a()), k)
-                        + std::pow(std::abs(x.b()), k)
-                        + std::pow(std::abs(x.c()), k)
-                        + std::pow(std::abs(x.d()), k), 1.0 / k);
+        return std::pow(std::pow(std::abs(x.A()), k)
+                        + std::pow(std::abs(x.B()), k)
+                        + std::pow(std::abs(x.C()), k)
+                        + std::pow(std::abs(x.D()), k), 1.0 / k);
     }
 
     template<typename T>
     T NormSup(const Quaternion<T>& x)
     {
-        return std::max(std::max(std::abs(x.a()), std::abs(x.b())),
-                        std::max(std::abs(x.c()), std::abs(x.d())));
+        return std::max(std::max(std::abs(x.A()), std::abs(x.B())),
+                        std::max(std::abs(x.C()), std::abs(x.D())));
     }
 
     template <typename T, typename T1 =T>
@@ -933,12 +935,12 @@ namespace lux::math
      * "IS_CONVERTIBLE".
      *
      * operator== returns false if the Quaternion is not real.
-     * If the Quaternion is real, it returns true if x.a() == y.
+     * If the Quaternion is real, it returns true if x.A() == y.
      */
     template <typename T, typename T2, IS_CONVERTIBLE(T2, T)>
     bool operator==(const Quaternion<T>& x, T2 y)
     {
-        return x.is_real() && x.a() == y;
+        return x.is_real() && x.A() == y;
     }
 
     template <typename T, typename T2, IS_CONVERTIBLE(T2, T)>
@@ -962,20 +964,20 @@ namespace lux::math
     template <typename T, typename T2, typename T3, IS_CONVERTIBLE(T2, T), IS_CONVERTIBLE(T3,T)>
     bool NearlyEqual(const Quaternion<T>& x, T2 y, T3 eps)
     {
-        return x.IsReal() && IsNearlyEqual(x.a(), y, eps);
+        return x.IsReal() && IsNearlyEqual(x.A(), y, eps);
     }
 
     template <typename T, typename T2, typename T3, IS_CONVERTIBLE(T2, T), IS_CONVERTIBLE(T3,T)>
     bool NearlyEqual(T2 y, const Quaternion<T>& x, T3 eps)
     {
-        return x.IsReal() && IsNearlyEqual(x.a(), y, eps);
+        return x.IsReal() && IsNearlyEqual(x.A(), y, eps);
     }
 
 
     template<typename T, typename T2, IS_CONVERTIBLE(T2,T)>
     bool operator==(const Quaternion<T>& x, const std::complex<T2>& y)
     {
-        return IsComplex(x) && x.a() == y.real() && x.b() == y.imag();
+        return IsComplex(x) && x.A() == y.real() && x.B() == y.imag();
     }
 
     template<typename T, typename T2, IS_CONVERTIBLE(T2,T)>
@@ -1000,8 +1002,8 @@ namespace lux::math
     bool NearlyEqual(const Quaternion<T>& x, const std::complex<T2>& y, T3 eps)
     {
         return IsComplex(x, eps)
-               && IsNearlyEqual(x.a(), y.real(), eps)
-               && IsNearlyEqual(x.b(), y.imag(), eps);
+               && IsNearlyEqual(x.A(), y.real(), eps)
+               && IsNearlyEqual(x.B(), y.imag(), eps);
     }
 
     template <typename T, typename T2, typename T3, IS_CONVERTIBLE(T2, T), IS_CONVERTIBLE(T3,T)>
@@ -1014,7 +1016,7 @@ namespace lux::math
     template<typename T1, typename T2>
     bool operator==(const Quaternion<T1>& x, const Quaternion<T2>& y)
     {
-        return x.a() == y.a() && x.b() == y.b() && x.c() == y.c() && x.d() == y.d();
+        return x.A() == y.A() && x.B() == y.B() && x.C() == y.C() && x.D() == y.D();
     }
 
     template<typename T>
@@ -1026,10 +1028,10 @@ namespace lux::math
     template <typename T1, typename T2, typename T3>
     bool NearlyEqual(const Quaternion<T1>& x, const Quaternion<T2>& y, T3 eps)
     {
-        return IsNearlyEqual(x.a(), y.a(), eps)
-               && IsNearlyEqual(x.b(), y.b(), eps)
-               && IsNearlyEqual(x.c(), y.c(), eps)
-               && IsNearlyEqual(x.d(), y.d(), eps);
+        return IsNearlyEqual(x.A(), y.A(), eps)
+               && IsNearlyEqual(x.B(), y.B(), eps)
+               && IsNearlyEqual(x.C(), y.C(), eps)
+               && IsNearlyEqual(x.D(), y.D(), eps);
     }
 
     template<typename T, typename T1>
@@ -1125,7 +1127,7 @@ namespace lux::math
     template<typename T>
     Quaternion<T> Inverse(const Quaternion<T>& x)
     {
-        return conj(x) / norm_squared(x);
+        return Conj(x) / NormSquared(x);
     }
 
     template<typename T, typename T1>
@@ -1137,7 +1139,7 @@ namespace lux::math
     template<typename T, typename T1>
     Quaternion<T> operator/(T1 y, const Quaternion<T>& x)
     {
-        return y * inverse(x);
+        return y * Inverse(x);
     }
 
     template<typename T>
@@ -1149,19 +1151,19 @@ namespace lux::math
     template<typename T>
     Quaternion<T> operator/(std::complex<T>& y, const Quaternion<T>& x)
     {
-        return y * inverse(x);
+        return y * Inverse(x);
     }
 
     template<typename T>
     Quaternion<T> operator/(const Quaternion<T>& x, const Quaternion<T>& y)
     {
-        return x * inverse(y);
+        return x * Inverse(y);
     }
 
     template<typename T>
     T Dot(const Quaternion<T>& x, const Quaternion<T>& y)
     {
-        return x.a() * y.a() + x.b() * y.b() + x.c() * y.c() + x.d() * y.d();
+        return x.A() * y.A() + x.B() * y.B() + x.C() * y.C() + x.D() * y.D();
     }
 
     /**
@@ -1171,9 +1173,9 @@ namespace lux::math
     Quaternion<T> Cross(const Quaternion<T>& x, const Quaternion<T>& y)
     {
         return {0,
-                x.c() * y.d() - x.d() * y.c(),
-                x.d() * y.b() - x.b() * y.d(),
-                x.b() * y.c() - x.c() * y.b()};
+                x.C() * y.D() - x.D() * y.C(),
+                x.D() * y.B() - x.B() * y.D(),
+                x.B() * y.C() - x.C() * y.B()};
     }
 
     template<typename T>
@@ -1195,12 +1197,12 @@ namespace lux::math
     {
         T un = x.UnrealNormSquared();
         if (un == 0)
-            return {std::exp(x.a())};
+            return {std::exp(x.A())};
 
         T n1 = std::sqrt(un);
-        T ea = std::exp(x.a());
+        T ea = std::exp(x.A());
         T n2 = ea * std::sin(n1) / n1;
-        return {ea * std::cos(n1), n2 * x.b(), n2 * x.c(), n2 * x.d()};
+        return {ea * std::cos(n1), n2 * x.B(), n2 * x.C(), n2 * x.D()};
     }
 
     template<typename T>
@@ -1209,18 +1211,18 @@ namespace lux::math
         T nu2 = x.UnrealNormSquared();
         if (nu2 == 0)
         {
-            if (x.a() > 0)
-                return {std::log(x.a())};
+            if (x.A() > 0)
+                return {std::log(x.A())};
 
-            std::complex<T> l = log(std::complex<T>(x.a(), 0));
+            std::complex<T> l = log(std::complex<T>(x.A(), 0));
             return {l.real(), l.imag()};
         }
 
-        T a = x.a();
+        T a = x.A();
         assert(nu2 > 0);
         T n = std::sqrt(a * a + nu2);
         T th = std::acos(a / n) / std::sqrt(nu2);
-        return {std::log(n), th * x.b(), th * x.c(), th * x.d()};
+        return {std::log(n), th * x.B(), th * x.C(), th * x.D()};
     }
 
     /**
@@ -1233,11 +1235,11 @@ namespace lux::math
     template<typename T>
     Quaternion<T> Pow2(const Quaternion<T>& x)
     {
-        T aa = 2 * x.a();
-        return {x.a() * x.a() - x.UnrealNormSquared(),
-                aa * x.b(),
-                aa * x.c(),
-                aa * x.d()};
+        T aa = 2 * x.A();
+        return {x.A() * x.A() - x.UnrealNormSquared(),
+                aa * x.B(),
+                aa * x.C(),
+                aa * x.D()};
     }
 
     /**
@@ -1250,13 +1252,13 @@ namespace lux::math
     template<typename T>
     Quaternion<T> Pow3(const Quaternion<T>& x)
     {
-        T a2 = x.a() * x.a();
+        T a2 = x.A() * x.A();
         T n1 = x.UnrealNormSquared();
         T n2 = 3 * a2 - n1;
-        return {x.a() * (a2 - 3 * n1),
-                x.b() * n2,
-                x.c() * n2,
-                x.d() * n2};
+        return {x.A() * (a2 - 3 * n1),
+                x.B() * n2,
+                x.C() * n2,
+                x.D() * n2};
     }
 
     /**
@@ -1269,13 +1271,13 @@ namespace lux::math
     template<typename T>
     Quaternion<T> Pow4(const Quaternion<T>& x)
     {
-        T a2 = x.a() * x.a();
+        T a2 = x.A() * x.A();
         T n1 = x.UnrealNormSquared();
-        T n2 = 4 * x.a() * (a2 - n1);
+        T n2 = 4 * x.A() * (a2 - n1);
         return {a2 * a2 - 6 * a2 * n1 + n1 * n1,
-                x.b() * n2,
-                x.c() * n2,
-                x.d() * n2};
+                x.B() * n2,
+                x.C() * n2,
+                x.D() * n2};
     }
 
 
@@ -1323,7 +1325,7 @@ namespace lux::math
     Quaternion<T> Pow(const Quaternion<T>& x, const Quaternion<T>& a)
     {
         if (a.IsReal())
-            return Pow(x, a.a());
+            return Pow(x, a.A());
 
         return Exp(a * Log(x));
     }
@@ -1333,11 +1335,11 @@ namespace lux::math
     {
         T z = x.UnrealNormSquared();
         if (z == 0)
-            return {std::cos(x.a())};
+            return {std::cos(x.A())};
 
         z = std::sqrt(z);
         T w = -std::sin(x.real()) * std::sinh(z) / z;
-        return {std::cos(x.real()) * std::cosh(z), w * x.b(), w * x.c(), w * x.d()};
+        return {std::cos(x.real()) * std::cosh(z), w * x.B(), w * x.C(), w * x.D()};
     }
 
     template<typename T>
@@ -1345,11 +1347,11 @@ namespace lux::math
     {
         T z = x.UnrealNormSquared();
         if (z == 0)
-            return {std::sin(x.a())};
+            return {std::sin(x.A())};
 
         z = std::sqrt(z);
         T w = std::cos(x.real()) * std::sinh(z) / z;
-        return {std::sin(x.real()) * std::cosh(z), w * x.b(), w * x.c(), w * x.d()};
+        return {std::sin(x.real()) * std::cosh(z), w * x.B(), w * x.C(), w * x.D()};
     }
 
     template<typename T>
@@ -1357,13 +1359,13 @@ namespace lux::math
     {
         T z = x.UnrealNormSquared();
         if (z == 0)
-            return {std::tan(x.a())};
+            return {std::tan(x.A())};
 
         z = std::sqrt(z);
         T n = std::sinh(2 * z);
-        T d = std::cos(2 * x.a()) + std::cosh(2 * z);
+        T d = std::cos(2 * x.A()) + std::cosh(2 * z);
         T r = n / (z * d);
-        return {std::sin(2 * x.a()) / d, r * x.b(), r * x.c(), r * x.d()};
+        return {std::sin(2 * x.A()) / d, r * x.B(), r * x.C(), r * x.D()};
     }
 
     template<typename T>
@@ -1388,10 +1390,10 @@ namespace lux::math
     Quaternion<T> AXBY(K k1, const Quaternion<T>& x, K k2, const Quaternion<T>& y)
     {
 
-        T a = k1 * x.a() + k2 * y.a();
-        T b = k1 * x.b() + k2 * y.b();
-        T c = k1 * x.c() + k2 * y.c();
-        T d = k1 * x.d() + k2 * y.d();
+        T a = k1 * x.A() + k2 * y.A();
+        T b = k1 * x.B() + k2 * y.B();
+        T c = k1 * x.C() + k2 * y.C();
+        T d = k1 * x.D() + k2 * y.D();
 
         return {a, b, c, d};
     }
@@ -1399,8 +1401,8 @@ namespace lux::math
 
     struct QuaternionIO
     {
-        static long double scalar_zero_threshold;
-        static int print_style;
+        static inline long double scalar_zero_threshold = 0;
+        static inline int print_style = 0;
 
 
         template<typename T>
@@ -1427,16 +1429,16 @@ namespace lux::math
                 if (q == Quaternion<T>(0, 0, 0, -1))
                     return out << "-k";
                 auto s = [](T x) { return x < 0 ? "" : "+"; };
-                if (!IsScalarZero(q.a(), QuaternionIO::scalar_zero_threshold))
-                    out << q.a();
-                if (!IsScalarZero(q.b(), QuaternionIO::scalar_zero_threshold))
-                    out << s(q.b()) << q.b() << "i";
-                if (!IsScalarZero(q.c(), QuaternionIO::scalar_zero_threshold))
-                    out << s(q.c()) << q.c() << "j";
-                if (!IsScalarZero(q.d(), QuaternionIO::scalar_zero_threshold))
-                    out << s(q.d()) << q.d() << "k";
+                if (!IsScalarZero(q.A(), QuaternionIO::scalar_zero_threshold))
+                    out << q.A();
+                if (!IsScalarZero(q.B(), QuaternionIO::scalar_zero_threshold))
+                    out << s(q.B()) << q.B() << "i";
+                if (!IsScalarZero(q.C(), QuaternionIO::scalar_zero_threshold))
+                    out << s(q.C()) << q.C() << "j";
+                if (!IsScalarZero(q.D(), QuaternionIO::scalar_zero_threshold))
+                    out << s(q.D()) << q.D() << "k";
             } else if (print_style == 1) {
-                out << "{" << q.a() << "," << q.b() << "," << q.c() << "," << q.d() << "}";
+                out << "{" << q.A() << "," << q.B() << "," << q.C() << "," << q.D() << "}";
             }
             return out;
         }
@@ -1445,9 +1447,6 @@ namespace lux::math
     /**
      * IO manipulators to control the format when printing quaternions out to a stream.
      */
-    long double QuaternionIO::scalar_zero_threshold = 0;
-    int QuaternionIO::print_style;
-
     struct SetScalarZeroThreshold
     {
         long double eps = 0;
@@ -1482,13 +1481,13 @@ namespace lux::math
 
     inline std::ostream& operator<<(std::ostream& out, SetDisplayStyle sds)
     {
-        QuaternionIO::print_style = sds.style;
+        QuaternionIO::print_style = static_cast<int>(sds.style);
         return out;
     }
 
     template<typename T>
     std::ostream& operator<<(std::ostream& out, const Quaternion <T>& q)
     {
-        return QuaternionIO::print(out, q);
+        return QuaternionIO::Print(out, q);
     }
 }
\ No newline at end of file
@@ -0,0 +1,365 @@
+/*
+ * Project: TestProject
+ * File: Quatf.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 09:40
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <array>
+#include <cmath>
+#include <span>
+#include <type_traits>
+#include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Simd/QuaternionKernels.hpp"
+
+namespace lux::math
+{
+    /**
+     * @brief Float rotation quaternion for per-frame work
+     *
+     * Quaternion<T> is the general purpose algebra type (complex interop, Pow, Exp, Log...).
+     * Quatf only covers rotations: it is 16 bytes, 16-byte aligned, stores x, y, z, w in the
+     * order the SIMD kernels load, and defaults to the identity rotation. Convert from and to
+     * Qf when the generic operations are needed.
+     */
+    class alignas(16) Quatf
+    {
+    public:
+        constexpr Quatf() noexcept : m_data{0.0f, 0.0f, 0.0f, 1.0f} {}
+
+        constexpr Quatf(float x, float y, float z, float w) noexcept : m_data{x, y, z, w} {}
+
+        explicit Quatf(const Qf& q) noexcept : m_data{q.B(), q.C(), q.D(), q.A()} {}
+
+        [[nodiscard]] static constexpr Quatf Identity() noexcept { return Quatf {}; }
+
+        /**
+         * @brief Rotation of angle radians around axis, same convention as Matrix4f::Rotate
+         */
+        [[nodiscard]] static Quatf FromAxisAngle(float angle, const Vector3f& axis) noexcept
+        {
+            const float s = std::sin(angle * 0.5f) / axis.Length();
+            return {axis.GetX() * s, axis.GetY() * s, axis.GetZ() * s, std::cos(angle * 0.5f)};
+        }
+
+        [[nodiscard]] constexpr float GetX() const noexcept { return m_data[0]; }
+        [[nodiscard]] constexpr float GetY() const noexcept { return m_data[1]; }
+        [[nodiscard]] constexpr float GetZ() const noexcept { return m_data[2]; }
+        [[nodiscard]] constexpr float GetW() const noexcept { return m_data[3]; }
+
+        [[nodiscard]] const float* Data() const noexcept { return m_data.data(); }
+        [[nodiscard]] float* Data() noexcept { return m_data.data(); }
+
+        [[nodiscard]] Qf ToQuaternion() const noexcept { return Qf(m_data[3], m_data[0], m_data[1], m_data[2]); }
+
+        /**
+         * @brief Hamilton product: the result applies other first, then this
+         */
+        [[nodiscard]] Quatf operator*(const Quatf& other) const noexcept
+        {
+            Quatf result;
+            simd::QuatMul(Data(), other.Data(), result.Data());
+            return result;
+        }
+
+        /**
+         * @brief Rotates v, the quaternion must be normalized
+         */
+        [[nodiscard]] Vector3f Rotate(const Vector3f& v) const noexcept
+        {
+            const float in[3] = {v.GetX(), v.GetY(), v.GetZ()};
+            float out[3];
+            simd::QuatRotate(Data(), in, out);
+            return Vector3f {out[0], out[1], out[2]};
+        }
+
+        [[nodiscard]] constexpr Quatf Conjugate() const noexcept { return {-m_data[0], -m_data[1], -m_data[2], m_data[3]}; }
+
+        [[nodiscard]] constexpr float Dot(const Quatf& other) const noexcept
+        {
+            return m_data[0] * other.m_data[0] + m_data[1] * other.m_data[1] +
+                   m_data[2] * other.m_data[2] + m_data[3] * other.m_data[3];
+        }
+
+        [[nodiscard]] float Length() const noexcept { return std::sqrt(Dot(*this)); }
+
+        [[nodiscard]] Quatf Normalize() const noexcept
+        {
+            const float invLength = 1.0f / Length();
+            return {m_data[0] * invLength, m_data[1] * invLength, m_data[2] * invLength, m_data[3] * invLength};
+        }
+
+        /**
+         * @brief Rotation matrix of the (normalized) quaternion, tagged RIGID
+         */
+        [[nodiscard]] Matrix4f ToMatrix4() const noexcept
+        {
+            alignas(16) std::array<float, 16> rows;
+            simd::QuatToMat4(Data(), rows.data());
+            return Matrix4f::FromData(rows.data(), MatShape::RIGID);
+        }
+
+        [[nodiscard]] constexpr bool operator==(const Quatf& other) const noexcept = default;
+
+    private:
+        std::array<float, 4> m_data;
+    };
+
+    static_assert(sizeof(Quatf) == 16 && alignof(Quatf) == 16);
+    static_assert(std::is_trivially_copyable_v<Quatf>);
+
+    /**
+     * @brief Normalized lerp along the shortest arc. Cheaper than Slerp, the speed is not constant
+     */
+    [[nodiscard]] inline Quatf Nlerp(const Quatf& a, const Quatf& b, float t) noexcept
+    {
+        Quatf result;
+        simd::QuatNlerp(a.Data(), b.Data(), t, result.Data());
+        return result;
+    }
+
+    /**
+     * @brief Constant speed interpolation along the shortest arc between unit quaternions (error < 2e-5)
+     */
+    [[nodiscard]] inline Quatf Slerp(const Quatf& a, const Quatf& b, float t) noexcept
+    {
+        Quatf result;
+        simd::QuatSlerp(a.Data(), b.Data(), t, result.Data());
+        return result;
+    }
+
+    /*  Batch quaternion operations
+     *
+     *  Each step loads FloatLanes quaternions and transposes them into x, y, z, w registers,
+     *  so every lane works on its own quaternion; the remainder goes through the single
+     *  quaternion kernels. Interpolation takes either one t for the whole span (blending two
+     *  poses) or one t per element (sampling keyframes). Outputs may alias the inputs.
+     *--------------------------------------------------------------------------------*/
+    namespace detail
+    {
+        struct QuatLanes
+        {
+            simd::FloatN x, y, z, w;
+        };
+
+        inline QuatLanes LoadQuats(const Quatf* q) noexcept
+        {
+            QuatLanes lanes;
+            simd::LoadLaneQuadsN(q->Data(), 4, lanes.x, lanes.y, lanes.z, lanes.w);
+            return lanes;
+        }
+
+        inline void StoreQuats(Quatf* q, const QuatLanes& lanes) noexcept
+        {
+            simd::StoreLaneQuadsN(q->Data(), 4, lanes.x, lanes.y, lanes.z, lanes.w);
+        }
+
+        template<bool Spherical, typename TLanes, typename TOne>
+        inline void InterpolateQuats(std::span<const Quatf> a, std::span<const Quatf> b, std::span<Quatf> out,
+                                     TLanes&& loadT, TOne&& oneT) noexcept
+        {
+            using namespace simd;
+            CORE_ASSERT(b.size() >= a.size() && out.size() >= a.size(), "InterpolateQuats: span size mismatch")
+
+            constexpr size_t L = FloatLanes;
+            const size_t count = a.size();
+            size_t i = 0;
+
+            for (; i + L <= count; i += L)
+            {
+                const QuatLanes qa = LoadQuats(a.data() + i);
+                const QuatLanes qb = LoadQuats(b.data() + i);
+                const FloatN t = loadT(i);
+
+                const FloatN dot = MulAddN(qa.x, qb.x, MulAddN(qa.y, qb.y, MulAddN(qa.z, qb.z, MulN(qa.w, qb.w))));
+                const FloatN sign = SignN(dot);
+
+                FloatN fa, fb;
+                if constexpr (Spherical)
+                {
+                    SlerpWeightsN(t, AbsN(dot), fa, fb);
+                    fb = XorN(fb, sign);
+                }
+                else
+                {
+                    fa = SubN(SplatN(1.0f), t);
+                    fb = XorN(t, sign);
+                }
+
+                QuatLanes r {MulAddN(fa, qa.x, MulN(fb, qb.x)), MulAddN(fa, qa.y, MulN(fb, qb.y)),
+                             MulAddN(fa, qa.z, MulN(fb, qb.z)), MulAddN(fa, qa.w, MulN(fb, qb.w))};
+
+                if constexpr (!Spherical)
+                {
+                    const FloatN lengthSq = MulAddN(r.x, r.x, MulAddN(r.y, r.y, MulAddN(r.z, r.z, MulN(r.w, r.w))));
+                    const FloatN invLength = DivN(SplatN(1.0f), SqrtN(lengthSq));
+                    r = {MulN(r.x, invLength), MulN(r.y, invLength), MulN(r.z, invLength), MulN(r.w, invLength)};
+                }
+
+                StoreQuats(out.data() + i, r);
+            }
+
+            for (; i < count; ++i)
+                out[i] = Spherical ? Slerp(a[i], b[i], oneT(i)) : Nlerp(a[i], b[i], oneT(i));
+        }
+    }
+
+    inline void Multiply(std::span<const Quatf> a, std::span<const Quatf> b, std::span<Quatf> out) noexcept
+    {
+        using namespace simd;
+        CORE_ASSERT(b.size() >= a.size() && out.size() >= a.size(), "Multiply: span size mismatch")
+
+        constexpr size_t L = FloatLanes;
+        const size_t count = a.size();
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            const detail::QuatLanes p = detail::LoadQuats(a.data() + i);
+            const detail::QuatLanes q = detail::LoadQuats(b.data() + i);
+
+            const detail::QuatLanes r
+            {
+                SubN(MulAddN(p.w, q.x, MulAddN(p.x, q.w, MulN(p.y, q.z))), MulN(p.z, q.y)),
+                SubN(MulAddN(p.w, q.y, MulAddN(p.y, q.w, MulN(p.z, q.x))), MulN(p.x, q.z)),
+                SubN(MulAddN(p.w, q.z, MulAddN(p.z, q.w, MulN(p.x, q.y))), MulN(p.y, q.x)),
+                SubN(MulN(p.w, q.w), MulAddN(p.x, q.x, MulAddN(p.y, q.y, MulN(p.z, q.z))))
+            };
+
+            detail::StoreQuats(out.data() + i, r);
+        }
+
+        for (; i < count; ++i)
+            out[i] = a[i] * b[i];
+    }
+
+    /**
+     * @brief out[i] = q[i].Rotate(v[i])
+     */
+    inline void Rotate(std::span<const Quatf> q, std::span<const Vector3f> v, std::span<Vector3f> out) noexcept
+    {
+        using namespace simd;
+        CORE_ASSERT(v.size() >= q.size() && out.size() >= q.size(), "Rotate: span size mismatch")
+
+        constexpr size_t L = FloatLanes;
+        const size_t count = q.size();
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            const detail::QuatLanes r = detail::LoadQuats(q.data() + i);
+
+            FloatN vx, vy, vz;
+            LoadInterleaved3N(reinterpret_cast<const float*>(v.data() + i), vx, vy, vz);
+
+            // t = 2 (u x v), v' = v + w t + u x t
+            const FloatN two = SplatN(2.0f);
+            const FloatN tx = MulN(two, SubN(MulN(r.y, vz), MulN(r.z, vy)));
+            const FloatN ty = MulN(two, SubN(MulN(r.z, vx), MulN(r.x, vz)));
+            const FloatN tz = MulN(two, SubN(MulN(r.x, vy), MulN(r.y, vx)));
+
+            const FloatN ox = AddN(MulAddN(r.w, tx, vx), SubN(MulN(r.y, tz), MulN(r.z, ty)));
+            const FloatN oy = AddN(MulAddN(r.w, ty, vy), SubN(MulN(r.z, tx), MulN(r.x, tz)));
+            const FloatN oz = AddN(MulAddN(r.w, tz, vz), SubN(MulN(r.x, ty), MulN(r.y, tx)));
+
+            StoreInterleaved3N(reinterpret_cast<float*>(out.data() + i), ox, oy, oz);
+        }
+
+        for (; i < count; ++i)
+            out[i] = q[i].Rotate(v[i]);
+    }
+
+    inline void Nlerp(std::span<const Quatf> a, std::span<const Quatf> b, float t, std::span<Quatf> out) noexcept
+    {
+        const simd::FloatN lanes = simd::SplatN(t);
+        detail::InterpolateQuats<false>(a, b, out, [&](size_t) { return lanes; }, [&](size_t) { return t; });
+    }
+
+    inline void Nlerp(std::span<const Quatf> a, std::span<const Quatf> b, std::span<const float> t,
+                      std::span<Quatf> out) noexcept
+    {
+        CORE_ASSERT(t.size() >= a.size(), "Nlerp: span size mismatch")
+        detail::InterpolateQuats<false>(a, b, out, [&](size_t i) { return simd::LoadN(t.data() + i); },
+                                        [&](size_t i) { return t[i]; });
+    }
+
+    inline void Slerp(std::span<const Quatf> a, std::span<const Quatf> b, float t, std::span<Quatf> out) noexcept
+    {
+        const simd::FloatN lanes = simd::SplatN(t);
+        detail::InterpolateQuats<true>(a, b, out, [&](size_t) { return lanes; }, [&](size_t) { return t; });
+    }
+
+    inline void Slerp(std::span<const Quatf> a, std::span<const Quatf> b, std::span<const float> t,
+                      std::span<Quatf> out) noexcept
+    {
+        CORE_ASSERT(t.size() >= a.size(), "Slerp: span size mismatch")
+        detail::InterpolateQuats<true>(a, b, out, [&](size_t i) { return simd::LoadN(t.data() + i); },
+                                       [&](size_t i) { return t[i]; });
+    }
+
+    /**
+     * @brief Rotation matrices of normalized quaternions, packed for the GPU (e.g. a bone palette)
+     *
+     * out[i] equals PackedMatrix4f::From(q[i].ToMatrix4()).
+     */
+    inline void ToMatrices(std::span<const Quatf> q, std::span<PackedMatrix4f> out) noexcept
+    {
+        using namespace simd;
+        CORE_ASSERT(out.size() >= q.size(), "ToMatrices: output span too small")
+
+        constexpr size_t L = FloatLanes;
+        constexpr size_t outStride = sizeof(PackedMatrix4f) / sizeof(float);
+        const size_t count = q.size();
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            const detail::QuatLanes r = detail::LoadQuats(q.data() + i);
+
+            const FloatN one = SplatN(1.0f);
+            const FloatN zero = SplatN(0.0f);
+            const FloatN x2 = AddN(r.x, r.x), y2 = AddN(r.y, r.y), z2 = AddN(r.z, r.z);
+            const FloatN xx = MulN(r.x, x2), yy = MulN(r.y, y2), zz = MulN(r.z, z2);
+            const FloatN xy = MulN(r.x, y2), xz = MulN(r.x, z2), yz = MulN(r.y, z2);
+            const FloatN wx = MulN(r.w, x2), wy = MulN(r.w, y2), wz = MulN(r.w, z2);
+
+            float* dst = out[i].data.data();
+            StoreLaneQuadsN(dst, outStride, SubN(one, AddN(yy, zz)), AddN(xy, wz), SubN(xz, wy), zero);
+            StoreLaneQuadsN(dst + 4, outStride, SubN(xy, wz), SubN(one, AddN(xx, zz)), AddN(yz, wx), zero);
+            StoreLaneQuadsN(dst + 8, outStride, AddN(xz, wy), SubN(yz, wx), SubN(one, AddN(xx, yy)), zero);
+            StoreLaneQuadsN(dst + 12, outStride, zero, zero, zero, one);
+        }
+
+        for (; i < count; ++i)
+        {
+            alignas(16) float rows[16];
+            simd::QuatToMat4(q[i].Data(), rows);
+            simd::Mat4Transpose(rows, out[i].data.data());
+        }
+    }
+}
@@ -0,0 +1,447 @@
+/*
+ * Project: TestProject
+ * File: Matrix4Kernels.hpp
+ * Author: olegfresi
+ * Created: 16/10/26 09:40
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include "Simd.hpp"
+
+/*  Matrix4<float> kernels
+ *
+ *  Every kernel works on the raw storage of a Matrix4<float>: sixteen floats, the four
+ *  Vector4 lanes of m_data laid out one after the other (s[i * 4 + j] == m_data[i][j]).
+ *  The kernels reproduce the results of the scalar Matrix4 operators they replace, so
+ *  Matrix4 can switch between them freely. Output pointers must not alias the inputs.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math::simd
+{
+    namespace scalar
+    {
+        /**
+         * @brief out[i][j] = sum_k a[j][k] * b[k][i], the layout produced by Matrix4::operator*
+         */
+        inline void Mat4Mul(const float* a, const float* b, float* out) noexcept
+        {
+            for (size_t i = 0; i < 4; ++i)
+                for (size_t j = 0; j < 4; ++j)
+                    out[i * 4 + j] = a[j * 4 + 0] * b[0 * 4 + i] + a[j * 4 + 1] * b[1 * 4 + i] +
+                                     a[j * 4 + 2] * b[2 * 4 + i] + a[j * 4 + 3] * b[3 * 4 + i];
+        }
+
+        /**
+         * @brief out[i] = dot(m[i], v)
+         */
+        inline void Mat4MulVec(const float* m, const float* v, float* out) noexcept
+        {
+            for (size_t i = 0; i < 4; ++i)
+                out[i] = m[i * 4 + 0] * v[0] + m[i * 4 + 1] * v[1] + m[i * 4 + 2] * v[2] + m[i * 4 + 3] * v[3];
+        }
+
+        inline void Mat4Transpose(const float* m, float* out) noexcept
+        {
+            for (size_t i = 0; i < 4; ++i)
+                for (size_t j = 0; j < 4; ++j)
+                    out[i * 4 + j] = m[j * 4 + i];
+        }
+
+        [[nodiscard]] inline float Mat4Determinant(const float* m) noexcept
+        {
+            const float c5 = m[10] * m[15] - m[14] * m[11];
+            const float c4 = m[9] * m[15] - m[13] * m[11];
+            const float c3 = m[9] * m[14] - m[13] * m[10];
+            const float c2 = m[8] * m[15] - m[12] * m[11];
+            const float c1 = m[8] * m[14] - m[12] * m[10];
+            const float c0 = m[8] * m[13] - m[12] * m[9];
+
+            return (m[0] * m[5] - m[4] * m[1]) * c5 - (m[0] * m[6] - m[4] * m[2]) * c4 +
+                   (m[0] * m[7] - m[4] * m[3]) * c3 + (m[1] * m[6] - m[5] * m[2]) * c2 -
+                   (m[1] * m[7] - m[5] * m[3]) * c1 + (m[2] * m[7] - m[6] * m[3]) * c0;
+        }
+
+        /**
+         * @brief General inverse through 2x2 sub-determinants
+         * @return The determinant of m. When it is zero out is left untouched
+         */
+        inline float Mat4Inverse(const float* m, float* out) noexcept
+        {
+            const float s0 = m[0] * m[5] - m[4] * m[1];
+            const float s1 = m[0] * m[6] - m[4] * m[2];
+            const float s2 = m[0] * m[7] - m[4] * m[3];
+            const float s3 = m[1] * m[6] - m[5] * m[2];
+            const float s4 = m[1] * m[7] - m[5] * m[3];
+            const float s5 = m[2] * m[7] - m[6] * m[3];
+
+            const float c5 = m[10] * m[15] - m[14] * m[11];
+            const float c4 = m[9] * m[15] - m[13] * m[11];
+            const float c3 = m[9] * m[14] - m[13] * m[10];
+            const float c2 = m[8] * m[15] - m[12] * m[11];
+            const float c1 = m[8] * m[14] - m[12] * m[10];
+            const float c0 = m[8] * m[13] - m[12] * m[9];
+
+            const float det = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+            if (det == 0.0f)
+                return det;
+
+            const float invDet = 1.0f / det;
+
+            out[0]  = ( m[5] * c5 - m[6] * c4 + m[7] * c3) * invDet;
+            out[1]  = (-m[1] * c5 + m[2] * c4 - m[3] * c3) * invDet;
+            out[2]  = ( m[13] * s5 - m[14] * s4 + m[15] * s3) * invDet;
+            out[3]  = (-m[9] * s5 + m[10] * s4 - m[11] * s3) * invDet;
+
+            out[4]  = (-m[4] * c5 + m[6] * c2 - m[7] * c1) * invDet;
+            out[5]  = ( m[0] * c5 - m[2] * c2 + m[3] * c1) * invDet;
+            out[6]  = (-m[12] * s5 + m[14] * s2 - m[15] * s1) * invDet;
+            out[7]  = ( m[8] * s5 - m[10] * s2 + m[11] * s1) * invDet;
+
+            out[8]  = ( m[4] * c4 - m[5] * c2 + m[7] * c0) * invDet;
+            out[9]  = (-m[0] * c4 + m[1] * c2 - m[3] * c0) * invDet;
+            out[10] = ( m[12] * s4 - m[13] * s2 + m[15] * s0) * invDet;
+            out[11] = (-m[8] * s4 + m[9] * s2 - m[11] * s0) * invDet;
+
+            out[12] = (-m[4] * c3 + m[5] * c1 - m[6] * c0) * invDet;
+            out[13] = ( m[0] * c3 - m[1] * c1 + m[2] * c0) * invDet;
+            out[14] = (-m[12] * s3 + m[13] * s1 - m[14] * s0) * invDet;
+            out[15] = ( m[8] * s3 - m[9] * s1 + m[10] * s0) * invDet;
+
+            return det;
+        }
+        /**
+         * @brief Inverse of an affine matrix, the 3x3 block through cross products
+         * @tparam TranslationInLastRow True when row 3 of m holds the translation (its last column is
+         *         0 0 0 1), false when column 3 does (its last row is 0 0 0 1)
+         * @tparam Rigid The block is a rotation: transpose it instead of inverting it
+         * @return The determinant of the 3x3 block. When it is zero out is left untouched
+         */
+        template<bool TranslationInLastRow, bool Rigid>
+        inline float Mat4InverseAffine(const float* m, float* out) noexcept
+        {
+            // Read m as basis vectors in rows 0-2 and the translation in row 3
+            auto at = [&](size_t i, size_t j) { return TranslationInLastRow ? m[i * 4 + j] : m[j * 4 + i]; };
+
+            float inv[3][3];
+            float det = 1.0f;
+            if constexpr (Rigid)
+            {
+                for (size_t i = 0; i < 3; ++i)
+                    for (size_t j = 0; j < 3; ++j)
+                        inv[i][j] = at(j, i);
+            }
+            else
+            {
+                // The columns of the inverse are b1 x b2, b2 x b0 and b0 x b1 over the determinant
+                float k[3][3];
+                for (size_t i = 0; i < 3; ++i)
+                {
+                    const size_t a = (i + 1) % 3;
+                    const size_t b = (i + 2) % 3;
+                    k[i][0] = at(a, 1) * at(b, 2) - at(a, 2) * at(b, 1);
+                    k[i][1] = at(a, 2) * at(b, 0) - at(a, 0) * at(b, 2);
+                    k[i][2] = at(a, 0) * at(b, 1) - at(a, 1) * at(b, 0);
+                }
+
+                det = at(0, 0) * k[0][0] + at(0, 1) * k[0][1] + at(0, 2) * k[0][2];
+                if (det == 0.0f)
+                    return det;
+
+                const float invDet = 1.0f / det;
+                for (size_t i = 0; i < 3; ++i)
+                    for (size_t j = 0; j < 3; ++j)
+                        inv[i][j] = k[j][i] * invDet;
+            }
+
+            float result[16];
+            for (size_t i = 0; i < 3; ++i)
+            {
+                for (size_t j = 0; j < 3; ++j)
+                    result[i * 4 + j] = inv[i][j];
+                result[i * 4 + 3] = 0.0f;
+                result[12 + i] = -(at(3, 0) * inv[0][i] + at(3, 1) * inv[1][i] + at(3, 2) * inv[2][i]);
+            }
+            result[15] = 1.0f;
+
+            if constexpr (TranslationInLastRow)
+                std::copy_n(result, 16, out);
+            else
+                Mat4Transpose(result, out);
+
+            return det;
+        }
+    }
+
+#if defined(LUX_SIMD_SSE4)
+    namespace sse
+    {
+        // Broadcast lane I of v to all four lanes
+        template<int I>
+        [[nodiscard]] inline __m128 Splat(__m128 v) noexcept
+        {
+            return _mm_shuffle_ps(v, v, _MM_SHUFFLE(I, I, I, I));
+        }
+
+        // With AVX enabled, copies of the result are done with 32 byte loads: storing two rows at a time
+        // keeps those loads from stalling on store forwarding
+        inline void StoreRows(float* out, __m128 r0, __m128 r1, __m128 r2, __m128 r3) noexcept
+        {
+#if defined(LUX_SIMD_AVX2)
+            _mm256_storeu_ps(out + 0, _mm256_set_m128(r1, r0));
+            _mm256_storeu_ps(out + 8, _mm256_set_m128(r3, r2));
+#else
+            _mm_storeu_ps(out + 0, r0);
+            _mm_storeu_ps(out + 4, r1);
+            _mm_storeu_ps(out + 8, r2);
+            _mm_storeu_ps(out + 12, r3);
+#endif
+        }
+
+        // a x b for xyz in lanes 0-2, lane 3 ends up a.w * b.w - a.w * b.w
+        [[nodiscard]] inline __m128 Cross(__m128 a, __m128 b) noexcept
+        {
+            const __m128 c = _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 2, 1))),
+                                        _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(3, 0, 2, 1)), b));
+            return _mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1));
+        }
+
+        // 2x2 matrix helpers for the block inverse, each __m128 holds a row-major 2x2 matrix
+        [[nodiscard]] inline __m128 Mat2Mul(__m128 a, __m128 b) noexcept
+        {
+            return _mm_add_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(3, 0, 3, 0))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                                         _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+
+        // adj(a) * b
+        [[nodiscard]] inline __m128 Mat2AdjMul(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 0, 3, 3)), b),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 2, 1, 1)),
+                                         _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 0, 3, 2))));
+        }
+
+        // a * adj(b)
+        [[nodiscard]] inline __m128 Mat2MulAdj(__m128 a, __m128 b) noexcept
+        {
+            return _mm_sub_ps(_mm_mul_ps(a, _mm_shuffle_ps(b, b, _MM_SHUFFLE(0, 3, 0, 3))),
+                              _mm_mul_ps(_mm_shuffle_ps(a, a, _MM_SHUFFLE(2, 3, 0, 1)),
+                                         _mm_shuffle_ps(b, b, _MM_SHUFFLE(1, 2, 1, 2))));
+        }
+    }
+
+    inline void Mat4Mul(const float* a, const float* b, float* out) noexcept
+    {
+        // out[i] = sum_k b[k][i] * column k of a: one transpose of a, then every b element is a
+        // broadcast straight from memory (a load, not a shuffle, once AVX is enabled)
+        __m128 c0 = _mm_loadu_ps(a + 0);
+        __m128 c1 = _mm_loadu_ps(a + 4);
+        __m128 c2 = _mm_loadu_ps(a + 8);
+        __m128 c3 = _mm_loadu_ps(a + 12);
+        _MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+
+        auto row = [&](size_t i)
+        {
+#if defined(LUX_SIMD_AVX2)
+            __m128 r = _mm_mul_ps(c0, _mm_broadcast_ss(b + i));
+            r = _mm_fmadd_ps(c1, _mm_broadcast_ss(b + 4 + i), r);
+            r = _mm_fmadd_ps(c2, _mm_broadcast_ss(b + 8 + i), r);
+            return _mm_fmadd_ps(c3, _mm_broadcast_ss(b + 12 + i), r);
+#else
+            __m128 r = _mm_mul_ps(c0, _mm_set1_ps(b[i]));
+            r = _mm_add_ps(r, _mm_mul_ps(c1, _mm_set1_ps(b[4 + i])));
+            r = _mm_add_ps(r, _mm_mul_ps(c2, _mm_set1_ps(b[8 + i])));
+            return _mm_add_ps(r, _mm_mul_ps(c3, _mm_set1_ps(b[12 + i])));
+#endif
+        };
+
+        sse::StoreRows(out, row(0), row(1), row(2), row(3));
+    }
+
+    inline void Mat4MulVec(const float* m, const float* v, float* out) noexcept
+    {
+        const __m128 vec = _mm_loadu_ps(v);
+        const __m128 p0 = _mm_mul_ps(_mm_loadu_ps(m + 0), vec);
+        const __m128 p1 = _mm_mul_ps(_mm_loadu_ps(m + 4), vec);
+        const __m128 p2 = _mm_mul_ps(_mm_loadu_ps(m + 8), vec);
+        const __m128 p3 = _mm_mul_ps(_mm_loadu_ps(m + 12), vec);
+
+        _mm_storeu_ps(out, _mm_hadd_ps(_mm_hadd_ps(p0, p1), _mm_hadd_ps(p2, p3)));
+    }
+
+    inline void Mat4Transpose(const float* m, float* out) noexcept
+    {
+        __m128 r0 = _mm_loadu_ps(m + 0);
+        __m128 r1 = _mm_loadu_ps(m + 4);
+        __m128 r2 = _mm_loadu_ps(m + 8);
+        __m128 r3 = _mm_loadu_ps(m + 12);
+
+        _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+        sse::StoreRows(out, r0, r1, r2, r3);
+    }
+
+    /**
+     * @brief Block-wise inverse: m = | A B |, each block a 2x2 matrix held in one register
+     *                                | C D |
+     * @return The determinant of m. When it is zero out is left untouched
+     */
+    inline float Mat4Inverse(const float* m, float* out) noexcept
+    {
+        const __m128 r0 = _mm_loadu_ps(m + 0);
+        const __m128 r1 = _mm_loadu_ps(m + 4);
+        const __m128 r2 = _mm_loadu_ps(m + 8);
+        const __m128 r3 = _mm_loadu_ps(m + 12);
+
+        const __m128 A = _mm_movelh_ps(r0, r1);
+        const __m128 B = _mm_movehl_ps(r1, r0);
+        const __m128 C = _mm_movelh_ps(r2, r3);
+        const __m128 D = _mm_movehl_ps(r3, r2);
+
+        // (|A|, |B|, |C|, |D|)
+        const __m128 detSub = _mm_sub_ps(
+            _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(2, 0, 2, 0)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(3, 1, 3, 1))),
+            _mm_mul_ps(_mm_shuffle_ps(r0, r2, _MM_SHUFFLE(3, 1, 3, 1)), _mm_shuffle_ps(r1, r3, _MM_SHUFFLE(2, 0, 2, 0))));
+
+        const __m128 detA = sse::Splat<0>(detSub);
+        const __m128 detB = sse::Splat<1>(detSub);
+        const __m128 detC = sse::Splat<2>(detSub);
+        const __m128 detD = sse::Splat<3>(detSub);
+
+        const __m128 DC = sse::Mat2AdjMul(D, C);
+        const __m128 AB = sse::Mat2AdjMul(A, B);
+
+        __m128 X = _mm_sub_ps(_mm_mul_ps(detD, A), sse::Mat2Mul(B, DC));
+        __m128 W = _mm_sub_ps(_mm_mul_ps(detA, D), sse::Mat2Mul(C, AB));
+        __m128 Y = _mm_sub_ps(_mm_mul_ps(detB, C), sse::Mat2MulAdj(D, AB));
+        __m128 Z = _mm_sub_ps(_mm_mul_ps(detC, B), sse::Mat2MulAdj(A, DC));
+
+        // |M| = |A||D| + |B||C| - tr(adj(A)B adj(D)C)
+        __m128 tr = _mm_mul_ps(AB, _mm_shuffle_ps(DC, DC, _MM_SHUFFLE(3, 1, 2, 0)));
+        tr = _mm_hadd_ps(tr, tr);
+        tr = _mm_hadd_ps(tr, tr);
+
+        const __m128 detM = _mm_sub_ps(_mm_add_ps(_mm_mul_ps(detA, detD), _mm_mul_ps(detB, detC)), tr);
+        const float det = _mm_cvtss_f32(detM);
+        if (det == 0.0f)
+            return det;
+
+        const __m128 invDet = _mm_div_ps(_mm_setr_ps(1.0f, -1.0f, -1.0f, 1.0f), detM);
+        X = _mm_mul_ps(X, invDet);
+        Y = _mm_mul_ps(Y, invDet);
+        Z = _mm_mul_ps(Z, invDet);
+        W = _mm_mul_ps(W, invDet);
+
+        // Adjugate of each block and store, the shuffles do both at once
+        sse::StoreRows(out, _mm_shuffle_ps(X, Y, _MM_SHUFFLE(1, 3, 1, 3)), _mm_shuffle_ps(X, Y, _MM_SHUFFLE(0, 2, 0, 2)),
+                       _mm_shuffle_ps(Z, W, _MM_SHUFFLE(1, 3, 1, 3)), _mm_shuffle_ps(Z, W, _MM_SHUFFLE(0, 2, 0, 2)));
+
+        return det;
+    }
+    /**
+     * @brief Same contract as scalar::Mat4InverseAffine
+     */
+    template<bool TranslationInLastRow, bool Rigid>
+    inline float Mat4InverseAffine(const float* m, float* out) noexcept
+    {
+        const __m128 r0 = _mm_loadu_ps(m + 0);
+        const __m128 r1 = _mm_loadu_ps(m + 4);
+        const __m128 r2 = _mm_loadu_ps(m + 8);
+        const __m128 unit = _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f);
+        const __m128 zero = _mm_setzero_ps();
+
+        // k0-k2 become the columns of the inverse 3x3 block, read from the xyz lanes of r0-r2
+        __m128 k0, k1, k2;
+        float det = 1.0f;
+        if constexpr (Rigid)
+        {
+            k0 = _mm_blend_ps(r0, zero, 0b1000);
+            k1 = _mm_blend_ps(r1, zero, 0b1000);
+            k2 = _mm_blend_ps(r2, zero, 0b1000);
+        }
+        else
+        {
+            // (b1 x b2, b2 x b0, b0 x b1) over the determinant, lane 3 cancels to zero
+            k0 = sse::Cross(r1, r2);
+            k1 = sse::Cross(r2, r0);
+            k2 = sse::Cross(r0, r1);
+
+            const __m128 detV = _mm_dp_ps(r0, k0, 0x7F);
+            det = _mm_cvtss_f32(detV);
+            if (det == 0.0f)
+                return det;
+
+            const __m128 invDet = _mm_div_ps(_mm_set1_ps(1.0f), detV);
+            k0 = _mm_mul_ps(k0, invDet);
+            k1 = _mm_mul_ps(k1, invDet);
+            k2 = _mm_mul_ps(k2, invDet);
+        }
+
+        auto mulAdd = [](__m128 a, __m128 b, __m128 c)
+        {
+#if defined(LUX_SIMD_AVX2)
+            return _mm_fmadd_ps(a, b, c);
+#else
+            return _mm_add_ps(_mm_mul_ps(a, b), c);
+#endif
+        };
+
+        if constexpr (TranslationInLastRow)
+        {
+            // Rows of the inverse block, then row 3 = (0, 0, 0, 1) - u * inverse block
+            __m128 k3 = zero;
+            _MM_TRANSPOSE4_PS(k0, k1, k2, k3);
+
+            const __m128 u = _mm_loadu_ps(m + 12);
+            __m128 t = _mm_mul_ps(sse::Splat<0>(u), k0);
+            t = mulAdd(sse::Splat<1>(u), k1, t);
+            t = mulAdd(sse::Splat<2>(u), k2, t);
+
+            sse::StoreRows(out, k0, k1, k2, _mm_sub_ps(unit, t));
+        }
+        else
+        {
+            // -inverse block * t is a combination of its columns; it becomes column 3 in the transpose
+            __m128 t = _mm_mul_ps(sse::Splat<3>(r0), k0);
+            t = mulAdd(sse::Splat<3>(r1), k1, t);
+            t = mulAdd(sse::Splat<3>(r2), k2, t);
+
+            __m128 k3 = _mm_sub_ps(unit, t);
+            _MM_TRANSPOSE4_PS(k0, k1, k2, k3);
+            sse::StoreRows(out, k0, k1, k2, k3);
+        }
+
+        return det;
+    }
+#else
+    using scalar::Mat4Mul;
+    using scalar::Mat4MulVec;
+    using scalar::Mat4Transpose;
+    using scalar::Mat4Inverse;
+    using scalar::Mat4InverseAffine;
+#endif
+}
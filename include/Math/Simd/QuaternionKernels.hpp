@@ -0,0 +1,330 @@
+/*
+ * Project: TestProject
+ * File: QuaternionKernels.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 09:12
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include "Simd.hpp"
+#include "Matrix4Kernels.hpp"
+
+/*  Quatf kernels
+ *
+ *  The kernels work on the raw storage of a Quatf: four floats x, y, z, w. Vectors are
+ *  three floats. Multiplication is the Hamilton product a * b, which applies b first and
+ *  then a. Rotation uses the unit quaternion q to map v to q * v * conj(q).
+ *--------------------------------------------------------------------------------*/
+namespace lux::math::simd
+{
+    /*  Slerp weights
+     *
+     *  Slerp needs f(t) = sin(t * A) / sin(A) where cos(A) = dot(a, b). Instead of acos and
+     *  two sines the weights use the polynomial of Eberly ("A Fast and Accurate Algorithm for
+     *  Computing SLERP"):
+     *
+     *      f(t) = t * (1 + b1 * (1 + b2 * (... (1 + b8))))     b_i = (u_i * t^2 - v_i) * (cos(A) - 1)
+     *
+     *  with the last coefficient pair scaled to minimize the error. The error is below 2e-5
+     *  for every cos(A) in [0, 1], it has no branches and it is exact at t = 0 and t = 1.
+     *--------------------------------------------------------------------------------*/
+    inline constexpr size_t SlerpTerms = 8;
+
+    inline constexpr std::array<float, SlerpTerms> SlerpU = []
+    {
+        std::array<float, SlerpTerms> u {};
+        for (size_t i = 1; i <= SlerpTerms; ++i)
+            u[i - 1] = 1.0f / static_cast<float>(i * (2 * i + 1));
+        u[SlerpTerms - 1] *= 1.85298109240830f;
+        return u;
+    }();
+
+    inline constexpr std::array<float, SlerpTerms> SlerpV = []
+    {
+        std::array<float, SlerpTerms> v {};
+        for (size_t i = 1; i <= SlerpTerms; ++i)
+            v[i - 1] = static_cast<float>(i) / static_cast<float>(2 * i + 1);
+        v[SlerpTerms - 1] *= 1.85298109240830f;
+        return v;
+    }();
+
+    namespace scalar
+    {
+        /**
+         * @brief Weights of a (f0) and b (f1) in slerp(a, b, t) = f0 * a + f1 * b, cosA = |dot(a, b)|
+         */
+        inline void SlerpWeights(float t, float cosA, float& f0, float& f1) noexcept
+        {
+            const float xm1 = cosA - 1.0f;
+            const float d = 1.0f - t;
+            const float sqrT = t * t;
+            const float sqrD = d * d;
+
+            float bt = 1.0f;
+            float bd = 1.0f;
+            for (size_t i = SlerpTerms; i-- > 0;)
+            {
+                bt = 1.0f + (SlerpU[i] * sqrT - SlerpV[i]) * xm1 * bt;
+                bd = 1.0f + (SlerpU[i] * sqrD - SlerpV[i]) * xm1 * bd;
+            }
+
+            f0 = d * bd;
+            f1 = t * bt;
+        }
+
+        inline void QuatMul(const float* a, const float* b, float* out) noexcept
+        {
+            const float x = a[3] * b[0] + a[0] * b[3] + a[1] * b[2] - a[2] * b[1];
+            const float y = a[3] * b[1] - a[0] * b[2] + a[1] * b[3] + a[2] * b[0];
+            const float z = a[3] * b[2] + a[0] * b[1] - a[1] * b[0] + a[2] * b[3];
+            const float w = a[3] * b[3] - a[0] * b[0] - a[1] * b[1] - a[2] * b[2];
+
+            out[0] = x;
+            out[1] = y;
+            out[2] = z;
+            out[3] = w;
+        }
+
+        /**
+         * @brief out = v + 2w (u x v) + 2 u x (u x v), u = q.xyz; q must be a unit quaternion
+         */
+        inline void QuatRotate(const float* q, const float* v, float* out) noexcept
+        {
+            const float tx = 2.0f * (q[1] * v[2] - q[2] * v[1]);
+            const float ty = 2.0f * (q[2] * v[0] - q[0] * v[2]);
+            const float tz = 2.0f * (q[0] * v[1] - q[1] * v[0]);
+
+            out[0] = v[0] + q[3] * tx + q[1] * tz - q[2] * ty;
+            out[1] = v[1] + q[3] * ty + q[2] * tx - q[0] * tz;
+            out[2] = v[2] + q[3] * tz + q[0] * ty - q[1] * tx;
+        }
+
+        /**
+         * @brief Normalized lerp along the shortest arc
+         */
+        inline void QuatNlerp(const float* a, const float* b, float t, float* out) noexcept
+        {
+            const float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+            const float tb = dot < 0.0f ? -t : t;
+            const float ta = 1.0f - t;
+
+            float r[4];
+            for (size_t i = 0; i < 4; ++i)
+                r[i] = ta * a[i] + tb * b[i];
+
+            const float invLength = 1.0f / std::sqrt(r[0] * r[0] + r[1] * r[1] + r[2] * r[2] + r[3] * r[3]);
+            for (size_t i = 0; i < 4; ++i)
+                out[i] = r[i] * invLength;
+        }
+
+        /**
+         * @brief Spherical lerp along the shortest arc, a and b must be unit quaternions
+         */
+        inline void QuatSlerp(const float* a, const float* b, float t, float* out) noexcept
+        {
+            const float dot = a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3];
+
+            float f0, f1;
+            SlerpWeights(t, std::abs(dot), f0, f1);
+            if (dot < 0.0f)
+                f1 = -f1;
+
+            for (size_t i = 0; i < 4; ++i)
+                out[i] = f0 * a[i] + f1 * b[i];
+        }
+
+        /**
+         * @brief Writes the rotation matrix of the unit quaternion q as Matrix4<float> storage (rows)
+         */
+        inline void QuatToMat4(const float* q, float* out) noexcept
+        {
+            const float x = q[0], y = q[1], z = q[2], w = q[3];
+            const float xx = x * x, yy = y * y, zz = z * z;
+            const float xy = x * y, xz = x * z, yz = y * z;
+            const float wx = w * x, wy = w * y, wz = w * z;
+
+            out[0] = 1.0f - 2.0f * (yy + zz);
+            out[1] = 2.0f * (xy - wz);
+            out[2] = 2.0f * (xz + wy);
+            out[3] = 0.0f;
+
+            out[4] = 2.0f * (xy + wz);
+            out[5] = 1.0f - 2.0f * (xx + zz);
+            out[6] = 2.0f * (yz - wx);
+            out[7] = 0.0f;
+
+            out[8] = 2.0f * (xz - wy);
+            out[9] = 2.0f * (yz + wx);
+            out[10] = 1.0f - 2.0f * (xx + yy);
+            out[11] = 0.0f;
+
+            out[12] = 0.0f;
+            out[13] = 0.0f;
+            out[14] = 0.0f;
+            out[15] = 1.0f;
+        }
+    }
+
+#if defined(LUX_SIMD_SSE4)
+    namespace sse
+    {
+        template<int X, int Y, int Z, int W>
+        [[nodiscard]] inline __m128 Swizzle(__m128 v) noexcept
+        {
+            return _mm_shuffle_ps(v, v, _MM_SHUFFLE(W, Z, Y, X));
+        }
+
+        [[nodiscard]] inline __m128 SignMask(float x, float y, float z, float w) noexcept
+        {
+            return _mm_setr_ps(x < 0.0f ? -0.0f : 0.0f, y < 0.0f ? -0.0f : 0.0f,
+                               z < 0.0f ? -0.0f : 0.0f, w < 0.0f ? -0.0f : 0.0f);
+        }
+
+        [[nodiscard]] inline __m128 QuatMul(__m128 a, __m128 b) noexcept
+        {
+            // a * b = aw * b + ax * (bw, -bz, by, -bx) + ay * (bz, bw, -bx, -by) + az * (-by, bx, bw, -bz)
+            const __m128 r0 = _mm_mul_ps(Splat<3>(a), b);
+            const __m128 r1 = _mm_mul_ps(Splat<0>(a), _mm_xor_ps(Swizzle<3, 2, 1, 0>(b), SignMask(1, -1, 1, -1)));
+            const __m128 r2 = _mm_mul_ps(Splat<1>(a), _mm_xor_ps(Swizzle<2, 3, 0, 1>(b), SignMask(1, 1, -1, -1)));
+            const __m128 r3 = _mm_mul_ps(Splat<2>(a), _mm_xor_ps(Swizzle<1, 0, 3, 2>(b), SignMask(-1, 1, 1, -1)));
+            return _mm_add_ps(_mm_add_ps(r0, r1), _mm_add_ps(r2, r3));
+        }
+
+        [[nodiscard]] inline __m128 QuatRotate(__m128 q, __m128 v) noexcept
+        {
+            const __m128 t = Cross(q, v);
+            const __m128 t2 = _mm_add_ps(t, t);
+            return _mm_add_ps(_mm_add_ps(v, _mm_mul_ps(Splat<3>(q), t2)), Cross(q, t2));
+        }
+
+        [[nodiscard]] inline __m128 Normalize4(__m128 v) noexcept
+        {
+            return _mm_div_ps(v, _mm_sqrt_ps(_mm_dp_ps(v, v, 0xFF)));
+        }
+    }
+
+    inline void QuatMul(const float* a, const float* b, float* out) noexcept
+    {
+        _mm_storeu_ps(out, sse::QuatMul(_mm_loadu_ps(a), _mm_loadu_ps(b)));
+    }
+
+    inline void QuatRotate(const float* q, const float* v, float* out) noexcept
+    {
+        const __m128 r = sse::QuatRotate(_mm_loadu_ps(q), _mm_setr_ps(v[0], v[1], v[2], 0.0f));
+
+        alignas(16) float lanes[4];
+        _mm_store_ps(lanes, r);
+        out[0] = lanes[0];
+        out[1] = lanes[1];
+        out[2] = lanes[2];
+    }
+
+    inline void QuatNlerp(const float* a, const float* b, float t, float* out) noexcept
+    {
+        const __m128 va = _mm_loadu_ps(a);
+        const __m128 vb = _mm_loadu_ps(b);
+
+        // Flip b onto the shortest arc by moving the sign of the dot product onto its weight
+        const __m128 sign = _mm_and_ps(_mm_dp_ps(va, vb, 0xFF), _mm_set1_ps(-0.0f));
+        const __m128 tb = _mm_xor_ps(_mm_set1_ps(t), sign);
+
+        const __m128 r = _mm_add_ps(_mm_mul_ps(_mm_set1_ps(1.0f - t), va), _mm_mul_ps(tb, vb));
+        _mm_storeu_ps(out, sse::Normalize4(r));
+    }
+
+    inline void QuatSlerp(const float* a, const float* b, float t, float* out) noexcept
+    {
+        const __m128 va = _mm_loadu_ps(a);
+        const __m128 vb = _mm_loadu_ps(b);
+        const float dot = _mm_cvtss_f32(_mm_dp_ps(va, vb, 0xF1));
+
+        float f0, f1;
+        scalar::SlerpWeights(t, std::abs(dot), f0, f1);
+        if (dot < 0.0f)
+            f1 = -f1;
+
+        _mm_storeu_ps(out, _mm_add_ps(_mm_mul_ps(_mm_set1_ps(f0), va), _mm_mul_ps(_mm_set1_ps(f1), vb)));
+    }
+
+    inline void QuatToMat4(const float* q, float* out) noexcept
+    {
+        // Diagonal 1 - 2(yy + zz), 1 - 2(xx + zz), 1 - 2(xx + yy); off diagonal 2(xy +- wz) and friends
+        const __m128 v = _mm_loadu_ps(q);
+        const __m128 v2 = _mm_add_ps(v, v);
+        const __m128 sq = _mm_mul_ps(v, v2);
+
+        const __m128 one = _mm_set1_ps(1.0f);
+        const __m128 diag = _mm_sub_ps(_mm_sub_ps(one, sse::Swizzle<1, 0, 0, 3>(sq)), sse::Swizzle<2, 2, 1, 3>(sq));
+
+        const __m128 p = _mm_mul_ps(sse::Swizzle<0, 0, 1, 3>(v), sse::Swizzle<1, 2, 2, 3>(v2));   // 2xy 2xz 2yz
+        const __m128 w = _mm_mul_ps(sse::Splat<3>(v2), sse::Swizzle<2, 1, 0, 3>(v));         // 2wz 2wy 2wx
+        const __m128 plus = _mm_add_ps(p, w);                                          // xy+wz xz+wy yz+wx
+        const __m128 minus = _mm_sub_ps(p, w);                                         // xy-wz xz-wy yz-wx
+
+        // Lane 3 of minus is exactly zero, the other vectors carry w terms there that get blended out
+        const __m128 zero = _mm_setzero_ps();
+        const __m128 r0 = _mm_blend_ps(_mm_shuffle_ps(_mm_unpacklo_ps(diag, minus), plus, _MM_SHUFFLE(3, 1, 1, 0)), zero, 0b1000);
+        const __m128 r1 = _mm_shuffle_ps(_mm_unpacklo_ps(plus, diag), minus, _MM_SHUFFLE(3, 2, 3, 0));
+        const __m128 r2 = _mm_blend_ps(_mm_shuffle_ps(_mm_shuffle_ps(minus, plus, _MM_SHUFFLE(2, 2, 1, 1)), diag,
+                                                      _MM_SHUFFLE(3, 2, 2, 0)), zero, 0b1000);
+        sse::StoreRows(out, r0, r1, r2, _mm_setr_ps(0.0f, 0.0f, 0.0f, 1.0f));
+    }
+#else
+    using scalar::QuatMul;
+    using scalar::QuatRotate;
+    using scalar::QuatNlerp;
+    using scalar::QuatSlerp;
+    using scalar::QuatToMat4;
+#endif
+
+    /**
+     * @brief SlerpWeights for FloatLanes pairs at once
+     */
+    inline void SlerpWeightsN(FloatN t, FloatN cosA, FloatN& f0, FloatN& f1) noexcept
+    {
+        const FloatN one = SplatN(1.0f);
+        const FloatN xm1 = SubN(cosA, one);
+        const FloatN d = SubN(one, t);
+        const FloatN sqrT = MulN(t, t);
+        const FloatN sqrD = MulN(d, d);
+
+        FloatN bt = one;
+        FloatN bd = one;
+        for (size_t i = SlerpTerms; i-- > 0;)
+        {
+            const FloatN u = SplatN(SlerpU[i]);
+            const FloatN v = SplatN(SlerpV[i]);
+            bt = MulAddN(MulN(SubN(MulN(u, sqrT), v), xm1), bt, one);
+            bd = MulAddN(MulN(SubN(MulN(u, sqrD), v), xm1), bd, one);
+        }
+
+        f0 = MulN(d, bd);
+        f1 = MulN(t, bt);
+    }
+}
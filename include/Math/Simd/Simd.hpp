@@ -0,0 +1,484 @@
+/*
+ * Project: TestProject
+ * File: Simd.hpp
+ * Author: olegfresi
+ * Created: 16/10/26 09:12
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <bit>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+
+/*  SIMD backend selection
+ *
+ *  The math kernels are compiled for exactly one backend, chosen at compile time from the
+ *  instruction sets the compiler is allowed to use (see the LUX_SIMD CMake option):
+ *
+ *      LUX_SIMD_AVX2    256 bit AVX2 + FMA kernels (implies LUX_SIMD_SSE4)
+ *      LUX_SIMD_SSE4    128 bit SSE4.1 kernels
+ *      LUX_SIMD_SCALAR  portable scalar kernels, always available
+ *
+ *  Defining LUX_SIMD_SCALAR by hand forces the scalar kernels on every target. MSVC has no
+ *  switch for SSE4.1 and x64 only guarantees SSE2, so without /arch:AVX or higher the SSE4
+ *  kernels are used only when LUX_SIMD_SSE4 is defined by hand (CMake does it for LUX_SIMD=SSE4).
+ *--------------------------------------------------------------------------------*/
+#if !defined(LUX_SIMD_SCALAR) && !defined(LUX_SIMD_SSE4)
+    #if defined(__AVX2__) && (defined(__FMA__) || defined(_MSC_VER))
+        #define LUX_SIMD_AVX2
+        #define LUX_SIMD_SSE4
+    #elif defined(__SSE4_1__) || (defined(_MSC_VER) && defined(__AVX__))
+        #define LUX_SIMD_SSE4
+    #else
+        #define LUX_SIMD_SCALAR
+    #endif
+#endif
+
+#if defined(LUX_SIMD_SSE4)
+    #include <immintrin.h>
+#endif
+
+namespace lux::math::simd
+{
+    enum class Backend : uint8_t
+    {
+        SCALAR,
+        SSE4,
+        AVX2
+    };
+
+    static constexpr Backend ActiveBackend = []
+    {
+#if defined(LUX_SIMD_AVX2)
+        return Backend::AVX2;
+#elif defined(LUX_SIMD_SSE4)
+        return Backend::SSE4;
+#else
+        return Backend::SCALAR;
+#endif
+    }();
+
+    /**
+     * @brief Number of float lanes processed per step by the active backend
+     */
+    static constexpr size_t FloatLanes = ActiveBackend == Backend::AVX2 ? 8 : ActiveBackend == Backend::SSE4 ? 4 : 1;
+
+    [[nodiscard]] constexpr const char* BackendName() noexcept
+    {
+        switch (ActiveBackend)
+        {
+            case Backend::AVX2: return "AVX2";
+            case Backend::SSE4: return "SSE4";
+            default: return "Scalar";
+        }
+    }
+}
+
+/*  Wide float layer
+ *
+ *  FloatN is the widest float register of the active backend (a plain float for the scalar
+ *  one) and the ...N helpers below are the operations the batch kernels are written with,
+ *  so each kernel is written once and processes FloatLanes elements per step.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math::simd
+{
+#if defined(LUX_SIMD_AVX2)
+    using FloatN = __m256;
+
+    [[nodiscard]] inline FloatN LoadN(const float* p) noexcept { return _mm256_loadu_ps(p); }
+    inline void StoreN(float* p, FloatN v) noexcept { _mm256_storeu_ps(p, v); }
+    [[nodiscard]] inline FloatN SplatN(float v) noexcept { return _mm256_set1_ps(v); }
+    [[nodiscard]] inline FloatN AddN(FloatN a, FloatN b) noexcept { return _mm256_add_ps(a, b); }
+    [[nodiscard]] inline FloatN SubN(FloatN a, FloatN b) noexcept { return _mm256_sub_ps(a, b); }
+    [[nodiscard]] inline FloatN MulN(FloatN a, FloatN b) noexcept { return _mm256_mul_ps(a, b); }
+    [[nodiscard]] inline FloatN MulAddN(FloatN a, FloatN b, FloatN c) noexcept { return _mm256_fmadd_ps(a, b, c); }
+    [[nodiscard]] inline FloatN MinN(FloatN a, FloatN b) noexcept { return _mm256_min_ps(a, b); }
+    [[nodiscard]] inline FloatN MaxN(FloatN a, FloatN b) noexcept { return _mm256_max_ps(a, b); }
+    [[nodiscard]] inline FloatN AbsN(FloatN a) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a); }
+    [[nodiscard]] inline FloatN DivN(FloatN a, FloatN b) noexcept { return _mm256_div_ps(a, b); }
+    [[nodiscard]] inline FloatN SqrtN(FloatN a) noexcept { return _mm256_sqrt_ps(a); }
+    [[nodiscard]] inline FloatN RsqrtEstimateN(FloatN a) noexcept { return _mm256_rsqrt_ps(a); }
+    [[nodiscard]] inline FloatN SignN(FloatN a) noexcept { return _mm256_and_ps(_mm256_set1_ps(-0.0f), a); }
+    [[nodiscard]] inline FloatN XorN(FloatN a, FloatN b) noexcept { return _mm256_xor_ps(a, b); }
+    [[nodiscard]] inline FloatN AndN(FloatN a, FloatN b) noexcept { return _mm256_and_ps(a, b); }
+    [[nodiscard]] inline FloatN LessN(FloatN a, FloatN b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LT_OQ); }
+    [[nodiscard]] inline FloatN LessEqualN(FloatN a, FloatN b) noexcept { return _mm256_cmp_ps(a, b, _CMP_LE_OQ); }
+    [[nodiscard]] inline FloatN SelectN(FloatN mask, FloatN a, FloatN b) noexcept { return _mm256_blendv_ps(b, a, mask); }
+    [[nodiscard]] inline uint32_t MaskBitsN(FloatN mask) noexcept { return static_cast<uint32_t>(_mm256_movemask_ps(mask)); }
+#elif defined(LUX_SIMD_SSE4)
+    using FloatN = __m128;
+
+    [[nodiscard]] inline FloatN LoadN(const float* p) noexcept { return _mm_loadu_ps(p); }
+    inline void StoreN(float* p, FloatN v) noexcept { _mm_storeu_ps(p, v); }
+    [[nodiscard]] inline FloatN SplatN(float v) noexcept { return _mm_set1_ps(v); }
+    [[nodiscard]] inline FloatN AddN(FloatN a, FloatN b) noexcept { return _mm_add_ps(a, b); }
+    [[nodiscard]] inline FloatN SubN(FloatN a, FloatN b) noexcept { return _mm_sub_ps(a, b); }
+    [[nodiscard]] inline FloatN MulN(FloatN a, FloatN b) noexcept { return _mm_mul_ps(a, b); }
+    [[nodiscard]] inline FloatN MulAddN(FloatN a, FloatN b, FloatN c) noexcept { return _mm_add_ps(_mm_mul_ps(a, b), c); }
+    [[nodiscard]] inline FloatN MinN(FloatN a, FloatN b) noexcept { return _mm_min_ps(a, b); }
+    [[nodiscard]] inline FloatN MaxN(FloatN a, FloatN b) noexcept { return _mm_max_ps(a, b); }
+    [[nodiscard]] inline FloatN AbsN(FloatN a) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a); }
+    [[nodiscard]] inline FloatN DivN(FloatN a, FloatN b) noexcept { return _mm_div_ps(a, b); }
+    [[nodiscard]] inline FloatN SqrtN(FloatN a) noexcept { return _mm_sqrt_ps(a); }
+    [[nodiscard]] inline FloatN RsqrtEstimateN(FloatN a) noexcept { return _mm_rsqrt_ps(a); }
+    [[nodiscard]] inline FloatN SignN(FloatN a) noexcept { return _mm_and_ps(_mm_set1_ps(-0.0f), a); }
+    [[nodiscard]] inline FloatN XorN(FloatN a, FloatN b) noexcept { return _mm_xor_ps(a, b); }
+    [[nodiscard]] inline FloatN AndN(FloatN a, FloatN b) noexcept { return _mm_and_ps(a, b); }
+    [[nodiscard]] inline FloatN LessN(FloatN a, FloatN b) noexcept { return _mm_cmplt_ps(a, b); }
+    [[nodiscard]] inline FloatN LessEqualN(FloatN a, FloatN b) noexcept { return _mm_cmple_ps(a, b); }
+    [[nodiscard]] inline FloatN SelectN(FloatN mask, FloatN a, FloatN b) noexcept { return _mm_blendv_ps(b, a, mask); }
+    [[nodiscard]] inline uint32_t MaskBitsN(FloatN mask) noexcept { return static_cast<uint32_t>(_mm_movemask_ps(mask)); }
+#else
+    using FloatN = float;
+
+    [[nodiscard]] inline FloatN LoadN(const float* p) noexcept { return *p; }
+    inline void StoreN(float* p, FloatN v) noexcept { *p = v; }
+    [[nodiscard]] inline FloatN SplatN(float v) noexcept { return v; }
+    [[nodiscard]] inline FloatN AddN(FloatN a, FloatN b) noexcept { return a + b; }
+    [[nodiscard]] inline FloatN SubN(FloatN a, FloatN b) noexcept { return a - b; }
+    [[nodiscard]] inline FloatN MulN(FloatN a, FloatN b) noexcept { return a * b; }
+    [[nodiscard]] inline FloatN MulAddN(FloatN a, FloatN b, FloatN c) noexcept { return a * b + c; }
+    [[nodiscard]] inline FloatN MinN(FloatN a, FloatN b) noexcept { return b < a ? b : a; }
+    [[nodiscard]] inline FloatN MaxN(FloatN a, FloatN b) noexcept { return a < b ? b : a; }
+    [[nodiscard]] inline FloatN AbsN(FloatN a) noexcept { return a < 0.0f ? -a : a; }
+    [[nodiscard]] inline FloatN DivN(FloatN a, FloatN b) noexcept { return a / b; }
+    [[nodiscard]] inline FloatN SqrtN(FloatN a) noexcept { return std::sqrt(a); }
+    [[nodiscard]] inline FloatN RsqrtEstimateN(FloatN a) noexcept { return 1.0f / std::sqrt(a); }
+    [[nodiscard]] inline FloatN SignN(FloatN a) noexcept { return std::bit_cast<float>(std::bit_cast<uint32_t>(a) & 0x80000000u); }
+    [[nodiscard]] inline FloatN XorN(FloatN a, FloatN b) noexcept
+    {
+        return std::bit_cast<float>(std::bit_cast<uint32_t>(a) ^ std::bit_cast<uint32_t>(b));
+    }
+
+    // Comparison results are lane masks, all bits set or all clear, as on the vector backends
+    [[nodiscard]] inline FloatN AndN(FloatN a, FloatN b) noexcept
+    {
+        return std::bit_cast<float>(std::bit_cast<uint32_t>(a) & std::bit_cast<uint32_t>(b));
+    }
+
+    [[nodiscard]] inline FloatN LessN(FloatN a, FloatN b) noexcept { return std::bit_cast<float>(a < b ? ~0u : 0u); }
+    [[nodiscard]] inline FloatN LessEqualN(FloatN a, FloatN b) noexcept { return std::bit_cast<float>(a <= b ? ~0u : 0u); }
+    [[nodiscard]] inline uint32_t MaskBitsN(FloatN mask) noexcept { return std::bit_cast<uint32_t>(mask) >> 31; }
+    [[nodiscard]] inline FloatN SelectN(FloatN mask, FloatN a, FloatN b) noexcept { return MaskBitsN(mask) ? a : b; }
+#endif
+
+#if defined(LUX_SIMD_SSE4)
+    namespace sse
+    {
+        // p holds x0 y0 z0 x1 | y1 z1 x2 y2 | z2 x3 y3 z3
+        inline void LoadInterleaved3(const float* p, __m128& x, __m128& y, __m128& z) noexcept
+        {
+            const __m128 a = _mm_loadu_ps(p);
+            const __m128 b = _mm_loadu_ps(p + 4);
+            const __m128 c = _mm_loadu_ps(p + 8);
+
+            x = _mm_blend_ps(_mm_blend_ps(a, b, 0b0100), c, 0b0010);
+            y = _mm_blend_ps(_mm_blend_ps(b, a, 0b0010), c, 0b0100);
+            z = _mm_blend_ps(_mm_blend_ps(c, a, 0b0100), b, 0b0010);
+
+            x = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+            y = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+            z = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+        }
+
+        inline void StoreInterleaved3(float* p, __m128 x, __m128 y, __m128 z) noexcept
+        {
+            x = _mm_shuffle_ps(x, x, _MM_SHUFFLE(1, 2, 3, 0));
+            y = _mm_shuffle_ps(y, y, _MM_SHUFFLE(2, 3, 0, 1));
+            z = _mm_shuffle_ps(z, z, _MM_SHUFFLE(3, 0, 1, 2));
+
+            _mm_storeu_ps(p, _mm_blend_ps(_mm_blend_ps(x, y, 0b0010), z, 0b0100));
+            _mm_storeu_ps(p + 4, _mm_blend_ps(_mm_blend_ps(y, z, 0b0010), x, 0b0100));
+            _mm_storeu_ps(p + 8, _mm_blend_ps(_mm_blend_ps(z, x, 0b0010), y, 0b0100));
+        }
+    }
+#endif
+
+    /**
+     * @brief Loads FloatLanes xyz triples stored back to back (an array of Vector3f) into x, y and z lanes
+     */
+    inline void LoadInterleaved3N(const float* p, FloatN& x, FloatN& y, FloatN& z) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        __m128 x0, y0, z0, x1, y1, z1;
+        sse::LoadInterleaved3(p, x0, y0, z0);
+        sse::LoadInterleaved3(p + 12, x1, y1, z1);
+        x = _mm256_set_m128(x1, x0);
+        y = _mm256_set_m128(y1, y0);
+        z = _mm256_set_m128(z1, z0);
+#elif defined(LUX_SIMD_SSE4)
+        sse::LoadInterleaved3(p, x, y, z);
+#else
+        x = p[0];
+        y = p[1];
+        z = p[2];
+#endif
+    }
+
+    inline void StoreInterleaved3N(float* p, FloatN x, FloatN y, FloatN z) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        sse::StoreInterleaved3(p, _mm256_castps256_ps128(x), _mm256_castps256_ps128(y), _mm256_castps256_ps128(z));
+        sse::StoreInterleaved3(p + 12, _mm256_extractf128_ps(x, 1), _mm256_extractf128_ps(y, 1),
+                               _mm256_extractf128_ps(z, 1));
+#elif defined(LUX_SIMD_SSE4)
+        sse::StoreInterleaved3(p, x, y, z);
+#else
+        p[0] = x;
+        p[1] = y;
+        p[2] = z;
+#endif
+    }
+}
+
+namespace lux::math::simd
+{
+    /**
+     * @brief Splits the lanes of a:b into the even and the odd ones
+     *
+     * Used to separate records of two Vector3f (min/max pairs) after LoadInterleaved3N. The
+     * lane order of the halves is backend specific; InterleaveEvenOddN restores it exactly.
+     */
+    inline void DeinterleaveEvenOddN(FloatN a, FloatN b, FloatN& even, FloatN& odd) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        even = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        odd = _mm256_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+#elif defined(LUX_SIMD_SSE4)
+        even = _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0));
+        odd = _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1));
+#else
+        even = a;
+        odd = b;
+#endif
+    }
+
+    inline void InterleaveEvenOddN(FloatN even, FloatN odd, FloatN& a, FloatN& b) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        a = _mm256_unpacklo_ps(even, odd);
+        b = _mm256_unpackhi_ps(even, odd);
+#elif defined(LUX_SIMD_SSE4)
+        a = _mm_unpacklo_ps(even, odd);
+        b = _mm_unpackhi_ps(even, odd);
+#else
+        a = even;
+        b = odd;
+#endif
+    }
+}
+
+namespace lux::math::simd
+{
+    /**
+     * @brief Loads p[k * stride] into lane k, for reading one field out of an array of records
+     */
+    [[nodiscard]] inline FloatN LoadStridedN(const float* p, size_t stride) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        const __m256i s = _mm256_set1_epi32(static_cast<int>(stride));
+        const __m256i index = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), s);
+        return _mm256_i32gather_ps(p, index, 4);
+#elif defined(LUX_SIMD_SSE4)
+        return _mm_setr_ps(p[0], p[stride], p[2 * stride], p[3 * stride]);
+#else
+        (void)stride;
+        return *p;
+#endif
+    }
+
+    /**
+     * @brief Loads p[indices[k]] into lane k
+     */
+    [[nodiscard]] inline FloatN GatherN(const float* p, const uint32_t* indices) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        return _mm256_i32gather_ps(p, _mm256_loadu_si256(reinterpret_cast<const __m256i*>(indices)), 4);
+#elif defined(LUX_SIMD_SSE4)
+        return _mm_setr_ps(p[indices[0]], p[indices[1]], p[indices[2]], p[indices[3]]);
+#else
+        return p[*indices];
+#endif
+    }
+
+    [[nodiscard]] inline FloatN FloorN(FloatN a) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        return _mm256_floor_ps(a);
+#elif defined(LUX_SIMD_SSE4)
+        return _mm_floor_ps(a);
+#else
+        return std::floor(a);
+#endif
+    }
+
+    /**
+     * @brief Stores the lanes truncated to integers, for feeding GatherN with indices computed in SIMD
+     */
+    inline void StoreIndicesN(uint32_t* out, FloatN a) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), _mm256_cvttps_epi32(a));
+#elif defined(LUX_SIMD_SSE4)
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_cvttps_epi32(a));
+#else
+        *out = static_cast<uint32_t>(a);
+#endif
+    }
+
+    /**
+     * @brief Reads the four consecutive floats at p + k * stride into lane k of a, b, c, d
+     */
+    inline void LoadLaneQuadsN(const float* p, size_t stride, FloatN& a, FloatN& b, FloatN& c, FloatN& d) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        auto pair = [&](size_t k)
+        {
+            return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p + k * stride)),
+                                        _mm_loadu_ps(p + (k + 4) * stride), 1);
+        };
+
+        const __m256 q0 = pair(0);
+        const __m256 q1 = pair(1);
+        const __m256 q2 = pair(2);
+        const __m256 q3 = pair(3);
+
+        const __m256 t0 = _mm256_unpacklo_ps(q0, q1);
+        const __m256 t1 = _mm256_unpackhi_ps(q0, q1);
+        const __m256 t2 = _mm256_unpacklo_ps(q2, q3);
+        const __m256 t3 = _mm256_unpackhi_ps(q2, q3);
+
+        a = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+        b = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+        c = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+        d = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+#elif defined(LUX_SIMD_SSE4)
+        a = _mm_loadu_ps(p);
+        b = _mm_loadu_ps(p + stride);
+        c = _mm_loadu_ps(p + 2 * stride);
+        d = _mm_loadu_ps(p + 3 * stride);
+        _MM_TRANSPOSE4_PS(a, b, c, d);
+#else
+        (void)stride;
+        a = p[0];
+        b = p[1];
+        c = p[2];
+        d = p[3];
+#endif
+    }
+
+    /**
+     * @brief Writes the lane k values of a, b, c, d as four consecutive floats at out + k * stride
+     */
+    inline void StoreLaneQuadsN(float* out, size_t stride, FloatN a, FloatN b, FloatN c, FloatN d) noexcept
+    {
+#if defined(LUX_SIMD_AVX2)
+        const __m256 ab0 = _mm256_unpacklo_ps(a, b);
+        const __m256 ab1 = _mm256_unpackhi_ps(a, b);
+        const __m256 cd0 = _mm256_unpacklo_ps(c, d);
+        const __m256 cd1 = _mm256_unpackhi_ps(c, d);
+
+        // each 128 bit half now holds the quads of lanes k and k + 4
+        const __m256 q0 = _mm256_shuffle_ps(ab0, cd0, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 q1 = _mm256_shuffle_ps(ab0, cd0, _MM_SHUFFLE(3, 2, 3, 2));
+        const __m256 q2 = _mm256_shuffle_ps(ab1, cd1, _MM_SHUFFLE(1, 0, 1, 0));
+        const __m256 q3 = _mm256_shuffle_ps(ab1, cd1, _MM_SHUFFLE(3, 2, 3, 2));
+
+        _mm_storeu_ps(out, _mm256_castps256_ps128(q0));
+        _mm_storeu_ps(out + stride, _mm256_castps256_ps128(q1));
+        _mm_storeu_ps(out + 2 * stride, _mm256_castps256_ps128(q2));
+        _mm_storeu_ps(out + 3 * stride, _mm256_castps256_ps128(q3));
+        _mm_storeu_ps(out + 4 * stride, _mm256_extractf128_ps(q0, 1));
+        _mm_storeu_ps(out + 5 * stride, _mm256_extractf128_ps(q1, 1));
+        _mm_storeu_ps(out + 6 * stride, _mm256_extractf128_ps(q2, 1));
+        _mm_storeu_ps(out + 7 * stride, _mm256_extractf128_ps(q3, 1));
+#elif defined(LUX_SIMD_SSE4)
+        _MM_TRANSPOSE4_PS(a, b, c, d);
+        _mm_storeu_ps(out, a);
+        _mm_storeu_ps(out + stride, b);
+        _mm_storeu_ps(out + 2 * stride, c);
+        _mm_storeu_ps(out + 3 * stride, d);
+#else
+        (void)stride;
+        out[0] = a;
+        out[1] = b;
+        out[2] = c;
+        out[3] = d;
+#endif
+    }
+}
+
+/*  Wide integer layer
+ *
+ *  IntN holds FloatLanes unsigned 32 bit lanes, only as much as the packing kernels need:
+ *  round the floats to integers, move them into their bit field and merge the fields.
+ *  AsFloatN reinterprets the bits, so packed records can go through StoreLaneQuadsN.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math::simd
+{
+#if defined(LUX_SIMD_AVX2)
+    using IntN = __m256i;
+
+    [[nodiscard]] inline IntN RoundToIntN(FloatN a) noexcept { return _mm256_cvtps_epi32(a); }
+    [[nodiscard]] inline IntN OrN(IntN a, IntN b) noexcept { return _mm256_or_si256(a, b); }
+    inline void StoreIntN(uint32_t* out, IntN a) noexcept { _mm256_storeu_si256(reinterpret_cast<__m256i*>(out), a); }
+    [[nodiscard]] inline FloatN AsFloatN(IntN a) noexcept { return _mm256_castsi256_ps(a); }
+
+    template<int Bits>
+    [[nodiscard]] inline IntN ShiftLeftN(IntN a) noexcept { return _mm256_slli_epi32(a, Bits); }
+
+    template<int Bits>
+    [[nodiscard]] inline IntN ShiftRightN(IntN a) noexcept { return _mm256_srli_epi32(a, Bits); }
+#elif defined(LUX_SIMD_SSE4)
+    using IntN = __m128i;
+
+    [[nodiscard]] inline IntN RoundToIntN(FloatN a) noexcept { return _mm_cvtps_epi32(a); }
+    [[nodiscard]] inline IntN OrN(IntN a, IntN b) noexcept { return _mm_or_si128(a, b); }
+    inline void StoreIntN(uint32_t* out, IntN a) noexcept { _mm_storeu_si128(reinterpret_cast<__m128i*>(out), a); }
+    [[nodiscard]] inline FloatN AsFloatN(IntN a) noexcept { return _mm_castsi128_ps(a); }
+
+    template<int Bits>
+    [[nodiscard]] inline IntN ShiftLeftN(IntN a) noexcept { return _mm_slli_epi32(a, Bits); }
+
+    template<int Bits>
+    [[nodiscard]] inline IntN ShiftRightN(IntN a) noexcept { return _mm_srli_epi32(a, Bits); }
+#else
+    using IntN = uint32_t;
+
+    // lrint rounds half to even in the default rounding mode, like cvtps2dq
+    [[nodiscard]] inline IntN RoundToIntN(FloatN a) noexcept { return static_cast<uint32_t>(std::lrint(a)); }
+    [[nodiscard]] inline IntN OrN(IntN a, IntN b) noexcept { return a | b; }
+    inline void StoreIntN(uint32_t* out, IntN a) noexcept { *out = a; }
+    [[nodiscard]] inline FloatN AsFloatN(IntN a) noexcept { return std::bit_cast<float>(a); }
+
+    template<int Bits>
+    [[nodiscard]] inline IntN ShiftLeftN(IntN a) noexcept { return a << Bits; }
+
+    template<int Bits>
+    [[nodiscard]] inline IntN ShiftRightN(IntN a) noexcept { return a >> Bits; }
+#endif
+}
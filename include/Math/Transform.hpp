@@ -29,17 +29,266 @@
  * SOFTWARE.
  */
 #pragma once
-
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <vector>
 #include "Matrix.hpp"
+#include "Quaternion.hpp"
+#include "Simd/Simd.hpp"
 
 namespace lux::math
 {
-    struct Transform
+    /*  Transform
+     *
+     *  Position, rotation and scale stored as 40 bytes of TRS data. The model matrix is built
+     *  straight from the quaternion as T * R * S (translation in the last column, the layout the
+     *  shaders expect) and cached; setters only mark the cache dirty, so a transform that does
+     *  not move costs nothing per frame. ComposeMatrices builds the packed GPU matrices for a
+     *  whole span of transforms at once, or for an index list into one.
+     *--------------------------------------------------------------------------------*/
+    class Transform
     {
-        Matrix4f translation;
-        Matrix4f scale;
-        Matrix4f rotation;
+    public:
+        Transform() = default;
+
+        explicit Transform(const Vector3f& position, const Qf& rotation = Qf_1,
+                           const Vector3f& scale = Vector3f{1.0f, 1.0f, 1.0f}) noexcept
+            : m_position{position}, m_rotation{rotation}, m_scale{scale} {}
+
+        [[nodiscard]] const Vector3f& GetPosition() const noexcept { return m_position; }
+        [[nodiscard]] const Qf& GetRotation() const noexcept { return m_rotation; }
+        [[nodiscard]] const Vector3f& GetScale() const noexcept { return m_scale; }
+
+        void SetPosition(const Vector3f& position) noexcept
+        {
+            m_position = position;
+            m_dirty = true;
+        }
+
+        /**
+         * @brief Sets the rotation, expected to be a unit quaternion
+         */
+        void SetRotation(const Qf& rotation) noexcept
+        {
+            m_rotation = rotation;
+            m_dirty = true;
+        }
+
+        void SetScale(const Vector3f& scale) noexcept
+        {
+            m_scale = scale;
+            m_dirty = true;
+        }
+
+        void Translate(const Vector3f& delta) noexcept
+        {
+            m_position = m_position + delta;
+            m_dirty = true;
+        }
+
+        /**
+         * @brief Applies rotation on top of the current one (in world space)
+         */
+        void Rotate(const Qf& rotation) noexcept
+        {
+            m_rotation = rotation * m_rotation;
+            m_dirty = true;
+        }
+
+        /**
+         * @brief Returns the cached model matrix, recomposing it only if a setter ran since the last call
+         */
+        [[nodiscard]] const Matrix4f& GetMatrix() const noexcept
+        {
+            if (m_dirty)
+            {
+                m_matrix = ToMatrix4();
+                m_dirty = false;
+            }
+
+            return m_matrix;
+        }
+
+        /**
+         * @brief Composes T * R * S, tagged AFFINE (RIGID for unit scale) so Inverse() takes the fast path
+         */
+        [[nodiscard]] Matrix4f ToMatrix4() const noexcept
+        {
+            std::array<float, 16> rows;
+            ComposeRows(rows.data());
 
-        Matrix4f ToMatrix4() const { return translation * rotation * scale; }
+            const bool unitScale = m_scale.GetX() == 1.0f && m_scale.GetY() == 1.0f && m_scale.GetZ() == 1.0f;
+            return Matrix4f::FromData(rows.data(), unitScale ? MatShape::RIGID : MatShape::AFFINE);
+        }
+
+        friend void ComposeMatrices(std::span<const Transform> transforms, std::span<PackedMatrix4f> out) noexcept;
+        friend void ComposeMatrices(std::span<const Transform> transforms, std::span<const uint32_t> indices,
+                                    std::span<PackedMatrix4f> out) noexcept;
+
+    private:
+        Vector3f m_position;
+        Qf m_rotation = Qf_1;
+        Vector3f m_scale {1.0f, 1.0f, 1.0f};
+
+        mutable Matrix4f m_matrix;
+        mutable bool m_dirty = true;
+
+        // Row-major T * R * S
+        void ComposeRows(float* rows) const noexcept
+        {
+            const float w = m_rotation.A();
+            const float x = m_rotation.B();
+            const float y = m_rotation.C();
+            const float z = m_rotation.D();
+
+            const float sx = m_scale.GetX();
+            const float sy = m_scale.GetY();
+            const float sz = m_scale.GetZ();
+
+            const float xx = x * x, yy = y * y, zz = z * z;
+            const float xy = x * y, xz = x * z, yz = y * z;
+            const float wx = w * x, wy = w * y, wz = w * z;
+
+            rows[0] = (1.0f - 2.0f * (yy + zz)) * sx;
+            rows[1] = 2.0f * (xy - wz) * sy;
+            rows[2] = 2.0f * (xz + wy) * sz;
+            rows[3] = m_position.GetX();
+
+            rows[4] = 2.0f * (xy + wz) * sx;
+            rows[5] = (1.0f - 2.0f * (xx + zz)) * sy;
+            rows[6] = 2.0f * (yz - wx) * sz;
+            rows[7] = m_position.GetY();
+
+            rows[8] = 2.0f * (xz - wy) * sx;
+            rows[9] = 2.0f * (yz + wx) * sy;
+            rows[10] = (1.0f - 2.0f * (xx + yy)) * sz;
+            rows[11] = m_position.GetZ();
+
+            rows[12] = 0.0f;
+            rows[13] = 0.0f;
+            rows[14] = 0.0f;
+            rows[15] = 1.0f;
+        }
     };
+
+    namespace detail
+    {
+        /**
+         * @brief Builds FloatLanes packed matrices at dst, field(k) loads TRS float k (position, rotation wxyz, scale) of every lane
+         */
+        template<typename LoadField>
+        inline void ComposeMatrixLanes(LoadField&& field, float* dst) noexcept
+        {
+            using namespace simd;
+
+            const FloatN px = field(0);
+            const FloatN py = field(1);
+            const FloatN pz = field(2);
+            const FloatN w = field(3);
+            const FloatN x = field(4);
+            const FloatN y = field(5);
+            const FloatN z = field(6);
+            const FloatN sx = field(7);
+            const FloatN sy = field(8);
+            const FloatN sz = field(9);
+
+            const FloatN one = SplatN(1.0f);
+            const FloatN two = SplatN(2.0f);
+            const FloatN zero = SplatN(0.0f);
+
+            const FloatN x2 = MulN(x, two), y2 = MulN(y, two), z2 = MulN(z, two);
+            const FloatN xx = MulN(x, x2), yy = MulN(y, y2), zz = MulN(z, z2);
+            const FloatN xy = MulN(x, y2), xz = MulN(x, z2), yz = MulN(y, z2);
+            const FloatN wx = MulN(w, x2), wy = MulN(w, y2), wz = MulN(w, z2);
+
+            constexpr size_t outStride = sizeof(PackedMatrix4f) / sizeof(float);
+
+            StoreLaneQuadsN(dst, outStride,
+                            MulN(SubN(one, AddN(yy, zz)), sx), MulN(AddN(xy, wz), sx), MulN(SubN(xz, wy), sx), zero);
+            StoreLaneQuadsN(dst + 4, outStride,
+                            MulN(SubN(xy, wz), sy), MulN(SubN(one, AddN(xx, zz)), sy), MulN(AddN(yz, wx), sy), zero);
+            StoreLaneQuadsN(dst + 8, outStride,
+                            MulN(AddN(xz, wy), sz), MulN(SubN(yz, wx), sz), MulN(SubN(one, AddN(xx, yy)), sz), zero);
+            StoreLaneQuadsN(dst + 12, outStride, px, py, pz, one);
+        }
+    }
+
+    /**
+     * @brief Composes the GPU matrix of every transform, lane-parallel over the transforms
+     *
+     * Does not read or update the per-transform cache. out[i] equals PackedMatrix4f::From(transforms[i].ToMatrix4()).
+     */
+    inline void ComposeMatrices(std::span<const Transform> transforms, std::span<PackedMatrix4f> out) noexcept
+    {
+        static_assert(std::is_standard_layout_v<Transform>);
+        static_assert(offsetof(Transform, m_position) == 0 && offsetof(Transform, m_rotation) == 12 &&
+                      offsetof(Transform, m_scale) == 28 && offsetof(Transform, m_matrix) == 40,
+                      "Transform: position, rotation and scale must be 40 packed bytes");
+        static_assert(sizeof(Transform) % sizeof(float) == 0);
+
+        CORE_ASSERT(out.size() >= transforms.size(), "ComposeMatrices: output span too small")
+
+        constexpr size_t L = simd::FloatLanes;
+        constexpr size_t stride = sizeof(Transform) / sizeof(float);
+
+        const size_t count = transforms.size();
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            const float* src = reinterpret_cast<const float*>(transforms.data() + i);
+            detail::ComposeMatrixLanes([&](size_t k) { return simd::LoadStridedN(src + k, stride); }, out[i].data.data());
+        }
+
+        for (; i < count; ++i)
+        {
+            float rows[16];
+            transforms[i].ComposeRows(rows);
+            simd::Mat4Transpose(rows, out[i].data.data());
+        }
+    }
+
+    /**
+     * @brief Composes the GPU matrix of transforms[indices[i]] into out[i], e.g. for the survivors of a cull
+     *
+     * Gathers the TRS fields straight from transforms, nothing is copied out first.
+     */
+    inline void ComposeMatrices(std::span<const Transform> transforms, std::span<const uint32_t> indices,
+                                std::span<PackedMatrix4f> out) noexcept
+    {
+        CORE_ASSERT(out.size() >= indices.size(), "ComposeMatrices: output span too small")
+
+        constexpr size_t L = simd::FloatLanes;
+        constexpr uint32_t stride = sizeof(Transform) / sizeof(float);
+
+        const float* src = reinterpret_cast<const float*>(transforms.data());
+        const size_t count = indices.size();
+        size_t i = 0;
+
+        for (; i + L <= count; i += L)
+        {
+            std::array<uint32_t, L> offsets;
+            for (size_t lane = 0; lane < L; ++lane)
+                offsets[lane] = indices[i + lane] * stride;
+
+            detail::ComposeMatrixLanes([&](size_t k) { return simd::GatherN(src + k, offsets.data()); }, out[i].data.data());
+        }
+
+        for (; i < count; ++i)
+        {
+            float rows[16];
+            transforms[indices[i]].ComposeRows(rows);
+            simd::Mat4Transpose(rows, out[i].data.data());
+        }
+    }
+
+    [[nodiscard]] inline std::vector<PackedMatrix4f> ComposeMatrices(std::span<const Transform> transforms)
+    {
+        std::vector<PackedMatrix4f> packed(transforms.size());
+        ComposeMatrices(transforms, packed);
+        return packed;
+    }
 }
@@ -32,6 +32,7 @@
 #pragma once
 #include <array>
 #include "../Application/Assertion.hpp"
+#include "MathChecks.hpp"
 
 namespace lux::math
 {
@@ -122,10 +123,10 @@ namespace lux::math
          * @brief Array-style access to vector components
          * @param index Index of the component (0=x, 1=y)
          * @return Reference to the component
-         * @throw std::out_of_range if index is out of bounds
+         * @throw std::out_of_range if index is out of bounds and LUX_MATH_CHECKS is on
          */
         constexpr T &operator[](size_t index) {
-            if (index >= 2)
+            if (CheckedAccess && index >= 2)
                 throw std::out_of_range("Index out of range in vector2 access");
             return m_comp[index];
         }
@@ -134,10 +135,10 @@ namespace lux::math
          * @brief Const array-style access to vector components
          * @param index Index of the component (0=x, 1=y)
          * @return Const reference to the component
-         * @throw std::out_of_range if index is out of bounds
+         * @throw std::out_of_range if index is out of bounds and LUX_MATH_CHECKS is on
          */
         constexpr const T &operator[](size_t index) const {
-            if (index >= 2)
+            if (CheckedAccess && index >= 2)
                 throw std::out_of_range("Index out of range in vector2 access");
             return m_comp[index];
         }
@@ -88,7 +88,7 @@ namespace lux::math
 
         constexpr T& operator[](size_t index)
         {
-            if (index >= N)
+            if (CheckedAccess && index >= N)
             {
                 CORE_ERROR( "Out of range access: index {0} for Vector3", index );
                 throw std::out_of_range( "Index out of range in vector3 access" );
@@ -99,7 +99,7 @@ namespace lux::math
 
         constexpr const T& operator[](size_t index) const
         {
-            if (index >= N)
+            if (CheckedAccess && index >= N)
             {
                 CORE_ERROR( "Out of range access: index {0} for Vector3", index );
                 throw std::out_of_range( "Index out of range in vector3 access" );
@@ -52,47 +52,24 @@ namespace lux::math
         explicit constexpr Vector4(const Vector2<T>& v1, const Vector2<T>& v2) noexcept :
                                     x(v1.GetX()), y(v1.GetY()), z(v2.GetX()), w(v2.GetY()) {}
 
-        constexpr Vector4(const Vector4& other) noexcept : x(other.x), y(other.y), z(other.z), w(other.w) {}
+        constexpr Vector4(const Vector4& other) noexcept = default;
 
-        constexpr Vector4(Vector4&& other) noexcept : x(std::move(other.x)), y(std::move(other.y)),
-                                                      z(std::move(other.z)), w(std::move(other.w)) {}
+        constexpr Vector4(Vector4&& other) noexcept = default;
 
-        constexpr Vector4 &operator=(const Vector4 &other) noexcept
-        {
-            if (this != &other)
-            {
-                x = other.x;
-                y = other.y;
-                z = other.z;
-                w = other.w;
-            }
-
-            return *this;
-        }
+        constexpr Vector4 &operator=(const Vector4 &other) noexcept = default;
 
-        constexpr Vector4& operator=(Vector4 &&other) noexcept
-        {
-            if (this != &other)
-            {
-                x = other.x;
-                y = other.y;
-                z = other.z;
-                w = other.w;
-            }
-
-            return *this;
-        }
+        constexpr Vector4& operator=(Vector4 &&other) noexcept = default;
 
         constexpr T& operator[](size_t index)
         {
-            if(index >= N)
+            if (CheckedAccess && index >= N)
                 throw std::out_of_range("Index out of range");
 
             return ((&x)[index]);
         }
         constexpr const T &operator[](size_t index) const
         {
-            if(index >= N)
+            if (CheckedAccess && index >= N)
                 throw std::out_of_range("Index out of range");
 
             return ((&x)[index]);
@@ -0,0 +1,371 @@
+/*
+ * Project: TestProject
+ * File: VectorPacket.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 09:40
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <array>
+#include <span>
+#include "FastMath.hpp"
+#include "Vector.hpp"
+#include "Simd/Simd.hpp"
+#include "../Application/Assertion.hpp"
+
+/*  Vector packets
+ *
+ *  Vector3Packet and Vector4Packet hold simd::FloatLanes vectors (8 with AVX2, 4 with SSE4.1,
+ *  1 for the scalar backend) with every component in its own register, so a kernel written
+ *  against them once runs one vector per lane. They are meant for the inner loops of culling,
+ *  particles and light assignment where Vector3f's checked operator[] gets in the way.
+ *
+ *  Lane masks are plain simd::FloatN values as produced by simd::LessN and friends, all ones
+ *  for true and all zeros for false, and feed Select(). Loads and stores read and write
+ *  Vector3f / Vector4f arrays directly; the Partial variants handle the remainder of a span.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math
+{
+    static_assert(sizeof(Vector3f) == 3 * sizeof(float), "Vector3Packet reads Vector3f arrays as packed floats");
+    static_assert(sizeof(Vector4f) == 4 * sizeof(float), "Vector4Packet reads Vector4f arrays as packed floats");
+
+    struct Vector3Packet
+    {
+        static constexpr size_t Lanes = simd::FloatLanes;
+
+        simd::FloatN x;
+        simd::FloatN y;
+        simd::FloatN z;
+
+        Vector3Packet() noexcept : x{simd::SplatN(0.0f)}, y{simd::SplatN(0.0f)}, z{simd::SplatN(0.0f)} {}
+
+        Vector3Packet(simd::FloatN x, simd::FloatN y, simd::FloatN z) noexcept : x{x}, y{y}, z{z} {}
+
+        /**
+         * @brief Broadcasts v to every lane
+         */
+        explicit Vector3Packet(const Vector3f& v) noexcept :
+                               x{simd::SplatN(v.GetX())}, y{simd::SplatN(v.GetY())}, z{simd::SplatN(v.GetZ())} {}
+
+        /**
+         * @brief Loads vectors [first, first + Lanes) of an array of Vector3f
+         */
+        [[nodiscard]] static Vector3Packet Load(std::span<const Vector3f> vectors, size_t first) noexcept
+        {
+            CORE_ASSERT(first + Lanes <= vectors.size(), "Vector3Packet load past the end of the span")
+
+            Vector3Packet p;
+            simd::LoadInterleaved3N(reinterpret_cast<const float*>(vectors.data() + first), p.x, p.y, p.z);
+            return p;
+        }
+
+        /**
+         * @brief Loads the vectors left from first on, at most Lanes of them, the missing lanes are set to fill
+         */
+        [[nodiscard]] static Vector3Packet LoadPartial(std::span<const Vector3f> vectors, size_t first,
+                                                       const Vector3f& fill = {}) noexcept
+        {
+            CORE_ASSERT(first <= vectors.size(), "Vector3Packet load past the end of the span")
+
+            std::array<Vector3f, Lanes> lanes;
+            lanes.fill(fill);
+            std::copy_n(vectors.begin() + first, std::min(Lanes, vectors.size() - first), lanes.begin());
+            return Load(lanes, 0);
+        }
+
+        /**
+         * @brief Loads Lanes vectors from three component arrays (a SoA stream)
+         */
+        [[nodiscard]] static Vector3Packet LoadComponents(const float* xs, const float* ys, const float* zs) noexcept
+        {
+            return {simd::LoadN(xs), simd::LoadN(ys), simd::LoadN(zs)};
+        }
+
+        void Store(std::span<Vector3f> vectors, size_t first) const noexcept
+        {
+            CORE_ASSERT(first + Lanes <= vectors.size(), "Vector3Packet store past the end of the span")
+            simd::StoreInterleaved3N(reinterpret_cast<float*>(vectors.data() + first), x, y, z);
+        }
+
+        /**
+         * @brief Stores the leading lanes into the vectors left from first on, at most Lanes of them
+         */
+        void StorePartial(std::span<Vector3f> vectors, size_t first) const noexcept
+        {
+            CORE_ASSERT(first <= vectors.size(), "Vector3Packet store past the end of the span")
+
+            std::array<Vector3f, Lanes> lanes;
+            Store(lanes, 0);
+            std::copy_n(lanes.begin(), std::min(Lanes, vectors.size() - first), vectors.begin() + first);
+        }
+
+        void StoreComponents(float* xs, float* ys, float* zs) const noexcept
+        {
+            simd::StoreN(xs, x);
+            simd::StoreN(ys, y);
+            simd::StoreN(zs, z);
+        }
+
+        /**
+         * @brief Extracts one lane, meant for tests and the odd scalar fallback rather than inner loops
+         */
+        [[nodiscard]] Vector3f Lane(size_t lane) const noexcept
+        {
+            CORE_ASSERT(lane < Lanes, "Vector3Packet lane out of range")
+
+            std::array<Vector3f, Lanes> lanes;
+            Store(lanes, 0);
+            return lanes[lane];
+        }
+    };
+
+    struct Vector4Packet
+    {
+        static constexpr size_t Lanes = simd::FloatLanes;
+
+        simd::FloatN x;
+        simd::FloatN y;
+        simd::FloatN z;
+        simd::FloatN w;
+
+        Vector4Packet() noexcept : x{simd::SplatN(0.0f)}, y{simd::SplatN(0.0f)}, z{simd::SplatN(0.0f)},
+                                   w{simd::SplatN(0.0f)} {}
+
+        Vector4Packet(simd::FloatN x, simd::FloatN y, simd::FloatN z, simd::FloatN w) noexcept :
+                      x{x}, y{y}, z{z}, w{w} {}
+
+        Vector4Packet(const Vector3Packet& v, simd::FloatN w) noexcept : x{v.x}, y{v.y}, z{v.z}, w{w} {}
+
+        /**
+         * @brief Broadcasts v to every lane
+         */
+        explicit Vector4Packet(const Vector4f& v) noexcept : x{simd::SplatN(v.GetX())}, y{simd::SplatN(v.GetY())},
+                                                            z{simd::SplatN(v.GetZ())}, w{simd::SplatN(v.GetW())} {}
+
+        /**
+         * @brief Loads vectors [first, first + Lanes) of an array of Vector4f
+         */
+        [[nodiscard]] static Vector4Packet Load(std::span<const Vector4f> vectors, size_t first) noexcept
+        {
+            CORE_ASSERT(first + Lanes <= vectors.size(), "Vector4Packet load past the end of the span")
+
+            Vector4Packet p;
+            simd::LoadLaneQuadsN(reinterpret_cast<const float*>(vectors.data() + first), 4, p.x, p.y, p.z, p.w);
+            return p;
+        }
+
+        /**
+         * @brief Loads the vectors left from first on, at most Lanes of them, the missing lanes are set to fill
+         */
+        [[nodiscard]] static Vector4Packet LoadPartial(std::span<const Vector4f> vectors, size_t first,
+                                                       const Vector4f& fill = {}) noexcept
+        {
+            CORE_ASSERT(first <= vectors.size(), "Vector4Packet load past the end of the span")
+
+            std::array<Vector4f, Lanes> lanes;
+            lanes.fill(fill);
+            std::copy_n(vectors.begin() + first, std::min(Lanes, vectors.size() - first), lanes.begin());
+            return Load(lanes, 0);
+        }
+
+        void Store(std::span<Vector4f> vectors, size_t first) const noexcept
+        {
+            CORE_ASSERT(first + Lanes <= vectors.size(), "Vector4Packet store past the end of the span")
+            simd::StoreLaneQuadsN(reinterpret_cast<float*>(vectors.data() + first), 4, x, y, z, w);
+        }
+
+        /**
+         * @brief Stores the leading lanes into the vectors left from first on, at most Lanes of them
+         */
+        void StorePartial(std::span<Vector4f> vectors, size_t first) const noexcept
+        {
+            CORE_ASSERT(first <= vectors.size(), "Vector4Packet store past the end of the span")
+
+            std::array<Vector4f, Lanes> lanes;
+            Store(lanes, 0);
+            std::copy_n(lanes.begin(), std::min(Lanes, vectors.size() - first), vectors.begin() + first);
+        }
+
+        [[nodiscard]] Vector3Packet Xyz() const noexcept { return {x, y, z}; }
+
+        /**
+         * @brief Extracts one lane, meant for tests and the odd scalar fallback rather than inner loops
+         */
+        [[nodiscard]] Vector4f Lane(size_t lane) const noexcept
+        {
+            CORE_ASSERT(lane < Lanes, "Vector4Packet lane out of range")
+
+            std::array<Vector4f, Lanes> lanes;
+            Store(lanes, 0);
+            return lanes[lane];
+        }
+    };
+
+    [[nodiscard]] inline Vector3Packet operator+(const Vector3Packet& a, const Vector3Packet& b) noexcept
+    {
+        return {simd::AddN(a.x, b.x), simd::AddN(a.y, b.y), simd::AddN(a.z, b.z)};
+    }
+
+    [[nodiscard]] inline Vector3Packet operator-(const Vector3Packet& a, const Vector3Packet& b) noexcept
+    {
+        return {simd::SubN(a.x, b.x), simd::SubN(a.y, b.y), simd::SubN(a.z, b.z)};
+    }
+
+    [[nodiscard]] inline Vector3Packet operator-(const Vector3Packet& a) noexcept
+    {
+        const simd::FloatN sign = simd::SplatN(-0.0f);
+        return {simd::XorN(a.x, sign), simd::XorN(a.y, sign), simd::XorN(a.z, sign)};
+    }
+
+    [[nodiscard]] inline Vector3Packet operator*(const Vector3Packet& a, const Vector3Packet& b) noexcept
+    {
+        return {simd::MulN(a.x, b.x), simd::MulN(a.y, b.y), simd::MulN(a.z, b.z)};
+    }
+
+    [[nodiscard]] inline Vector3Packet operator*(const Vector3Packet& a, simd::FloatN s) noexcept
+    {
+        return {simd::MulN(a.x, s), simd::MulN(a.y, s), simd::MulN(a.z, s)};
+    }
+
+    [[nodiscard]] inline Vector3Packet operator*(simd::FloatN s, const Vector3Packet& a) noexcept
+    {
+        return a * s;
+    }
+
+    [[nodiscard]] inline Vector3Packet operator/(const Vector3Packet& a, simd::FloatN s) noexcept
+    {
+        return {simd::DivN(a.x, s), simd::DivN(a.y, s), simd::DivN(a.z, s)};
+    }
+
+    /**
+     * @brief a * b + c per component, fused where the backend has FMA
+     */
+    [[nodiscard]] inline Vector3Packet MulAdd(const Vector3Packet& a, simd::FloatN b, const Vector3Packet& c) noexcept
+    {
+        return {simd::MulAddN(a.x, b, c.x), simd::MulAddN(a.y, b, c.y), simd::MulAddN(a.z, b, c.z)};
+    }
+
+    [[nodiscard]] inline simd::FloatN Dot(const Vector3Packet& a, const Vector3Packet& b) noexcept
+    {
+        return simd::MulAddN(a.x, b.x, simd::MulAddN(a.y, b.y, simd::MulN(a.z, b.z)));
+    }
+
+    [[nodiscard]] inline Vector3Packet Cross(const Vector3Packet& a, const Vector3Packet& b) noexcept
+    {
+        return {simd::SubN(simd::MulN(a.y, b.z), simd::MulN(a.z, b.y)),
+                simd::SubN(simd::MulN(a.z, b.x), simd::MulN(a.x, b.z)),
+                simd::SubN(simd::MulN(a.x, b.y), simd::MulN(a.y, b.x))};
+    }
+
+    [[nodiscard]] inline simd::FloatN LengthSquared(const Vector3Packet& v) noexcept
+    {
+        return Dot(v, v);
+    }
+
+    [[nodiscard]] inline simd::FloatN Length(const Vector3Packet& v) noexcept
+    {
+        return simd::SqrtN(Dot(v, v));
+    }
+
+    /**
+     * @brief fast::RsqrtN with lanes where a is zero coming out as zero rather than NaN
+     */
+    [[nodiscard]] inline simd::FloatN ReciprocalSqrt(simd::FloatN a) noexcept
+    {
+        return simd::AndN(fast::RsqrtN(a), simd::LessN(simd::SplatN(0.0f), a));
+    }
+
+    /**
+     * @brief Unit length copy of every lane, zero length lanes stay zero
+     */
+    [[nodiscard]] inline Vector3Packet Normalize(const Vector3Packet& v) noexcept
+    {
+        return v * ReciprocalSqrt(Dot(v, v));
+    }
+
+    [[nodiscard]] inline Vector3Packet Min(const Vector3Packet& a, const Vector3Packet& b) noexcept
+    {
+        return {simd::MinN(a.x, b.x), simd::MinN(a.y, b.y), simd::MinN(a.z, b.z)};
+    }
+
+    [[nodiscard]] inline Vector3Packet Max(const Vector3Packet& a, const Vector3Packet& b) noexcept
+    {
+        return {simd::MaxN(a.x, b.x), simd::MaxN(a.y, b.y), simd::MaxN(a.z, b.z)};
+    }
+
+    /**
+     * @brief Per lane mask ? a : b
+     */
+    [[nodiscard]] inline Vector3Packet Select(simd::FloatN mask, const Vector3Packet& a, const Vector3Packet& b) noexcept
+    {
+        return {simd::SelectN(mask, a.x, b.x), simd::SelectN(mask, a.y, b.y), simd::SelectN(mask, a.z, b.z)};
+    }
+
+    [[nodiscard]] inline Vector4Packet operator+(const Vector4Packet& a, const Vector4Packet& b) noexcept
+    {
+        return {simd::AddN(a.x, b.x), simd::AddN(a.y, b.y), simd::AddN(a.z, b.z), simd::AddN(a.w, b.w)};
+    }
+
+    [[nodiscard]] inline Vector4Packet operator-(const Vector4Packet& a, const Vector4Packet& b) noexcept
+    {
+        return {simd::SubN(a.x, b.x), simd::SubN(a.y, b.y), simd::SubN(a.z, b.z), simd::SubN(a.w, b.w)};
+    }
+
+    [[nodiscard]] inline Vector4Packet operator*(const Vector4Packet& a, const Vector4Packet& b) noexcept
+    {
+        return {simd::MulN(a.x, b.x), simd::MulN(a.y, b.y), simd::MulN(a.z, b.z), simd::MulN(a.w, b.w)};
+    }
+
+    [[nodiscard]] inline Vector4Packet operator*(const Vector4Packet& a, simd::FloatN s) noexcept
+    {
+        return {simd::MulN(a.x, s), simd::MulN(a.y, s), simd::MulN(a.z, s), simd::MulN(a.w, s)};
+    }
+
+    [[nodiscard]] inline Vector4Packet operator*(simd::FloatN s, const Vector4Packet& a) noexcept
+    {
+        return a * s;
+    }
+
+    [[nodiscard]] inline simd::FloatN Dot(const Vector4Packet& a, const Vector4Packet& b) noexcept
+    {
+        return simd::MulAddN(a.x, b.x, simd::MulAddN(a.y, b.y, simd::MulAddN(a.z, b.z, simd::MulN(a.w, b.w))));
+    }
+
+    [[nodiscard]] inline Vector4Packet Normalize(const Vector4Packet& v) noexcept
+    {
+        return v * ReciprocalSqrt(Dot(v, v));
+    }
+
+    /**
+     * @brief Per lane mask ? a : b
+     */
+    [[nodiscard]] inline Vector4Packet Select(simd::FloatN mask, const Vector4Packet& a, const Vector4Packet& b) noexcept
+    {
+        return {simd::SelectN(mask, a.x, b.x), simd::SelectN(mask, a.y, b.y), simd::SelectN(mask, a.z, b.z),
+                simd::SelectN(mask, a.w, b.w)};
+    }
+}
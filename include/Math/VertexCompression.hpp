@@ -0,0 +1,295 @@
+/*
+ * Project: TestProject
+ * File: VertexCompression.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 11:20
+ * 
+ * Copyright © 2026 olegfresi
+ * 
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ * 
+ *     https://opensource.org/licenses/MIT
+ * 
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ * 
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ * 
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <span>
+#include "Vector.hpp"
+#include "Half.hpp"
+#include "Simd/Simd.hpp"
+
+/*  Vertex compression
+ *
+ *  Quantizes the 32 byte position / uv / normal vertex the OBJ parser produces into 16 bytes:
+ *
+ *      position   3 x unorm16 relative to the mesh bounds (+ 2 bytes padding)
+ *      uv         2 x unorm16 relative to the mesh uv bounds
+ *      normal     2 x snorm16 octahedral encoding (Cigolle et al., "A Survey of Efficient
+ *                 Representations for Independent Unit Vectors"), also fit for tangents
+ *
+ *  The GPU reads the fields as normalized integers, the vertex shader scales them back with the
+ *  VertexQuantization and unfolds the normal. The position and uv error is at most half a step,
+ *  extent / 131070, the normal error stays below 1e-4 radians. Attributes that need range
+ *  rather than precision can use the halves of Half.hpp instead.
+ *--------------------------------------------------------------------------------*/
+namespace lux::math
+{
+    /**
+     * @brief Interleaved position, texture coordinates and normal, the vertex Mesh and OBJParser use
+     */
+    struct StandardVertex
+    {
+        Vector3f position;
+        Vector2f uv;
+        Vector3f normal;
+    };
+
+    /**
+     * @brief 16 byte vertex, see Layout::Compressed() for the matching attribute layout
+     */
+    struct CompressedVertex
+    {
+        uint16_t position[3];
+        uint16_t padding;
+        uint16_t uv[2];
+        int16_t normal[2];
+    };
+
+    static_assert(sizeof(StandardVertex) == 8 * sizeof(float), "StandardVertex must match the 8 float vertex layout");
+    static_assert(sizeof(CompressedVertex) == 16, "CompressedVertex must stay 16 bytes");
+
+    /**
+     * @brief Maps the normalized fields of a CompressedVertex back to model space: offset + q * scale
+     */
+    struct VertexQuantization
+    {
+        Vector3f positionOffset;
+        Vector3f positionScale;
+        Vector2f uvOffset;
+        Vector2f uvScale;
+
+        /**
+         * @brief Tightest quantization covering every position and uv of the vertices
+         */
+        [[nodiscard]] static VertexQuantization FromVertices(std::span<const StandardVertex> vertices) noexcept
+        {
+            constexpr float inf = std::numeric_limits<float>::infinity();
+            std::array<float, 5> mn {inf, inf, inf, inf, inf};
+            std::array<float, 5> mx {-inf, -inf, -inf, -inf, -inf};
+
+            for (const auto& vertex : vertices)
+            {
+                const std::array<float, 5> v {vertex.position.GetX(), vertex.position.GetY(), vertex.position.GetZ(),
+                                              vertex.uv.GetX(), vertex.uv.GetY()};
+                for (size_t i = 0; i < v.size(); ++i)
+                {
+                    mn[i] = std::min(mn[i], v[i]);
+                    mx[i] = std::max(mx[i], v[i]);
+                }
+            }
+
+            if (vertices.empty())
+                mn = mx = {};
+
+            return {Vector3f{mn[0], mn[1], mn[2]}, Vector3f{mx[0] - mn[0], mx[1] - mn[1], mx[2] - mn[2]},
+                    Vector2f{mn[3], mn[4]}, Vector2f{mx[3] - mn[3], mx[4] - mn[4]}};
+        }
+    };
+
+    [[nodiscard]] inline uint16_t PackUnorm16(float value) noexcept
+    {
+        return static_cast<uint16_t>(std::lrint(std::clamp(value, 0.0f, 1.0f) * 65535.0f));
+    }
+
+    [[nodiscard]] inline int16_t PackSnorm16(float value) noexcept
+    {
+        return static_cast<int16_t>(std::lrint(std::clamp(value, -1.0f, 1.0f) * 32767.0f));
+    }
+
+    // the GL rules for normalized integers, -32768 and -32767 both decode to -1
+    [[nodiscard]] constexpr float UnpackUnorm16(uint16_t value) noexcept
+    {
+        return static_cast<float>(value) / 65535.0f;
+    }
+
+    [[nodiscard]] constexpr float UnpackSnorm16(int16_t value) noexcept
+    {
+        return std::max(static_cast<float>(value) / 32767.0f, -1.0f);
+    }
+
+    /**
+     * @brief Octahedral decoding of two snorm16 values to a unit vector, as the vertex shader does it
+     */
+    [[nodiscard]] inline Vector3f OctahedralDecode(int16_t encodedX, int16_t encodedY) noexcept
+    {
+        float x = UnpackSnorm16(encodedX);
+        float y = UnpackSnorm16(encodedY);
+        const float z = 1.0f - std::abs(x) - std::abs(y);
+
+        // fold the lower hemisphere back over the diagonals
+        const float t = std::max(-z, 0.0f);
+        x += x >= 0.0f ? -t : t;
+        y += y >= 0.0f ? -t : t;
+
+        const float invLength = 1.0f / std::sqrt(x * x + y * y + z * z);
+        return Vector3f{x * invLength, y * invLength, z * invLength};
+    }
+
+    namespace detail
+    {
+        // two 16 bit fields in one word, first at the lower address
+        [[nodiscard]] inline simd::IntN PackPairN(simd::IntN first, simd::IntN second) noexcept
+        {
+            first = simd::ShiftRightN<16>(simd::ShiftLeftN<16>(first));
+            second = simd::ShiftRightN<16>(simd::ShiftLeftN<16>(second));
+
+            if constexpr (std::endian::native == std::endian::little)
+                return simd::OrN(first, simd::ShiftLeftN<16>(second));
+            else
+                return simd::OrN(simd::ShiftLeftN<16>(first), second);
+        }
+
+        [[nodiscard]] inline simd::IntN QuantizeUnorm16N(simd::FloatN value, simd::FloatN offset, simd::FloatN scale) noexcept
+        {
+            const simd::FloatN q = simd::MulN(simd::SubN(value, offset), scale);
+            return simd::RoundToIntN(simd::MinN(simd::MaxN(q, simd::SplatN(0.0f)), simd::SplatN(65535.0f)));
+        }
+
+        inline void OctahedralEncodeN(simd::FloatN x, simd::FloatN y, simd::FloatN z, simd::IntN& outX, simd::IntN& outY) noexcept
+        {
+            const simd::FloatN one = simd::SplatN(1.0f);
+            const simd::FloatN invL1 = simd::DivN(one, simd::AddN(simd::AddN(simd::AbsN(x), simd::AbsN(y)), simd::AbsN(z)));
+            const simd::FloatN px = simd::MulN(x, invL1);
+            const simd::FloatN py = simd::MulN(y, invL1);
+
+            // lower hemisphere: (1 - |y|, 1 - |x|) with the signs of x and y, zero counting as positive
+            const simd::FloatN foldX = simd::XorN(simd::SubN(one, simd::AbsN(py)), simd::SignN(px));
+            const simd::FloatN foldY = simd::XorN(simd::SubN(one, simd::AbsN(px)), simd::SignN(py));
+            const simd::FloatN lower = simd::LessN(z, simd::SplatN(0.0f));
+
+            const simd::FloatN snorm = simd::SplatN(32767.0f);
+            outX = simd::RoundToIntN(simd::MulN(simd::SelectN(lower, foldX, px), snorm));
+            outY = simd::RoundToIntN(simd::MulN(simd::SelectN(lower, foldY, py), snorm));
+        }
+
+        inline void CompressLanes(const float* in, float* out, simd::FloatN positionOffset[3], simd::FloatN positionScale[3],
+                                  simd::FloatN uvOffset[2], simd::FloatN uvScale[2]) noexcept
+        {
+            simd::FloatN px, py, pz, u, v, nx, ny, nz;
+            simd::LoadLaneQuadsN(in, 8, px, py, pz, u);
+            simd::LoadLaneQuadsN(in + 4, 8, v, nx, ny, nz);
+
+            simd::IntN octX, octY;
+            OctahedralEncodeN(nx, ny, nz, octX, octY);
+
+            const simd::IntN zero = simd::RoundToIntN(simd::SplatN(0.0f));
+            const simd::IntN xy = PackPairN(QuantizeUnorm16N(px, positionOffset[0], positionScale[0]),
+                                            QuantizeUnorm16N(py, positionOffset[1], positionScale[1]));
+            const simd::IntN zw = PackPairN(QuantizeUnorm16N(pz, positionOffset[2], positionScale[2]), zero);
+            const simd::IntN uv = PackPairN(QuantizeUnorm16N(u, uvOffset[0], uvScale[0]), QuantizeUnorm16N(v, uvOffset[1], uvScale[1]));
+            const simd::IntN normal = PackPairN(octX, octY);
+
+            simd::StoreLaneQuadsN(out, 4, simd::AsFloatN(xy), simd::AsFloatN(zw), simd::AsFloatN(uv), simd::AsFloatN(normal));
+        }
+    }
+
+    /**
+     * @brief Octahedral encoding of a unit vector into two snorm16 values
+     */
+    [[nodiscard]] inline std::array<int16_t, 2> OctahedralEncode(const Vector3f& n) noexcept
+    {
+        float x = n.GetX(), y = n.GetY(), z = n.GetZ();
+        const float invL1 = 1.0f / (std::abs(x) + std::abs(y) + std::abs(z));
+        x *= invL1;
+        y *= invL1;
+
+        if (z < 0.0f)
+        {
+            const float foldX = std::copysign(1.0f - std::abs(y), x);
+            y = std::copysign(1.0f - std::abs(x), y);
+            x = foldX;
+        }
+
+        return {PackSnorm16(x), PackSnorm16(y)};
+    }
+
+    /**
+     * @brief Quantizes vertices with q, simd::FloatLanes vertices per step
+     */
+    inline void CompressVertices(std::span<const StandardVertex> in, const VertexQuantization& q, std::span<CompressedVertex> out) noexcept
+    {
+        CORE_ASSERT(out.size() >= in.size(), "Output span is smaller than the input")
+
+        auto inverse = [](float extent) { return extent > 0.0f ? 65535.0f / extent : 0.0f; };
+
+        simd::FloatN positionOffset[3], positionScale[3], uvOffset[2], uvScale[2];
+        for (size_t i = 0; i < 3; ++i)
+        {
+            positionOffset[i] = simd::SplatN(q.positionOffset[i]);
+            positionScale[i] = simd::SplatN(inverse(q.positionScale[i]));
+        }
+
+        for (size_t i = 0; i < 2; ++i)
+        {
+            uvOffset[i] = simd::SplatN(q.uvOffset[i]);
+            uvScale[i] = simd::SplatN(inverse(q.uvScale[i]));
+        }
+
+        const auto* src = reinterpret_cast<const float*>(in.data());
+        auto* dst = reinterpret_cast<float*>(out.data());
+
+        size_t i = 0;
+        for (; i + simd::FloatLanes <= in.size(); i += simd::FloatLanes)
+            detail::CompressLanes(src + i * 8, dst + i * 4, positionOffset, positionScale, uvOffset, uvScale);
+
+        // the remainder goes through a padded block so it is rounded exactly like the rest
+        if (i < in.size())
+        {
+            std::array<StandardVertex, simd::FloatLanes> block {};
+            std::array<CompressedVertex, simd::FloatLanes> packed;
+            std::copy(in.begin() + static_cast<ptrdiff_t>(i), in.end(), block.begin());
+
+            detail::CompressLanes(reinterpret_cast<const float*>(block.data()), reinterpret_cast<float*>(packed.data()),
+                                  positionOffset, positionScale, uvOffset, uvScale);
+            std::copy_n(packed.begin(), in.size() - i, out.begin() + static_cast<ptrdiff_t>(i));
+        }
+    }
+
+    /**
+     * @brief Reconstructs a vertex the way the vertex shader does, for tools and tests
+     */
+    [[nodiscard]] inline StandardVertex DecompressVertex(const CompressedVertex& vertex, const VertexQuantization& q) noexcept
+    {
+        Vector3f position;
+        for (size_t i = 0; i < 3; ++i)
+            position[i] = q.positionOffset[i] + UnpackUnorm16(vertex.position[i]) * q.positionScale[i];
+
+        Vector2f uv;
+        for (size_t i = 0; i < 2; ++i)
+            uv[i] = q.uvOffset[i] + UnpackUnorm16(vertex.uv[i]) * q.uvScale[i];
+
+        return {position, uv, OctahedralDecode(vertex.normal[0], vertex.normal[1])};
+    }
+}
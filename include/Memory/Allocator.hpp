@@ -30,3 +30,33 @@
  */
 #pragma once
 
+
+#include <cstddef>
+#include <cstdint>
+
+/*  Allocator utilities
+ *
+ *  Alignment helpers shared by the engine allocators (Arena, PoolAllocator).
+ *--------------------------------------------------------------------------------*/
+namespace lux
+{
+    inline constexpr size_t PageSize = 4096;
+
+    [[nodiscard]] constexpr bool IsPowerOfTwo(size_t value) noexcept
+    {
+        return value && (value & (value - 1)) == 0;
+    }
+
+    /**
+     * @brief Rounds value up to a multiple of alignment, which must be a power of two
+     */
+    [[nodiscard]] constexpr size_t AlignUp(size_t value, size_t alignment) noexcept
+    {
+        return (value + alignment - 1) & ~(alignment - 1);
+    }
+
+    [[nodiscard]] inline bool IsAligned(const void* ptr, size_t alignment) noexcept
+    {
+        return (reinterpret_cast<uintptr_t>(ptr) & (alignment - 1)) == 0;
+    }
+}
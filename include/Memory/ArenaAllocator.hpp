@@ -29,29 +29,95 @@
  * SOFTWARE.
  */
 #pragma once
-#include <tuple>
-#include <type_traits>
-#include <memory>
-#include <new>
+#include <algorithm>
 #include <array>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <type_traits>
+#include <utility>
 
+#include "Allocator.hpp"
+#include "MemoryTracker.hpp"
 #include "../Application/Pointers.hpp"
+#include "../Application/Assertion.hpp"
 
-/*  Idea of Arena Allocator
+/*  Arena Allocator
  *
+ *  Bump allocator for data that dies all at once: per frame transients (cull results, draw
+ *  packets), parsed tokens, scratch of a load job. Allocations are carved out of blocks
+ *  chained one after the other; when the current block is full the next one is used, and a
+ *  new block is only requested from the heap when no existing one fits. Reset() and Rewind()
+ *  keep every block, so an arena that reached its working size stops touching the heap.
+ *
+ *  Objects that are not trivially destructible get a destructor record in the arena itself,
+ *  Reset() and Rewind() run them newest first before the memory is reused.
+ *
+ *  Markers capture the current position; Rewind(marker) or an ArenaScope drops everything
+ *  allocated after it. An arena is not thread safe, ThreadLocal() gives each thread its own.
+ *  ArenaResource lets std::pmr containers allocate from an arena. Blocks are reported to the
+ *  MemoryTracker under the arena's tag, TEMP unless told otherwise.
  *--------------------------------------------------------------------------------*/
 namespace lux
 {
     class Arena
     {
+        struct DestructorNode;
+        struct BlockHeader;
+
     public:
-        explicit Arena(size_t size) : buffer{static_cast<std::byte*>(operator new(size))}, capacity{size} {}
+        static constexpr size_t DefaultBlockSize = 64 * 1024;
+        static constexpr size_t BlockAlignment = 64;
+
+        /**
+         * @brief Position in the arena returned by GetMarker(), only valid until the arena rewinds past it
+         */
+        struct Marker
+        {
+            BlockHeader* block = nullptr;
+            size_t offset = 0;
+            DestructorNode* tail = nullptr;
+        };
+
+        /**
+         * @param blockSize Usable bytes of each block, larger requests get a block of their own size
+         * @param tag Subsystem the blocks are accounted to
+         */
+        explicit Arena(size_t blockSize = DefaultBlockSize, MemoryTag tag = MemoryTag::TEMP) :
+            m_blockSize{std::max<size_t>(blockSize, 64)}, m_tag{tag} {}
 
         ~Arena()
         {
-            CallDestructors();
-            operator delete(buffer);
+            CallDestructors(nullptr);
+
+            while (m_first)
+            {
+                BlockHeader* next = m_first->next;
+                FreeBlock(m_first);
+                m_first = next;
+            }
+        }
+
+        Arena(const Arena&) = delete;
+        Arena& operator=(const Arena&) = delete;
+
+        Arena(Arena&&) = delete;
+        Arena& operator=(Arena&&) = delete;
+
+        /**
+         * @brief Raw uninitialized memory, valid until the arena is reset or rewound past it
+         */
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+        {
+            CORE_ASSERT(IsPowerOfTwo(alignment), "Arena: alignment must be a power of two")
+
+            if (m_current)
+                if (void* p = BumpIn(m_current, m_offset, size, alignment))
+                    return p;
+
+            return AllocateSlow(size, alignment);
         }
 
         template<typename T, typename... Args>
@@ -59,41 +125,92 @@ namespace lux
         {
             static_assert(std::is_constructible_v<T, Args...>, "T must be constructible from Args");
 
-            auto [ptr, new_offset] = Allocate(offset, sizeof(T), alignof(T));
-
             if constexpr (std::is_trivially_destructible_v<T>)
-            {
-                T* obj = new (ptr) T(std::forward<Args>(args)...);
-                offset = new_offset;
-                return obj;
-            }
+                return new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
             else
             {
-                auto [d_node_ptr, final_offset] = Allocate(offset, sizeof(DestructorNode), alignof(DestructorNode));
-                T* obj = new (ptr) T(std::forward<Args>(args)...);
+                // The record goes first so a throwing constructor leaves nothing to destroy
+                auto* node = static_cast<DestructorNode*>(Allocate(sizeof(DestructorNode), alignof(DestructorNode)));
+                T* obj = new (Allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
 
-                auto dtor_call = [](void* p) { static_cast<T*>(p)->~T(); };
-                DestructorNode* new_node  = new (d_node_ptr) DestructorNode{dtor_call, tail, obj};
-                tail = new_node;
-                offset = final_offset;
+                *node = DestructorNode{[](void* p) { static_cast<T*>(p)->~T(); }, m_tail, obj};
+                m_tail = node;
                 return obj;
             }
         }
 
-        void Reset()
+        /**
+         * @brief count value initialized T, trivially destructible types only
+         */
+        template<typename T>
+        T* CreateArray(size_t count)
         {
-            offset = 0;
-            CallDestructors();
+            static_assert(std::is_trivially_destructible_v<T>, "Arena arrays are never destroyed one by one");
+
+            T* first = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+            std::uninitialized_value_construct_n(first, count);
+            return first;
         }
 
-        Arena(const Arena&) = delete;
-        Arena& operator=(const Arena&) = delete;
+        [[nodiscard]] Marker GetMarker() const noexcept { return {m_current, m_offset, m_tail}; }
 
-        Arena(Arena&&) = delete;
-        Arena& operator=(Arena&&) = delete;
+        /**
+         * @brief Destroys the objects created after marker and makes their memory available again
+         */
+        void Rewind(const Marker& marker) noexcept
+        {
+            CallDestructors(marker.tail);
+            m_current = marker.block;
+            m_offset = marker.offset;
+        }
 
-    private:
+        /**
+         * @brief Destroys every object and starts over at the first block, no block is freed
+         */
+        void Reset() noexcept
+        {
+            Rewind({});
+        }
 
+        /**
+         * @brief Frees the blocks past the current one, e.g. after a load spike
+         */
+        void Trim() noexcept
+        {
+            BlockHeader*& tail = m_current ? m_current->next : m_first;
+            while (tail)
+            {
+                BlockHeader* next = tail->next;
+                m_reserved -= tail->capacity;
+                FreeBlock(tail);
+                tail = next;
+            }
+        }
+
+        /**
+         * @brief Heap bytes held by the blocks, used or not
+         */
+        [[nodiscard]] size_t GetReservedBytes() const noexcept { return m_reserved; }
+        [[nodiscard]] MemoryTag GetTag() const noexcept { return m_tag; }
+
+        [[nodiscard]] size_t GetBlockCount() const noexcept
+        {
+            size_t count = 0;
+            for (const BlockHeader* block = m_first; block; block = block->next)
+                ++count;
+            return count;
+        }
+
+        /**
+         * @brief Arena of the calling thread, created on first use and destroyed with the thread
+         */
+        static Arena& ThreadLocal()
+        {
+            thread_local Arena arena;
+            return arena;
+        }
+
+    private:
         struct DestructorNode
         {
             void (*dtor)(void*);
@@ -101,32 +218,119 @@ namespace lux
             void* obj;
         };
 
-        std::byte* buffer;
-        size_t capacity;
-        size_t offset = 0;
-        DestructorNode* tail = nullptr;
+        struct alignas(BlockAlignment) BlockHeader
+        {
+            BlockHeader* next;
+            size_t capacity;
+
+            [[nodiscard]] std::byte* Data() noexcept { return reinterpret_cast<std::byte*>(this + 1); }
+        };
+
+        size_t m_blockSize;
+        MemoryTag m_tag;
+        size_t m_reserved = 0;
+        BlockHeader* m_first = nullptr;
+        BlockHeader* m_current = nullptr;
+        size_t m_offset = 0;
+        DestructorNode* m_tail = nullptr;
+
+        static void* BumpIn(BlockHeader* block, size_t& offset, size_t size, size_t alignment) noexcept
+        {
+            void* p = block->Data() + offset;
+            size_t space = block->capacity - offset;
+            if (!std::align(alignment, size, p, space))
+                return nullptr;
+
+            offset = static_cast<std::byte*>(p) - block->Data() + size;
+            return p;
+        }
+
+        void FreeBlock(BlockHeader* block) const noexcept
+        {
+            MemoryTracker::OnFree(m_tag, sizeof(BlockHeader) + block->capacity);
+            operator delete(block, std::align_val_t{BlockAlignment});
+        }
 
-        void CallDestructors()
+        void* AllocateSlow(size_t size, size_t alignment)
         {
-            while(tail)
+            // Walk on to the blocks kept by an earlier Reset() or Rewind()
+            BlockHeader* prev = m_current;
+            for (BlockHeader* block = m_current ? m_current->next : m_first; block; prev = block, block = block->next)
             {
-                tail->dtor(tail->obj);
-                tail = tail->prev;
+                size_t offset = 0;
+                if (void* p = BumpIn(block, offset, size, alignment))
+                {
+                    m_current = block;
+                    m_offset = offset;
+                    return p;
+                }
             }
+
+            // None fits: append a new block, big enough for the request whatever its alignment
+            const size_t capacity = std::max(m_blockSize, size + std::max(alignment, BlockAlignment));
+            auto* block = new (operator new(sizeof(BlockHeader) + capacity, std::align_val_t{BlockAlignment}))
+                BlockHeader{nullptr, capacity};
+            m_reserved += capacity;
+            MemoryTracker::OnAllocate(m_tag, sizeof(BlockHeader) + capacity);
+
+            (prev ? prev->next : m_first) = block;
+            m_current = block;
+            m_offset = 0;
+
+            void* p = BumpIn(block, m_offset, size, alignment);
+            CORE_ASSERT(p, "Arena: fresh block too small")
+            return p;
         }
 
-        std::pair<void*, size_t> Allocate(size_t currOffset, size_t size, size_t alignment) const
+        void CallDestructors(DestructorNode* until) noexcept
         {
-            std::byte* currentPtr = buffer + currOffset;
-            size_t space = capacity - currOffset;
-            void* alignedPtr = currentPtr;
+            while (m_tail != until)
+            {
+                m_tail->dtor(m_tail->obj);
+                m_tail = m_tail->prev;
+            }
+        }
+    };
 
-            if (std::align(alignment, size, alignedPtr, space) == nullptr)
-                throw std::bad_alloc();
+    /**
+     * @brief Rewinds the arena to where it was on construction when the scope ends
+     */
+    class ArenaScope
+    {
+    public:
+        explicit ArenaScope(Arena& arena) noexcept : m_arena{arena}, m_marker{arena.GetMarker()} {}
+        ~ArenaScope() { m_arena.Rewind(m_marker); }
 
-            auto new_offset = static_cast<std::byte*>(alignedPtr) - buffer + size;
+        ArenaScope(const ArenaScope&) = delete;
+        ArenaScope& operator=(const ArenaScope&) = delete;
 
-            return {alignedPtr, new_offset};
+    private:
+        Arena& m_arena;
+        Arena::Marker m_marker;
+    };
+
+    /**
+     * @brief std::pmr adapter over an Arena: deallocation is a no-op, memory comes back on Reset() or Rewind()
+     *
+     * Containers using it must be destroyed before the arena is reset past their memory.
+     */
+    class ArenaResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit ArenaResource(Arena& arena) noexcept : m_arena{arena} {}
+
+        [[nodiscard]] Arena& GetArena() const noexcept { return m_arena; }
+
+    private:
+        Arena& m_arena;
+
+        void* do_allocate(size_t bytes, size_t alignment) override { return m_arena.Allocate(bytes, alignment); }
+        void do_deallocate(void*, size_t, size_t) override {}
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            auto* resource = dynamic_cast<const ArenaResource*>(&other);
+            return resource && &resource->m_arena == &m_arena;
         }
     };
 
@@ -0,0 +1,337 @@
+/*
+ * Project: TestProject
+ * File: FrameAllocator.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 10:12
+ *
+ * Copyright © 2026 olegfresi
+ *
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ *
+ *     https://opensource.org/licenses/MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <ranges>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "ArenaAllocator.hpp"
+
+/*  Frame Allocator
+ *
+ *  Linear memory for data that lives one frame: cull results, packed matrices, draw lists.
+ *  The allocator rotates between two or three arenas; BeginFrame() moves on to the next one
+ *  and resets it, so memory handed out in frame N stays valid until frame N + framesInFlight
+ *  begins. Two frames in flight let this frame read what the previous one produced, three
+ *  also cover a GPU that is a frame behind. Arenas keep their blocks across resets, so once
+ *  each has seen the largest frame the loop no longer touches the heap.
+ *
+ *  FrameSpan<T> and FrameVector<T> are the typed views on that memory. With LUX_FRAME_CHECKS
+ *  enabled they remember the frame they were allocated in and throw std::logic_error when used
+ *  after that frame's arena was recycled. Left undefined it follows NDEBUG, like
+ *  LUX_MATH_CHECKS, so debug builds check and release builds carry a bare pointer and size.
+ *
+ *  Not thread safe: the allocator belongs to the thread running the frame loop.
+ *--------------------------------------------------------------------------------*/
+#if !defined(LUX_FRAME_CHECKS)
+    #if defined(NDEBUG)
+        #define LUX_FRAME_CHECKS 0
+    #else
+        #define LUX_FRAME_CHECKS 1
+    #endif
+#endif
+
+namespace lux
+{
+    inline constexpr bool FrameChecks = LUX_FRAME_CHECKS != 0;
+
+    class FrameAllocator;
+
+    /**
+     * @brief Frame a FrameSpan or FrameVector was allocated in, empty unless LUX_FRAME_CHECKS is on
+     */
+    class FrameStamp
+    {
+    public:
+        FrameStamp() = default;
+
+#if LUX_FRAME_CHECKS
+        FrameStamp(const FrameAllocator* owner, uint64_t frame) noexcept : m_owner{owner}, m_frame{frame} {}
+
+        inline void Check() const;
+
+    private:
+        const FrameAllocator* m_owner = nullptr;
+        uint64_t m_frame = 0;
+#else
+        FrameStamp(const FrameAllocator*, uint64_t) noexcept {}
+
+        void Check() const noexcept {}
+#endif
+    };
+
+    /**
+     * @brief Fixed size view on frame memory, valid until the frame it came from is recycled
+     *
+     * Like FrameVector it is a contiguous range, so it converts to std::span; the conversion goes
+     * through data() and checks the frame once.
+     */
+    template<typename T>
+    class FrameSpan
+    {
+    public:
+        FrameSpan() = default;
+        FrameSpan(T* data, size_t size, FrameStamp stamp) noexcept : m_data{data}, m_size{size}, m_stamp{stamp} {}
+
+        [[nodiscard]] T* data() const { m_stamp.Check(); return m_data; }
+        [[nodiscard]] size_t size() const noexcept { return m_size; }
+        [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+        [[nodiscard]] T* begin() const { return data(); }
+        [[nodiscard]] T* end() const { return data() + m_size; }
+
+        [[nodiscard]] T& operator[](size_t index) const
+        {
+            CORE_ASSERT(index < m_size, "FrameSpan: index out of range")
+            return data()[index];
+        }
+
+        [[nodiscard]] FrameSpan First(size_t count) const
+        {
+            CORE_ASSERT(count <= m_size, "FrameSpan: count out of range")
+            return {m_data, count, m_stamp};
+        }
+
+    private:
+        T* m_data = nullptr;
+        size_t m_size = 0;
+        FrameStamp m_stamp;
+    };
+
+    /**
+     * @brief Growable array in frame memory, for results whose count is only known while producing them
+     *
+     * Growing copies into a fresh allocation and leaves the old one to the frame reset, so element
+     * types must be trivially copyable and destructible. reserve() up front when the bound is known.
+     */
+    template<typename T>
+    class FrameVector
+    {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_trivially_destructible_v<T>,
+                      "FrameVector elements are moved with memcpy and never destroyed");
+
+    public:
+        FrameVector() = default;
+        inline explicit FrameVector(FrameAllocator& allocator, size_t capacity = 0);
+
+        void reserve(size_t capacity)
+        {
+            if (capacity > m_capacity)
+                Grow(capacity);
+        }
+
+        void resize(size_t size)
+        {
+            reserve(size);
+            if (size > m_size)
+                std::uninitialized_value_construct_n(m_data + m_size, size - m_size);
+            m_size = size;
+        }
+
+        void push_back(const T& value) { emplace_back(value); }
+
+        template<typename... Args>
+        T& emplace_back(Args&&... args)
+        {
+            if (m_size == m_capacity)
+                Grow(std::max<size_t>(m_capacity * 2, MinCapacity));
+            else
+                m_stamp.Check();
+
+            return *new (m_data + m_size++) T(std::forward<Args>(args)...);
+        }
+
+        void pop_back() noexcept
+        {
+            CORE_ASSERT(m_size > 0, "FrameVector: pop_back on an empty vector")
+            --m_size;
+        }
+
+        void clear() noexcept { m_size = 0; }
+
+        [[nodiscard]] T* data() const { m_stamp.Check(); return m_data; }
+        [[nodiscard]] size_t size() const noexcept { return m_size; }
+        [[nodiscard]] size_t capacity() const noexcept { return m_capacity; }
+        [[nodiscard]] bool empty() const noexcept { return m_size == 0; }
+
+        [[nodiscard]] T* begin() const { return data(); }
+        [[nodiscard]] T* end() const { return data() + m_size; }
+
+        [[nodiscard]] T& operator[](size_t index) const
+        {
+            CORE_ASSERT(index < m_size, "FrameVector: index out of range")
+            return data()[index];
+        }
+
+        [[nodiscard]] T& back() const { return (*this)[m_size - 1]; }
+
+        [[nodiscard]] FrameSpan<T> GetSpan() const noexcept { return {m_data, m_size, m_stamp}; }
+
+    private:
+        static constexpr size_t MinCapacity = 8;
+
+        FrameAllocator* m_allocator = nullptr;
+        T* m_data = nullptr;
+        size_t m_size = 0;
+        size_t m_capacity = 0;
+        FrameStamp m_stamp;
+
+        inline void Grow(size_t capacity);
+    };
+
+    class FrameAllocator
+    {
+    public:
+        static constexpr uint32_t MaxFramesInFlight = 3;
+
+        explicit FrameAllocator(uint32_t framesInFlight = 2, size_t blockSize = Arena::DefaultBlockSize)
+            : m_arenas{Arena{blockSize}, Arena{blockSize}, Arena{blockSize}}, m_framesInFlight{framesInFlight}
+        {
+            CORE_ASSERT(framesInFlight >= 1 && framesInFlight <= MaxFramesInFlight,
+                        "FrameAllocator: frames in flight must be between 1 and 3")
+        }
+
+        FrameAllocator(const FrameAllocator&) = delete;
+        FrameAllocator& operator=(const FrameAllocator&) = delete;
+
+        /**
+         * @brief Starts a new frame, recycling the memory of frame GetFrameNumber() + 1 - framesInFlight
+         */
+        void BeginFrame() noexcept
+        {
+            ++m_frame;
+            m_current = &m_arenas[m_frame % m_framesInFlight];
+            m_current->Reset();
+        }
+
+        [[nodiscard]] uint64_t GetFrameNumber() const noexcept { return m_frame; }
+        [[nodiscard]] uint32_t GetFramesInFlight() const noexcept { return m_framesInFlight; }
+
+        /**
+         * @brief True while memory allocated in the given frame has not been recycled
+         */
+        [[nodiscard]] bool IsLive(uint64_t frame) const noexcept
+        {
+            return frame <= m_frame && m_frame - frame < m_framesInFlight;
+        }
+
+        /**
+         * @brief Raw uninitialized memory valid for the current frame and the framesInFlight - 1 after it
+         */
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment = alignof(std::max_align_t))
+        {
+            return m_current->Allocate(size, alignment);
+        }
+
+        /**
+         * @brief count default-initialized elements of frame memory, so scalars are left uninitialized
+         */
+        template<typename T>
+        [[nodiscard]] FrameSpan<T> AllocateSpan(size_t count)
+        {
+            static_assert(std::is_trivially_destructible_v<T>, "Frame memory is never destroyed element by element");
+
+            T* first = static_cast<T*>(Allocate(sizeof(T) * count, alignof(T)));
+            std::uninitialized_default_construct_n(first, count);
+            return {first, count, Stamp()};
+        }
+
+        template<typename T>
+        [[nodiscard]] FrameVector<T> MakeVector(size_t capacity = 0) { return FrameVector<T>{*this, capacity}; }
+
+        /**
+         * @brief Arena of the current frame, e.g. to back an ArenaResource for std::pmr containers
+         */
+        [[nodiscard]] Arena& GetArena() noexcept { return *m_current; }
+
+        /**
+         * @brief Heap bytes held by all the arenas, flat once every arena has seen the largest frame
+         */
+        [[nodiscard]] size_t GetReservedBytes() const noexcept
+        {
+            size_t reserved = 0;
+            for (const Arena& arena : m_arenas)
+                reserved += arena.GetReservedBytes();
+            return reserved;
+        }
+
+    private:
+        template<typename T>
+        friend class FrameVector;
+
+        std::array<Arena, MaxFramesInFlight> m_arenas;
+        Arena* m_current = &m_arenas[0];
+        uint32_t m_framesInFlight;
+        uint64_t m_frame = 0;
+
+        [[nodiscard]] FrameStamp Stamp() const noexcept { return {this, m_frame}; }
+    };
+
+#if LUX_FRAME_CHECKS
+    inline void FrameStamp::Check() const
+    {
+        if (m_owner && !m_owner->IsLive(m_frame))
+            throw std::logic_error("Frame memory used after its frame was recycled");
+    }
+#endif
+
+    template<typename T>
+    FrameVector<T>::FrameVector(FrameAllocator& allocator, size_t capacity) : m_allocator{&allocator}
+    {
+        reserve(capacity);
+    }
+
+    template<typename T>
+    void FrameVector<T>::Grow(size_t capacity)
+    {
+        CORE_ASSERT(m_allocator, "FrameVector: default constructed vectors cannot grow")
+        m_stamp.Check();
+
+        T* data = static_cast<T*>(m_allocator->Allocate(sizeof(T) * capacity, alignof(T)));
+        if (m_size)
+            std::memcpy(data, m_data, sizeof(T) * m_size);
+
+        m_data = data;
+        m_capacity = capacity;
+        m_stamp = m_allocator->Stamp();
+    }
+}
+
+template<typename T>
+inline constexpr bool std::ranges::enable_borrowed_range<lux::FrameSpan<T>> = true;
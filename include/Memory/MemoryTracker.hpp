@@ -0,0 +1,410 @@
+/*
+ * Project: TestProject
+ * File: MemoryTracker.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 16:05
+ *
+ * Copyright © 2026 olegfresi
+ *
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ *
+ *     https://opensource.org/licenses/MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <mutex>
+#include <string_view>
+
+#include "../Application/Assertion.hpp"
+
+/*  Memory Tracker
+ *
+ *  Per subsystem accounting of the memory the engine holds. Every engine allocator carries a
+ *  MemoryTag and reports what it takes from and gives back to the system: Arena blocks,
+ *  PoolAllocator and SlabAllocator slabs, the tracked std::pmr resources behind mesh and scene
+ *  data, plus the estimated texture uploads. The counters are relaxed atomics touched once per
+ *  block or slab, not once per object, so they stay on in release builds.
+ *
+ *  For each tag the tracker keeps live bytes, their high-water mark and the allocation count;
+ *  EndFrame() turns the counts into per second rates over a one second window and writes a
+ *  summary to the core log every SetDumpInterval() seconds. GetSnapshot() returns a copy of
+ *  all of it for tests, tools or an overlay.
+ *
+ *  Configuring with LUX_MEMORY_HOOK replaces the global operator new (src/Memory/MemoryHook.cpp)
+ *  so that allocations nobody tagged, std containers included, are counted per frame too.
+ *--------------------------------------------------------------------------------*/
+namespace lux
+{
+    enum class MemoryTag : uint8_t
+    {
+        MESH,
+        TEXTURE,
+        SHADER,
+        SCENE,
+        EVENT,
+        TEMP,
+        UNTAGGED,
+        COUNT
+    };
+
+    inline constexpr size_t MemoryTagCount = static_cast<size_t>(MemoryTag::COUNT);
+
+    [[nodiscard]] constexpr std::string_view ToString(MemoryTag tag) noexcept
+    {
+        switch (tag)
+        {
+            case MemoryTag::MESH:     return "Mesh";
+            case MemoryTag::TEXTURE:  return "Texture";
+            case MemoryTag::SHADER:   return "Shader";
+            case MemoryTag::SCENE:    return "Scene";
+            case MemoryTag::EVENT:    return "Event";
+            case MemoryTag::TEMP:     return "Temp";
+            case MemoryTag::UNTAGGED: return "Untagged";
+            default:                  return "Unknown";
+        }
+    }
+
+    struct MemoryTagStats
+    {
+        MemoryTag tag = MemoryTag::UNTAGGED;
+        uint64_t liveBytes = 0;
+        uint64_t peakBytes = 0;             // High-water mark of liveBytes since start or ResetPeaks()
+        uint64_t allocations = 0;           // Since start
+        uint64_t frees = 0;
+        uint64_t allocatedBytes = 0;        // Since start
+        double allocationsPerSecond = 0.0;  // Over the last full rate window
+        double bytesPerSecond = 0.0;
+
+        [[nodiscard]] uint64_t GetLiveAllocations() const noexcept { return allocations - frees; }
+    };
+
+    struct MemorySnapshot
+    {
+        std::array<MemoryTagStats, MemoryTagCount> tags;
+        uint64_t frame = 0;
+
+        // Counted by the operator new hook, all zero when it is not compiled in
+        bool heapHookInstalled = false;
+        uint64_t heapAllocations = 0;
+        uint64_t heapBytes = 0;
+        uint64_t heapAllocationsLastFrame = 0;
+        uint64_t heapAllocationsPeakFrame = 0;
+        double heapAllocationsPerSecond = 0.0;
+
+        [[nodiscard]] const MemoryTagStats& operator[](MemoryTag tag) const noexcept { return tags[static_cast<size_t>(tag)]; }
+
+        [[nodiscard]] uint64_t GetLiveBytes() const noexcept
+        {
+            uint64_t live = 0;
+            for (const MemoryTagStats& stats : tags)
+                live += stats.liveBytes;
+            return live;
+        }
+    };
+
+    namespace detail
+    {
+        struct alignas(64) MemoryTagCounters
+        {
+            std::atomic<uint64_t> liveBytes {0};
+            std::atomic<uint64_t> peakBytes {0};
+            std::atomic<uint64_t> allocations {0};
+            std::atomic<uint64_t> frees {0};
+            std::atomic<uint64_t> allocatedBytes {0};
+        };
+
+        // Rate window and per frame heap counts, guarded by the tracker mutex
+        struct MemoryRateState
+        {
+            uint64_t frame = 0;
+            double windowStart = -1.0;
+            std::array<uint64_t, MemoryTagCount> windowAllocations {};
+            std::array<uint64_t, MemoryTagCount> windowBytes {};
+            uint64_t windowHeap = 0;
+            std::array<double, MemoryTagCount> allocationRate {};
+            std::array<double, MemoryTagCount> byteRate {};
+            double heapRate = 0.0;
+
+            uint64_t heapAtFrameStart = 0;
+            uint64_t heapLastFrame = 0;
+            uint64_t heapPeakFrame = 0;
+
+            double dumpInterval = 0.0;
+            double lastDump = 0.0;
+        };
+    }
+
+    class MemoryTracker
+    {
+    public:
+        static constexpr double RateWindow = 1.0;
+
+        MemoryTracker() = delete;
+
+        static void OnAllocate(MemoryTag tag, size_t bytes) noexcept
+        {
+            TagCounters& counters = Counters(tag);
+            counters.allocations.fetch_add(1, std::memory_order_relaxed);
+            counters.allocatedBytes.fetch_add(bytes, std::memory_order_relaxed);
+
+            const uint64_t live = counters.liveBytes.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+            uint64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+            while (live > peak && !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed))
+            {
+            }
+        }
+
+        static void OnFree(MemoryTag tag, size_t bytes) noexcept
+        {
+            TagCounters& counters = Counters(tag);
+            counters.frees.fetch_add(1, std::memory_order_relaxed);
+            counters.liveBytes.fetch_sub(bytes, std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Called by the operator new hook for every heap allocation, must not allocate
+         */
+        static void OnHeapAllocation(size_t bytes) noexcept
+        {
+            s_heapAllocations.fetch_add(1, std::memory_order_relaxed);
+            s_heapBytes.fetch_add(bytes, std::memory_order_relaxed);
+        }
+
+        static void SetHeapHookInstalled() noexcept { s_heapHookInstalled.store(true, std::memory_order_relaxed); }
+
+        /**
+         * @brief Closes a frame: rolls the per frame heap count, refreshes the rates and dumps to the log when due
+         * @param time Seconds on a monotonic clock, e.g. glfwGetTime()
+         */
+        static void EndFrame(double time)
+        {
+            bool dump = false;
+            {
+                std::lock_guard lock {s_mutex};
+                RateState& state = s_rates;
+
+                const uint64_t heap = s_heapAllocations.load(std::memory_order_relaxed);
+                state.heapLastFrame = heap - state.heapAtFrameStart;
+                state.heapPeakFrame = std::max(state.heapPeakFrame, state.heapLastFrame);
+                state.heapAtFrameStart = heap;
+                ++state.frame;
+
+                if (state.windowStart < 0.0)
+                {
+                    state.windowStart = time;
+                    state.lastDump = time;
+                    SampleWindow(state, heap);
+                }
+                else if (const double elapsed = time - state.windowStart; elapsed >= RateWindow)
+                {
+                    for (size_t i = 0; i < MemoryTagCount; ++i)
+                    {
+                        const TagCounters& counters = s_tags[i];
+                        state.allocationRate[i] = (counters.allocations.load(std::memory_order_relaxed) - state.windowAllocations[i]) / elapsed;
+                        state.byteRate[i] = (counters.allocatedBytes.load(std::memory_order_relaxed) - state.windowBytes[i]) / elapsed;
+                    }
+                    state.heapRate = (heap - state.windowHeap) / elapsed;
+                    state.windowStart = time;
+                    SampleWindow(state, heap);
+                }
+
+                if (state.dumpInterval > 0.0 && time - state.lastDump >= state.dumpInterval)
+                {
+                    state.lastDump = time;
+                    dump = true;
+                }
+            }
+
+            if (dump)
+                DumpToLog();
+        }
+
+        /**
+         * @brief Seconds between two log dumps made by EndFrame(), 0 disables them
+         */
+        static void SetDumpInterval(double seconds) noexcept
+        {
+            std::lock_guard lock {s_mutex};
+            s_rates.dumpInterval = seconds;
+        }
+
+        [[nodiscard]] static MemorySnapshot GetSnapshot()
+        {
+            MemorySnapshot snapshot;
+            for (size_t i = 0; i < MemoryTagCount; ++i)
+            {
+                const TagCounters& counters = s_tags[i];
+                MemoryTagStats& stats = snapshot.tags[i];
+                stats.tag = static_cast<MemoryTag>(i);
+                stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+                stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+                stats.allocations = counters.allocations.load(std::memory_order_relaxed);
+                stats.frees = counters.frees.load(std::memory_order_relaxed);
+                stats.allocatedBytes = counters.allocatedBytes.load(std::memory_order_relaxed);
+            }
+
+            snapshot.heapHookInstalled = s_heapHookInstalled.load(std::memory_order_relaxed);
+            snapshot.heapAllocations = s_heapAllocations.load(std::memory_order_relaxed);
+            snapshot.heapBytes = s_heapBytes.load(std::memory_order_relaxed);
+
+            std::lock_guard lock {s_mutex};
+            for (size_t i = 0; i < MemoryTagCount; ++i)
+            {
+                snapshot.tags[i].allocationsPerSecond = s_rates.allocationRate[i];
+                snapshot.tags[i].bytesPerSecond = s_rates.byteRate[i];
+            }
+
+            snapshot.frame = s_rates.frame;
+            snapshot.heapAllocationsLastFrame = s_rates.heapLastFrame;
+            snapshot.heapAllocationsPeakFrame = s_rates.heapPeakFrame;
+            snapshot.heapAllocationsPerSecond = s_rates.heapRate;
+            return snapshot;
+        }
+
+        /**
+         * @brief Restarts the high-water marks from the current live bytes, e.g. when a level is loaded
+         */
+        static void ResetPeaks() noexcept
+        {
+            for (TagCounters& counters : s_tags)
+                counters.peakBytes.store(counters.liveBytes.load(std::memory_order_relaxed), std::memory_order_relaxed);
+
+            std::lock_guard lock {s_mutex};
+            s_rates.heapPeakFrame = 0;
+        }
+
+        /**
+         * @brief Writes the snapshot to the core log, one line per tag that ever allocated
+         */
+        static void DumpToLog()
+        {
+            if (!Log::GetCoreLogger())
+                return;
+
+            const MemorySnapshot snapshot = GetSnapshot();
+            CORE_INFO("Memory at frame {}: {:.1f} KB live", snapshot.frame, snapshot.GetLiveBytes() / 1024.0);
+
+            for (const MemoryTagStats& stats : snapshot.tags)
+            {
+                if (stats.allocations == 0)
+                    continue;
+
+                CORE_INFO("  {:<8} live {:.1f} KB in {} allocations, peak {:.1f} KB, {:.0f} allocations/s, {:.1f} KB/s",
+                          ToString(stats.tag), stats.liveBytes / 1024.0, stats.GetLiveAllocations(),
+                          stats.peakBytes / 1024.0, stats.allocationsPerSecond, stats.bytesPerSecond / 1024.0);
+            }
+
+            if (snapshot.heapHookInstalled)
+                CORE_INFO("  Heap     {} allocations last frame, peak {} per frame, {:.0f} allocations/s",
+                          snapshot.heapAllocationsLastFrame, snapshot.heapAllocationsPeakFrame, snapshot.heapAllocationsPerSecond);
+        }
+
+    private:
+        using TagCounters = lux::detail::MemoryTagCounters;
+        using RateState = lux::detail::MemoryRateState;
+
+        // Constant initialized, so the operator new hook may count before main()
+        static inline constinit std::array<TagCounters, MemoryTagCount> s_tags {};
+        alignas(64) static inline constinit std::atomic<uint64_t> s_heapAllocations {0};
+        static inline constinit std::atomic<uint64_t> s_heapBytes {0};
+        static inline constinit std::atomic<bool> s_heapHookInstalled {false};
+
+        static inline std::mutex s_mutex;
+        static inline RateState s_rates;
+
+        [[nodiscard]] static TagCounters& Counters(MemoryTag tag) noexcept
+        {
+            CORE_ASSERT(tag < MemoryTag::COUNT, "MemoryTracker: invalid tag")
+            return s_tags[static_cast<size_t>(tag)];
+        }
+
+        static void SampleWindow(RateState& state, uint64_t heap) noexcept
+        {
+            for (size_t i = 0; i < MemoryTagCount; ++i)
+            {
+                state.windowAllocations[i] = s_tags[i].allocations.load(std::memory_order_relaxed);
+                state.windowBytes[i] = s_tags[i].allocatedBytes.load(std::memory_order_relaxed);
+            }
+            state.windowHeap = heap;
+        }
+    };
+
+    /**
+     * @brief std::pmr resource that reports every allocation under its tag and forwards it upstream
+     */
+    class TrackingResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit TrackingResource(MemoryTag tag, std::pmr::memory_resource* upstream = std::pmr::new_delete_resource()) noexcept
+            : m_tag{tag}, m_upstream{upstream} {}
+
+        [[nodiscard]] MemoryTag GetTag() const noexcept { return m_tag; }
+        [[nodiscard]] std::pmr::memory_resource* GetUpstream() const noexcept { return m_upstream; }
+
+    private:
+        MemoryTag m_tag;
+        std::pmr::memory_resource* m_upstream;
+
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            void* p = m_upstream->allocate(bytes, alignment);
+            MemoryTracker::OnAllocate(m_tag, bytes);
+            return p;
+        }
+
+        void do_deallocate(void* p, size_t bytes, size_t alignment) override
+        {
+            MemoryTracker::OnFree(m_tag, bytes);
+            m_upstream->deallocate(p, bytes, alignment);
+        }
+
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            auto* resource = dynamic_cast<const TrackingResource*>(&other);
+            return resource && resource->m_tag == m_tag && resource->m_upstream->is_equal(*m_upstream);
+        }
+    };
+
+    /**
+     * @brief Process wide heap resource of the tag, never destroyed so containers may outlive static destruction
+     */
+    [[nodiscard]] inline std::pmr::memory_resource* GetTaggedResource(MemoryTag tag) noexcept
+    {
+        static auto* resources = new std::array<TrackingResource, MemoryTagCount>
+        {
+            TrackingResource{MemoryTag::MESH},
+            TrackingResource{MemoryTag::TEXTURE},
+            TrackingResource{MemoryTag::SHADER},
+            TrackingResource{MemoryTag::SCENE},
+            TrackingResource{MemoryTag::EVENT},
+            TrackingResource{MemoryTag::TEMP},
+            TrackingResource{MemoryTag::UNTAGGED}
+        };
+
+        CORE_ASSERT(tag < MemoryTag::COUNT, "GetTaggedResource: invalid tag")
+        return &(*resources)[static_cast<size_t>(tag)];
+    }
+}
@@ -30,17 +30,426 @@
  */
 
 #pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <utility>
+#include <vector>
 
-class PoolAllocator
+#include "Allocator.hpp"
+#include "MemoryTracker.hpp"
+#include "../Application/Assertion.hpp"
+
+/*  Pool Allocator
+ *
+ *  Fixed size chunks for small objects that come and go one at a time (events, listeners,
+ *  scene nodes). Chunks are carved out of page aligned slabs; a free chunk stores the next
+ *  free chunk in its first bytes, so the free lists cost no memory and Allocate() / Free()
+ *  are a pointer pop / push. When the pool runs dry a new slab is added, slabs are only
+ *  returned to the system when the pool is destroyed.
+ *
+ *  Each thread keeps a magazine per pool, two private free lists of up to MagazineSize
+ *  chunks, so the common path takes no lock. A full list is handed to the pool's depot and
+ *  an empty one is refilled from it as a whole, both O(1) under the pool mutex. Chunks may be
+ *  freed on any thread. Chunks still sitting in a thread's magazine when the pool is
+ *  destroyed are simply forgotten with the slabs.
+ *
+ *  PoolResource exposes a pool as a std::pmr::memory_resource, requests that do not fit a
+ *  chunk go to the upstream resource. Slabs are reported to the MemoryTracker under the tag
+ *  given on construction.
+ *--------------------------------------------------------------------------------*/
+namespace lux
 {
-public:
+    class PoolAllocator
+    {
+        struct FreeChunk
+        {
+            FreeChunk* next;
+            FreeChunk* nextBatch;   // Links full lists in the depot, only meaningful on a list head
+        };
+
+        struct Central
+        {
+            MemoryTag tag;
+            size_t slabSize;
+            std::mutex mutex;
+            FreeChunk* depot = nullptr;     // Lists of exactly MagazineSize chunks
+            FreeChunk* freeList = nullptr;  // Loose chunks: fresh slabs and leftovers of exited threads
+            std::vector<std::byte*> slabs;
+
+            Central(MemoryTag tag, size_t slabSize) noexcept : tag{tag}, slabSize{slabSize} {}
+
+            ~Central()
+            {
+                for (std::byte* slab : slabs)
+                {
+                    MemoryTracker::OnFree(tag, slabSize);
+                    operator delete(slab, std::align_val_t{PageSize});
+                }
+            }
+        };
+
+    public:
+        static constexpr size_t ChunkAlignment = alignof(std::max_align_t);
+        static constexpr uint32_t MagazineSize = 64;
+
+        /**
+         * @param poolSize Bytes of each slab, rounded up to whole pages
+         * @param chunkSize Bytes of each chunk, rounded up to ChunkAlignment
+         * @param tag Subsystem the slabs are accounted to
+         */
+        PoolAllocator(size_t poolSize, size_t chunkSize, MemoryTag tag = MemoryTag::UNTAGGED) :
+            m_chunkSize{AlignUp(std::max(chunkSize, sizeof(FreeChunk)), ChunkAlignment)},
+            m_poolSize{AlignUp(std::max(poolSize, m_chunkSize), PageSize)},
+            m_id{NextPoolId()},
+            m_central{std::make_shared<Central>(tag, m_poolSize)}
+        {
+        }
+
+        ~PoolAllocator()
+        {
+            // Only this thread's magazine can be cleared here, the others notice the pool is gone
+            if (!m_central)
+                return;
+
+            if (Magazine* magazine = GetMagazine(); magazine && magazine->poolId == m_id)
+                *magazine = {};
+        }
+
+        PoolAllocator(const PoolAllocator&) = delete;
+        PoolAllocator& operator=(const PoolAllocator&) = delete;
+
+        PoolAllocator(PoolAllocator&&) noexcept = default;
+        PoolAllocator& operator=(PoolAllocator&&) noexcept = default;
+
+        [[nodiscard]] void* Allocate()
+        {
+            Magazine* magazine = GetMagazine();
+            if (magazine && magazine->poolId == m_id && magazine->loaded)
+            {
+                FreeChunk* chunk = magazine->loaded;
+                magazine->loaded = chunk->next;
+                --magazine->loadedCount;
+                return chunk;
+            }
+
+            return AllocateSlow(magazine);
+        }
+
+        void Free(void* ptr) noexcept
+        {
+            if (!ptr)
+                return;
+
+            auto* chunk = static_cast<FreeChunk*>(ptr);
+
+            Magazine* magazine = GetMagazine();
+            if (!magazine)
+            {
+                std::lock_guard lock {m_central->mutex};
+                chunk->next = m_central->freeList;
+                m_central->freeList = chunk;
+                return;
+            }
+
+            if (magazine->poolId != m_id)
+                Claim(*magazine);
+
+            if (magazine->loadedCount == MagazineSize)
+            {
+                if (magazine->previous)
+                {
+                    std::lock_guard lock {m_central->mutex};
+                    magazine->previous->nextBatch = m_central->depot;
+                    m_central->depot = magazine->previous;
+                }
+
+                magazine->previous = magazine->loaded;
+                magazine->loaded = nullptr;
+                magazine->loadedCount = 0;
+            }
+
+            chunk->next = magazine->loaded;
+            magazine->loaded = chunk;
+            ++magazine->loadedCount;
+        }
+
+        template<typename T, typename... Args>
+        T* New(Args&&... args)
+        {
+            static_assert(alignof(T) <= ChunkAlignment, "PoolAllocator: T is over-aligned");
+            CORE_ASSERT(sizeof(T) <= m_chunkSize, "PoolAllocator: T does not fit in a chunk")
+
+            void* chunk = Allocate();
+            try
+            {
+                return new (chunk) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                Free(chunk);
+                throw;
+            }
+        }
+
+        template<typename T>
+        void Delete(T* obj) noexcept
+        {
+            if (!obj)
+                return;
+
+            obj->~T();
+            Free(obj);
+        }
+
+        [[nodiscard]] size_t GetChunkSize() const noexcept { return m_chunkSize; }
+        [[nodiscard]] size_t GetPoolSize() const noexcept { return m_poolSize; }
+        [[nodiscard]] size_t GetChunksPerSlab() const noexcept { return m_poolSize / m_chunkSize; }
+        [[nodiscard]] MemoryTag GetTag() const noexcept { return m_central->tag; }
+
+        [[nodiscard]] size_t GetSlabCount() const
+        {
+            std::lock_guard lock {m_central->mutex};
+            return m_central->slabs.size();
+        }
+
+        /**
+         * @brief True if ptr points into one of the slabs, linear in the slab count, meant for asserts
+         */
+        [[nodiscard]] bool Owns(const void* ptr) const
+        {
+            std::lock_guard lock {m_central->mutex};
+            auto* p = static_cast<const std::byte*>(ptr);
+            return std::any_of(m_central->slabs.begin(), m_central->slabs.end(), [&](const std::byte* slab)
+            {
+                return p >= slab && p < slab + m_poolSize;
+            });
+        }
+
+    private:
+        struct Magazine
+        {
+            uint64_t poolId = 0;
+            FreeChunk* loaded = nullptr;
+            uint32_t loadedCount = 0;
+            FreeChunk* previous = nullptr;  // Either empty or exactly MagazineSize chunks
+            std::weak_ptr<Central> owner;
+        };
+
+        // A few direct mapped magazines per thread, a pool whose slot is taken evicts the occupant
+        struct ThreadCache
+        {
+            static constexpr size_t Slots = 8;
+            std::array<Magazine, Slots> magazines;
+            bool* destroyed;
+
+            ~ThreadCache()
+            {
+                for (Magazine& magazine : magazines)
+                    Release(magazine);
+
+                *destroyed = true;
+            }
+        };
+
+        size_t m_chunkSize;
+        size_t m_poolSize;
+        uint64_t m_id;
+        std::shared_ptr<Central> m_central;
+
+        static uint64_t NextPoolId() noexcept
+        {
+            static std::atomic<uint64_t> counter {0};
+            return ++counter;
+        }
+
+        /**
+         * @brief This thread's magazine slot for the pool, null once the thread is shutting down
+         */
+        [[nodiscard]] Magazine* GetMagazine() const noexcept
+        {
+            // The flag is trivially destructible, so pools destroyed after the cache can still read it
+            thread_local bool destroyed = false;
+            thread_local ThreadCache cache {{}, &destroyed};
+            return destroyed ? nullptr : &cache.magazines[m_id % ThreadCache::Slots];
+        }
+
+        /**
+         * @brief Gives every chunk of the magazine back to its pool, or drops them if the pool is gone
+         */
+        static void Release(Magazine& magazine) noexcept
+        {
+            if (auto central = magazine.owner.lock())
+            {
+                std::lock_guard lock {central->mutex};
+                if (magazine.previous)
+                {
+                    magazine.previous->nextBatch = central->depot;
+                    central->depot = magazine.previous;
+                }
+
+                for (FreeChunk* chunk = magazine.loaded; chunk;)
+                {
+                    FreeChunk* next = chunk->next;
+                    chunk->next = central->freeList;
+                    central->freeList = chunk;
+                    chunk = next;
+                }
+            }
+
+            magazine = {};
+        }
+
+        void Claim(Magazine& magazine) const noexcept
+        {
+            Release(magazine);
+            magazine.poolId = m_id;
+            magazine.owner = m_central;
+        }
+
+        void* AllocateSlow(Magazine* magazine)
+        {
+            if (!magazine)
+            {
+                std::lock_guard lock {m_central->mutex};
+                return TakeLoose();
+            }
+
+            if (magazine->poolId != m_id)
+                Claim(*magazine);
+
+            if (magazine->previous)
+            {
+                magazine->loaded = magazine->previous;
+                magazine->previous = nullptr;
+            }
+            else
+            {
+                std::lock_guard lock {m_central->mutex};
+                if (FreeChunk* batch = m_central->depot)
+                {
+                    m_central->depot = batch->nextBatch;
+                    magazine->loaded = batch;
+                }
+                else
+                {
+                    // Gather a list from the loose chunks, the caller's chunk comes on top of it
+                    FreeChunk* list = nullptr;
+                    try
+                    {
+                        for (uint32_t i = 0; i < MagazineSize; ++i)
+                        {
+                            FreeChunk* chunk = TakeLoose();
+                            chunk->next = list;
+                            list = chunk;
+                        }
+                    }
+                    catch (...)
+                    {
+                        // A slab could not be added, hand the partial list back to the loose chunks
+                        while (list)
+                        {
+                            FreeChunk* next = list->next;
+                            list->next = m_central->freeList;
+                            m_central->freeList = list;
+                            list = next;
+                        }
+                        throw;
+                    }
+                    magazine->loaded = list;
+                }
+            }
+
+            FreeChunk* chunk = magazine->loaded;
+            magazine->loaded = chunk->next;
+            magazine->loadedCount = MagazineSize - 1;
+            return chunk;
+        }
+
+        // Called with the mutex held
+        FreeChunk* TakeLoose()
+        {
+            if (!m_central->freeList)
+            {
+                if (FreeChunk* batch = m_central->depot)
+                {
+                    m_central->depot = batch->nextBatch;
+                    m_central->freeList = batch;
+                }
+                else
+                    AddSlab();
+            }
+
+            FreeChunk* chunk = m_central->freeList;
+            m_central->freeList = chunk->next;
+            return chunk;
+        }
+
+        // Called with the mutex held
+        void AddSlab()
+        {
+            // Make room first so the push_back below cannot throw and leak the slab
+            std::vector<std::byte*>& slabs = m_central->slabs;
+            if (slabs.size() == slabs.capacity())
+                slabs.reserve(std::max<size_t>(16, slabs.size() * 2));
+
+            auto* slab = static_cast<std::byte*>(operator new(m_poolSize, std::align_val_t{PageSize}));
+            slabs.push_back(slab);
+            MemoryTracker::OnAllocate(m_central->tag, m_poolSize);
+
+            for (size_t i = GetChunksPerSlab(); i-- > 0;)
+            {
+                auto* chunk = reinterpret_cast<FreeChunk*>(slab + i * m_chunkSize);
+                chunk->next = m_central->freeList;
+                m_central->freeList = chunk;
+            }
+        }
+    };
+
+    /**
+     * @brief std::pmr adapter over a PoolAllocator, larger or over-aligned requests go upstream
+     */
+    class PoolResource : public std::pmr::memory_resource
+    {
+    public:
+        explicit PoolResource(PoolAllocator& pool, std::pmr::memory_resource* upstream = std::pmr::get_default_resource()) noexcept
+            : m_pool{pool}, m_upstream{upstream} {}
+
+        [[nodiscard]] PoolAllocator& GetPool() const noexcept { return m_pool; }
+        [[nodiscard]] std::pmr::memory_resource* GetUpstream() const noexcept { return m_upstream; }
+
+    private:
+        PoolAllocator& m_pool;
+        std::pmr::memory_resource* m_upstream;
 
-    PoolAllocator(size_t poolSize, size_t chunkSize);
+        [[nodiscard]] bool FitsChunk(size_t bytes, size_t alignment) const noexcept
+        {
+            return bytes <= m_pool.GetChunkSize() && alignment <= PoolAllocator::ChunkAlignment;
+        }
 
+        void* do_allocate(size_t bytes, size_t alignment) override
+        {
+            return FitsChunk(bytes, alignment) ? m_pool.Allocate() : m_upstream->allocate(bytes, alignment);
+        }
 
-private:
+        void do_deallocate(void* ptr, size_t bytes, size_t alignment) override
+        {
+            if (FitsChunk(bytes, alignment))
+                m_pool.Free(ptr);
+            else
+                m_upstream->deallocate(ptr, bytes, alignment);
+        }
 
-    size_t m_poolSize;
-    size_t m_chunkSize;
-};
\ No newline at end of file
+        [[nodiscard]] bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override
+        {
+            auto* resource = dynamic_cast<const PoolResource*>(&other);
+            return resource && &resource->m_pool == &m_pool && resource->m_upstream->is_equal(*m_upstream);
+        }
+    };
+}
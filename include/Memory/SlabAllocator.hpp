@@ -0,0 +1,670 @@
+/*
+ * Project: TestProject
+ * File: SlabAllocator.hpp
+ * Author: olegfresi
+ * Created: 17/10/26 14:40
+ *
+ * Copyright © 2026 olegfresi
+ *
+ * Licensed under the MIT License. You may obtain a copy of the License at:
+ *
+ *     https://opensource.org/licenses/MIT
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+ * SOFTWARE.
+ */
+#pragma once
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Allocator.hpp"
+#include "MemoryTracker.hpp"
+#include "../Application/Assertion.hpp"
+
+/*  Slab Allocator
+ *
+ *  General purpose allocator for objects up to MaxSmallSize bytes made and dropped by several
+ *  threads at once (cull jobs, parse jobs, command recording). Requests are rounded up to one
+ *  of ClassCount size classes and served from 64 KB slabs, each slab holding blocks of a single
+ *  class. The slab header sits at the start of the slab and slabs are aligned to their size,
+ *  so Free() finds it by masking the pointer and needs no size.
+ *
+ *  Every thread allocates from its own heap: a list of slabs with free blocks per class, so
+ *  Allocate() and a Free() on the allocating thread are a pointer pop / push with no atomics.
+ *  A block freed by another thread is pushed on its slab's remote free stack with one CAS;
+ *  the first such push also queues the slab on the owning heap, which takes the blocks back
+ *  on its next slow path. The only lock guards the slab and heap lists, taken when a heap
+ *  needs a fresh slab or a thread gets its heap. A thread that exits leaves its heap and its
+ *  slabs to the next thread that asks for one.
+ *
+ *  Larger or over-aligned requests get a slab of their own straight from operator new. Slabs,
+ *  large ones included, are reported to the MemoryTracker under the allocator's tag.
+ *  GetStats() sums the per heap counters; SlabStdAllocator<T> adapts the allocator to the
+ *  standard allocator interface, which is how CreateRef / CreateScope use it.
+ *--------------------------------------------------------------------------------*/
+namespace lux
+{
+    class SlabAllocator
+    {
+        struct FreeBlock
+        {
+            FreeBlock* next;
+        };
+
+        struct Heap;
+
+    public:
+        static constexpr size_t SlabSize = 64 * 1024;
+        static constexpr size_t MaxSmallSize = 8 * 1024;
+        static constexpr size_t BlockAlignment = alignof(std::max_align_t);
+        static constexpr size_t CacheLine = 64;
+
+        /**
+         * @brief Sixteen byte steps up to 128, then four classes per power of two up to MaxSmallSize
+         */
+        static constexpr uint32_t ClassCount = 8 + 4 * 6;
+
+        struct Stats
+        {
+            uint64_t allocations = 0;
+            uint64_t frees = 0;
+            uint64_t remoteFrees = 0;   // Frees on a thread other than the allocating one
+            uint64_t liveBytes = 0;     // Rounded up to the size class, approximate while other threads run
+            size_t slabCount = 0;
+            size_t heapCount = 0;
+            size_t reservedBytes = 0;   // Small slabs plus live large allocations
+        };
+
+        /**
+         * @param tag Subsystem the slabs are accounted to
+         */
+        explicit SlabAllocator(MemoryTag tag = MemoryTag::UNTAGGED) : m_id{NextAllocatorId()}, m_central{std::make_shared<Central>(tag)} {}
+
+        ~SlabAllocator()
+        {
+            // Only this thread's slot can be cleared here, the others notice the allocator is gone
+            if (CacheSlot* slot = GetSlot(); slot && slot->allocatorId == m_id)
+                Abandon(*slot);
+        }
+
+        SlabAllocator(const SlabAllocator&) = delete;
+        SlabAllocator& operator=(const SlabAllocator&) = delete;
+
+        /**
+         * @brief Process wide allocator, never destroyed so objects may outlive static destruction
+         */
+        static SlabAllocator& Default()
+        {
+            static auto* allocator = new SlabAllocator{};
+            return *allocator;
+        }
+
+        [[nodiscard]] static constexpr uint32_t SizeClassOf(size_t size) noexcept
+        {
+            if (size <= 128)
+                return static_cast<uint32_t>(size == 0 ? 0 : (size - 1) / 16);
+
+            const size_t rounded = size - 1;
+            const int msb = std::bit_width(rounded) - 1;
+            return static_cast<uint32_t>(8 + (msb - 7) * 4 + ((rounded >> (msb - 2)) - 4));
+        }
+
+        [[nodiscard]] static constexpr size_t ClassSize(uint32_t sizeClass) noexcept
+        {
+            if (sizeClass < 8)
+                return (sizeClass + 1) * 16;
+
+            const uint32_t group = (sizeClass - 8) / 4;
+            return (size_t{128} << group) + ((sizeClass - 8) % 4 + 1) * (size_t{32} << group);
+        }
+
+        [[nodiscard]] void* Allocate(size_t size, size_t alignment = BlockAlignment)
+        {
+            Heap* heap = size <= MaxSmallSize && alignment <= BlockAlignment ? GetHeap() : nullptr;
+            if (!heap)
+                return AllocateLarge(size, alignment);
+
+            const uint32_t sizeClass = SizeClassOf(size);
+            if (Slab* slab = heap->available[sizeClass])
+                return Pop(*heap, *slab);
+
+            return AllocateSlow(*heap, sizeClass);
+        }
+
+        /**
+         * @brief Frees a block from any thread, ptr may come from Allocate() on another thread
+         */
+        void Free(void* ptr) noexcept
+        {
+            if (!ptr)
+                return;
+
+            Slab* slab = SlabOf(ptr);
+            Heap* heap = FindHeap();
+
+            if (slab->sizeClass == LargeClass)
+            {
+                FreeLarge(heap, slab);
+                return;
+            }
+
+            auto* block = static_cast<FreeBlock*>(ptr);
+            if (heap && heap == slab->heap)
+            {
+                Count(heap->frees, 1);
+                Count(heap->freedBytes, slab->blockSize);
+
+                block->next = slab->freeList;
+                slab->freeList = block;
+                --slab->used;
+
+                if (!slab->available)
+                    Link(*heap, *slab);
+                else if (slab->used == 0)
+                    Retire(*heap, *slab);
+                return;
+            }
+
+            if (heap)
+            {
+                Count(heap->frees, 1);
+                Count(heap->remoteFrees, 1);
+                Count(heap->freedBytes, slab->blockSize);
+            }
+            else
+            {
+                m_central->frees.fetch_add(1, std::memory_order_relaxed);
+                m_central->remoteFrees.fetch_add(1, std::memory_order_relaxed);
+                m_central->freedBytes.fetch_add(slab->blockSize, std::memory_order_relaxed);
+            }
+
+            PushRemote(*slab, block);
+        }
+
+        template<typename T, typename... Args>
+        T* New(Args&&... args)
+        {
+            void* memory = Allocate(sizeof(T), alignof(T));
+            try
+            {
+                return new (memory) T(std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                Free(memory);
+                throw;
+            }
+        }
+
+        template<typename T>
+        void Delete(T* obj) noexcept
+        {
+            if (!obj)
+                return;
+
+            // Through a base pointer the block starts at the most derived object
+            void* memory;
+            if constexpr (std::is_polymorphic_v<T>)
+                memory = dynamic_cast<void*>(obj);
+            else
+                memory = obj;
+
+            obj->~T();
+            Free(memory);
+        }
+
+        [[nodiscard]] Stats GetStats() const
+        {
+            std::lock_guard lock {m_central->mutex};
+            const Central& central = *m_central;
+
+            Stats stats;
+            uint64_t allocatedBytes = central.allocatedBytes.load(std::memory_order_relaxed);
+            uint64_t freedBytes = central.freedBytes.load(std::memory_order_relaxed);
+            stats.allocations = central.allocations.load(std::memory_order_relaxed);
+            stats.frees = central.frees.load(std::memory_order_relaxed);
+            stats.remoteFrees = central.remoteFrees.load(std::memory_order_relaxed);
+
+            for (const auto& heap : central.heaps)
+            {
+                stats.allocations += heap->allocations.load(std::memory_order_relaxed);
+                stats.frees += heap->frees.load(std::memory_order_relaxed);
+                stats.remoteFrees += heap->remoteFrees.load(std::memory_order_relaxed);
+                allocatedBytes += heap->allocatedBytes.load(std::memory_order_relaxed);
+                freedBytes += heap->freedBytes.load(std::memory_order_relaxed);
+            }
+
+            stats.liveBytes = allocatedBytes > freedBytes ? allocatedBytes - freedBytes : 0;
+            stats.slabCount = central.slabs.size();
+            stats.heapCount = central.heaps.size();
+            stats.reservedBytes = central.slabs.size() * SlabSize + central.largeBytes.load(std::memory_order_relaxed);
+            return stats;
+        }
+
+        [[nodiscard]] MemoryTag GetTag() const noexcept { return m_central->tag; }
+
+    private:
+        static constexpr uint32_t LargeClass = std::numeric_limits<uint32_t>::max();
+
+        struct alignas(CacheLine) Slab
+        {
+            // Owner heap only
+            FreeBlock* freeList = nullptr;
+            Slab* prev = nullptr;           // Links the heap's slabs with free blocks of this class
+            Slab* next = nullptr;
+            Heap* heap = nullptr;
+            size_t blockSize = 0;           // Whole allocation for a large slab
+            uint32_t sizeClass = 0;
+            uint32_t used = 0;              // Blocks handed out, remote frees count until collected
+            bool available = false;
+
+            // Any thread
+            alignas(CacheLine) std::atomic<FreeBlock*> remoteFree {nullptr};
+            Slab* pendingNext = nullptr;    // Written by the thread that queues the slab on its heap
+        };
+
+        static constexpr size_t HeaderSize = AlignUp(sizeof(Slab), BlockAlignment);
+
+        // Counters written by the owning thread only and read by GetStats(), so no read-modify-write
+        using Counter = std::atomic<uint64_t>;
+
+        struct Heap
+        {
+            std::array<Slab*, ClassCount> available {};
+            bool owned = false;                 // Guarded by Central::mutex
+
+            Counter allocations {0};
+            Counter frees {0};
+            Counter remoteFrees {0};
+            Counter allocatedBytes {0};
+            Counter freedBytes {0};
+
+            alignas(CacheLine) std::atomic<Slab*> pending {nullptr};   // Slabs that got remote frees
+        };
+
+        struct Central
+        {
+            MemoryTag tag;
+            std::mutex mutex;
+            std::vector<std::unique_ptr<Heap>> heaps;
+            std::vector<Slab*> slabs;       // Every small slab, for teardown and stats
+            std::vector<Slab*> freeSlabs;   // Empty slabs any heap may take for any class
+
+            // Requests made while a thread is shutting down and has no heap, and large slabs
+            std::atomic<uint64_t> allocations {0};
+            std::atomic<uint64_t> frees {0};
+            std::atomic<uint64_t> remoteFrees {0};
+            std::atomic<uint64_t> allocatedBytes {0};
+            std::atomic<uint64_t> freedBytes {0};
+            std::atomic<size_t> largeBytes {0};
+
+            explicit Central(MemoryTag tag) noexcept : tag{tag} {}
+
+            ~Central()
+            {
+                for (Slab* slab : slabs)
+                {
+                    MemoryTracker::OnFree(tag, SlabSize);
+                    ReleaseMemory(slab);
+                }
+            }
+        };
+
+        struct CacheSlot
+        {
+            uint64_t allocatorId = 0;
+            Heap* heap = nullptr;
+            std::weak_ptr<Central> owner;
+        };
+
+        // A few direct mapped slots per thread, an allocator whose slot is taken evicts the occupant
+        struct ThreadCache
+        {
+            static constexpr size_t Slots = 8;
+            std::array<CacheSlot, Slots> slots;
+            bool* destroyed;
+
+            ~ThreadCache()
+            {
+                for (CacheSlot& slot : slots)
+                    Abandon(slot);
+
+                *destroyed = true;
+            }
+        };
+
+        uint64_t m_id;
+        std::shared_ptr<Central> m_central;
+
+        static uint64_t NextAllocatorId() noexcept
+        {
+            static std::atomic<uint64_t> counter {0};
+            return ++counter;
+        }
+
+        [[nodiscard]] static Slab* SlabOf(void* ptr) noexcept
+        {
+            return reinterpret_cast<Slab*>(reinterpret_cast<uintptr_t>(ptr) & ~(uintptr_t{SlabSize} - 1));
+        }
+
+        static void Count(Counter& counter, uint64_t value) noexcept
+        {
+            counter.store(counter.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+        }
+
+        static void ReleaseMemory(Slab* slab) noexcept
+        {
+            slab->~Slab();
+            operator delete(slab, std::align_val_t{SlabSize});
+        }
+
+        /**
+         * @brief This thread's slot for the allocator, null once the thread is shutting down
+         */
+        [[nodiscard]] CacheSlot* GetSlot() const noexcept
+        {
+            // The flag is trivially destructible, so allocators destroyed after the cache can still read it
+            thread_local bool destroyed = false;
+            thread_local ThreadCache cache {{}, &destroyed};
+            return destroyed ? nullptr : &cache.slots[m_id % ThreadCache::Slots];
+        }
+
+        [[nodiscard]] Heap* FindHeap() const noexcept
+        {
+            CacheSlot* slot = GetSlot();
+            return slot && slot->allocatorId == m_id ? slot->heap : nullptr;
+        }
+
+        [[nodiscard]] Heap* GetHeap()
+        {
+            CacheSlot* slot = GetSlot();
+            if (!slot)
+                return nullptr;
+
+            if (slot->allocatorId != m_id)
+            {
+                Abandon(*slot);
+
+                std::lock_guard lock {m_central->mutex};
+                auto& heaps = m_central->heaps;
+                auto free = std::find_if(heaps.begin(), heaps.end(), [](const auto& heap) { return !heap->owned; });
+                Heap* heap = free != heaps.end() ? free->get() : heaps.emplace_back(std::make_unique<Heap>()).get();
+                heap->owned = true;
+
+                *slot = {m_id, heap, m_central};
+            }
+
+            return slot->heap;
+        }
+
+        /**
+         * @brief Hands the slot's heap back to its allocator for another thread to take over
+         */
+        static void Abandon(CacheSlot& slot) noexcept
+        {
+            if (auto central = slot.owner.lock())
+            {
+                std::lock_guard lock {central->mutex};
+                slot.heap->owned = false;
+            }
+
+            slot = {};
+        }
+
+        static void Link(Heap& heap, Slab& slab) noexcept
+        {
+            Slab*& head = heap.available[slab.sizeClass];
+            slab.prev = nullptr;
+            slab.next = head;
+            if (head)
+                head->prev = &slab;
+
+            head = &slab;
+            slab.available = true;
+        }
+
+        static void Unlink(Heap& heap, Slab& slab) noexcept
+        {
+            (slab.prev ? slab.prev->next : heap.available[slab.sizeClass]) = slab.next;
+            if (slab.next)
+                slab.next->prev = slab.prev;
+
+            slab.prev = slab.next = nullptr;
+            slab.available = false;
+        }
+
+        static void* Pop(Heap& heap, Slab& slab) noexcept
+        {
+            FreeBlock* block = slab.freeList;
+            slab.freeList = block->next;
+            ++slab.used;
+
+            if (!slab.freeList)
+                Unlink(heap, slab);
+
+            Count(heap.allocations, 1);
+            Count(heap.allocatedBytes, slab.blockSize);
+            return block;
+        }
+
+        void* AllocateSlow(Heap& heap, uint32_t sizeClass)
+        {
+            CollectRemote(heap);
+            if (Slab* slab = heap.available[sizeClass])
+                return Pop(heap, *slab);
+
+            Slab* slab = nullptr;
+            {
+                std::lock_guard lock {m_central->mutex};
+                if (!m_central->freeSlabs.empty())
+                {
+                    slab = m_central->freeSlabs.back();
+                    m_central->freeSlabs.pop_back();
+                }
+                else
+                {
+                    // Make room first so neither push_back below nor Retire() can throw
+                    std::vector<Slab*>& slabs = m_central->slabs;
+                    if (slabs.size() == slabs.capacity())
+                        slabs.reserve(std::max<size_t>(16, slabs.size() * 2));
+                    m_central->freeSlabs.reserve(slabs.capacity());
+
+                    slab = new (operator new(SlabSize, std::align_val_t{SlabSize})) Slab{};
+                    slabs.push_back(slab);
+                    MemoryTracker::OnAllocate(m_central->tag, SlabSize);
+                }
+            }
+
+            // Thread the free list through the blocks, lowest address first
+            const size_t blockSize = ClassSize(sizeClass);
+            const size_t capacity = (SlabSize - HeaderSize) / blockSize;
+            auto* first = reinterpret_cast<std::byte*>(slab) + HeaderSize;
+            for (size_t i = 0; i + 1 < capacity; ++i)
+                reinterpret_cast<FreeBlock*>(first + i * blockSize)->next = reinterpret_cast<FreeBlock*>(first + (i + 1) * blockSize);
+            reinterpret_cast<FreeBlock*>(first + (capacity - 1) * blockSize)->next = nullptr;
+
+            slab->freeList = reinterpret_cast<FreeBlock*>(first);
+            slab->heap = &heap;
+            slab->blockSize = blockSize;
+            slab->sizeClass = sizeClass;
+            slab->used = 0;
+            Link(heap, *slab);
+
+            return Pop(heap, *slab);
+        }
+
+        /**
+         * @brief Takes back the blocks other threads freed into this heap's slabs
+         */
+        void CollectRemote(Heap& heap) noexcept
+        {
+            Slab* slab = heap.pending.exchange(nullptr, std::memory_order_acquire);
+            while (slab)
+            {
+                // Read the link first: once the stack is emptied another free may queue the slab again,
+                // the release half orders this read before that free rewrites the link
+                Slab* next = slab->pendingNext;
+                FreeBlock* list = slab->remoteFree.exchange(nullptr, std::memory_order_acq_rel);
+
+                if (list)
+                {
+                    uint32_t count = 1;
+                    FreeBlock* tail = list;
+                    for (; tail->next; tail = tail->next)
+                        ++count;
+
+                    tail->next = slab->freeList;
+                    slab->freeList = list;
+                    slab->used -= count;
+
+                    if (!slab->available)
+                        Link(heap, *slab);
+                    else if (slab->used == 0)
+                        Retire(heap, *slab);
+                }
+
+                slab = next;
+            }
+        }
+
+        /**
+         * @brief Queues a block freed by another thread, the first one also queues the slab on its heap
+         */
+        static void PushRemote(Slab& slab, FreeBlock* block) noexcept
+        {
+            FreeBlock* head = slab.remoteFree.load(std::memory_order_relaxed);
+            do
+                block->next = head;
+            while (!slab.remoteFree.compare_exchange_weak(head, block, std::memory_order_acq_rel, std::memory_order_relaxed));
+
+            if (head)
+                return;
+
+            Heap& heap = *slab.heap;
+            Slab* top = heap.pending.load(std::memory_order_relaxed);
+            do
+                slab.pendingNext = top;
+            while (!heap.pending.compare_exchange_weak(top, &slab, std::memory_order_release, std::memory_order_relaxed));
+        }
+
+        /**
+         * @brief Returns an empty slab to the shared list, the last one of its class stays with the heap
+         */
+        void Retire(Heap& heap, Slab& slab) noexcept
+        {
+            if (!slab.prev && !slab.next)
+                return;
+
+            Unlink(heap, slab);
+            slab.freeList = nullptr;
+            slab.heap = nullptr;
+
+            std::lock_guard lock {m_central->mutex};
+            m_central->freeSlabs.push_back(&slab);
+        }
+
+        void* AllocateLarge(size_t size, size_t alignment)
+        {
+            CORE_ASSERT(IsPowerOfTwo(alignment) && alignment <= PageSize, "SlabAllocator: alignment must be a power of two up to a page")
+
+            // The header stays within the first SlabSize bytes, so SlabOf() finds it from the block
+            const size_t offset = std::max(HeaderSize, alignment);
+            auto* slab = new (operator new(offset + size, std::align_val_t{SlabSize})) Slab{};
+            slab->sizeClass = LargeClass;
+            slab->blockSize = offset + size;
+
+            m_central->largeBytes.fetch_add(slab->blockSize, std::memory_order_relaxed);
+            MemoryTracker::OnAllocate(m_central->tag, slab->blockSize);
+            if (Heap* heap = FindHeap())
+            {
+                Count(heap->allocations, 1);
+                Count(heap->allocatedBytes, slab->blockSize);
+            }
+            else
+            {
+                m_central->allocations.fetch_add(1, std::memory_order_relaxed);
+                m_central->allocatedBytes.fetch_add(slab->blockSize, std::memory_order_relaxed);
+            }
+
+            return reinterpret_cast<std::byte*>(slab) + offset;
+        }
+
+        void FreeLarge(Heap* heap, Slab* slab) noexcept
+        {
+            m_central->largeBytes.fetch_sub(slab->blockSize, std::memory_order_relaxed);
+            MemoryTracker::OnFree(m_central->tag, slab->blockSize);
+            if (heap)
+            {
+                Count(heap->frees, 1);
+                Count(heap->freedBytes, slab->blockSize);
+            }
+            else
+            {
+                m_central->frees.fetch_add(1, std::memory_order_relaxed);
+                m_central->freedBytes.fetch_add(slab->blockSize, std::memory_order_relaxed);
+            }
+
+            ReleaseMemory(slab);
+        }
+    };
+
+    /**
+     * @brief Standard allocator over a SlabAllocator, for containers and CreateRef / CreateScope
+     */
+    template<typename T>
+    class SlabStdAllocator
+    {
+    public:
+        using value_type = T;
+
+        SlabStdAllocator() noexcept : m_allocator{&SlabAllocator::Default()} {}
+        explicit SlabStdAllocator(SlabAllocator& allocator) noexcept : m_allocator{&allocator} {}
+
+        template<typename U>
+        SlabStdAllocator(const SlabStdAllocator<U>& other) noexcept : m_allocator{&other.GetAllocator()} {}
+
+        [[nodiscard]] T* allocate(size_t count)
+        {
+            if (count > std::numeric_limits<size_t>::max() / sizeof(T))
+                throw std::bad_array_new_length();
+
+            return static_cast<T*>(m_allocator->Allocate(count * sizeof(T), alignof(T)));
+        }
+
+        void deallocate(T* ptr, size_t) noexcept { m_allocator->Free(ptr); }
+
+        [[nodiscard]] SlabAllocator& GetAllocator() const noexcept { return *m_allocator; }
+
+        template<typename U>
+        bool operator==(const SlabStdAllocator<U>& other) const noexcept { return m_allocator == &other.GetAllocator(); }
+
+    private:
+        SlabAllocator* m_allocator;
+    };
+}
@@ -67,10 +67,10 @@ namespace lux
             GLCheck(glBufferData(static_cast<GLenum>(m_type), m_size, data, static_cast<GLenum >(usage)));
         }
 
-        void Update(const void* data) override
+        void Update(const void* data, size_t size) override
         {
             BindBuffer();
-            GLCheck(glBufferSubData(static_cast<GLenum>(m_type), 0, sizeof(data), data));
+            GLCheck(glBufferSubData(static_cast<GLenum>(m_type), 0, static_cast<GLsizeiptr>(size), data));
             UnbindBuffer();
         }
 
@@ -29,6 +29,7 @@
  * SOFTWARE.
  */
 #pragma once
+#include <span>
 #include <vector>
 #include <memory>
 #include "../../OpenGL/OpenglError.hpp"
@@ -59,7 +60,7 @@ namespace lux
         virtual void BindBuffer() = 0;
         virtual void UnbindBuffer() = 0;
         virtual void SetData(const void* data, BufferUsage usage) = 0;
-        virtual void Update(const void* data) = 0;
+        virtual void Update(const void* data, size_t size) = 0;
         virtual void SetDataSize(uint32_t size) = 0;
         virtual uint32_t GetId() const noexcept = 0;
         virtual size_t GetSize() const noexcept = 0;
@@ -85,8 +86,8 @@ namespace lux
 
         virtual ~Buffer() = default;
 
-        template <typename T>
-        void SetData(const std::vector<T>& data, BufferUsage usage, const Scope<IVertexLayout>& l) noexcept
+        template <typename T, typename Alloc>
+        void SetData(const std::vector<T, Alloc>& data, BufferUsage usage, const Scope<IVertexLayout>& l) noexcept
         {
             CORE_ASSERT(l != nullptr, "Layout is null");
             l->Bind();
@@ -98,8 +99,14 @@ namespace lux
         void BindBuffer() const noexcept;
         void UnbindBuffer() const noexcept;
 
+        /**
+         * @brief Overwrites the start of the buffer, data must not be larger than the size given to SetData
+         */
         template <typename T>
-        void Update(const std::vector<T>& data) noexcept { m_buffer->Update( data.data()); }
+        void Update(std::span<const T> data) noexcept { m_buffer->Update(data.data(), data.size_bytes()); }
+
+        template <typename T, typename Alloc>
+        void Update(const std::vector<T, Alloc>& data) noexcept { Update(std::span<const T>{data}); }
 
         [[nodiscard]] size_t GetSize() const noexcept { return m_buffer->GetSize(); }
         [[nodiscard]] uint32_t GetId() const noexcept { return m_buffer->GetId(); }
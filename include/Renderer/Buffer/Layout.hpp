@@ -33,6 +33,8 @@
 #include <unordered_map>
 #include <iostream>
 #include "../Mesh/Vertex.hpp"
+#include "../../Math/NormalMatrix.hpp"
+#include "../../Math/VertexCompression.hpp"
 
 namespace lux
 {
@@ -87,12 +89,64 @@ namespace lux
             stride += sizeof(T);
         }
 
+        /**
+         * @brief Adds an attribute of components values of dataType taking sizeInBytes, padding included
+         */
+        void Push(GPUPrimitiveDataType dataType, int components, uint32_t sizeInBytes, bool normalized, bool instanced)
+        {
+            attributes.push_back({
+                index++,
+                components,
+                dataType,
+                normalized,
+                0,
+                reinterpret_cast <void *>(offset),
+                instanced ? 1u : 0u
+            });
+
+            offset += sizeInBytes;
+            stride += sizeInBytes;
+        }
+
         void Finalize()
         {
             for (auto &e : attributes)
                 e.stride = stride;
         }
 
+        /**
+         * @brief Attributes 0-2 for math::CompressedVertex, 16 bytes instead of 32 per vertex
+         *
+         * Position and uv arrive as normalized unsigned shorts and the normal as two normalized shorts, the
+         * vertex shader applies the VertexQuantization and decodes the octahedral normal.
+         */
+        static Layout Compressed()
+        {
+            Layout layout;
+            layout.Push(GPUPrimitiveDataType::UNSIGNED_SHORT, 3, 4 * sizeof(uint16_t), true, false);
+            layout.Push(GPUPrimitiveDataType::UNSIGNED_SHORT, 2, 2 * sizeof(uint16_t), true, false);
+            layout.Push(GPUPrimitiveDataType::SHORT, 2, 2 * sizeof(int16_t), true, false);
+            layout.Finalize();
+
+            CORE_ASSERT(layout.stride == sizeof(math::CompressedVertex), "Compressed layout does not match CompressedVertex")
+            return layout;
+        }
+
+        /**
+         * @brief Three instanced vec3 attributes from firstIndex on, the columns of one math::PackedNormalMatrix per instance
+         */
+        static Layout NormalMatrices(uint32_t firstIndex)
+        {
+            Layout layout;
+            layout.index = firstIndex;
+            for (int column = 0; column < 3; ++column)
+                layout.Push(GPUPrimitiveDataType::FLOAT, 3, 4 * sizeof(float), false, true);
+            layout.Finalize();
+
+            CORE_ASSERT(layout.stride == sizeof(math::PackedNormalMatrix), "Normal matrix layout does not match PackedNormalMatrix")
+            return layout;
+        }
+
         uint32_t index = 0;
         uint32_t stride = 0;
         std::size_t offset = 0;
@@ -45,7 +45,16 @@ namespace lux
 
         [[nodiscard]] const auto& GetViewToScreen() const noexcept { return m_viewToScreen; }
         [[nodiscard]] const auto& GetView() const noexcept { return m_view; }
+        [[nodiscard]] Matrix4f GetInverseView() const { return m_view.InverseRigid(); }
         [[nodiscard]] const auto& GetProjection() const noexcept { return m_projection; }
+
+        /**
+         * @brief World to clip matrix equal to the shaders' projection * view, as Frustum::FromMatrix() expects
+         *
+         * Uniforms are uploaded from Data() without transposing, so the GPU sees the transpose of each
+         * stored matrix. operator* stores the transposed product, hence the view * projection order.
+         */
+        [[nodiscard]] Matrix4f GetViewProjection() const { return m_view * m_projection; }
         [[nodiscard]] const auto& GetTransform() const noexcept { return m_transform; }
         [[nodiscard]] const auto& GetPosition() const noexcept { return m_pos; }
         [[nodiscard]] const auto& GetFront() const noexcept { return m_front; }
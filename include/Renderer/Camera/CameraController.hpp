@@ -30,6 +30,7 @@
  */
 #pragma once
 #include "Camera.hpp"
+#include "../../Math/Geometry/Spline.hpp"
 #include "../../Input/ActionMapper.hpp"
 #include "../../Event/Events.hpp"
 #include "../../Event/EventSystem.hpp"
@@ -71,6 +72,16 @@ namespace lux
         Camera& GetCamera() { return m_camera; }
         const Camera& GetCamera() const { return m_camera; }
 
+        /**
+         * @brief Moves the camera along spline at speed units per second, facing along the curve
+         *
+         * The controller only keeps the pointer, the spline must outlive the flythrough. Manual
+         * movement is ignored until StopFollowing().
+         */
+        void FollowSpline(NonOwnPtr<const Spline> spline, float speed, bool loop = true) noexcept;
+        void StopFollowing() noexcept { m_spline = nullptr; }
+        [[nodiscard]] bool IsFollowingSpline() const noexcept { return m_spline != nullptr; }
+
         void UpdateCamera(double deltaTime) noexcept;
 
         void OnAction(const ActionEvent& action) noexcept;
@@ -79,6 +90,7 @@ namespace lux
         void OnMouseScroll(const MouseScrollEvent& e) noexcept;
 
     private:
+        void AdvanceAlongSpline(double deltaTime) noexcept;
 
         Vector3f m_targetPosition = {0.0f, 0.0f, 0.0f};
         float m_orbitRadius = 5.0f;
@@ -96,5 +108,10 @@ namespace lux
         uint32_t m_listenerId;
         std::bitset<static_cast<size_t>(InputAction::ActionLast)> m_activeActions;
         NonOwnPtr<EventDispatcher> m_dispatcher;
+
+        NonOwnPtr<const Spline> m_spline = nullptr;
+        float m_splineSpeed = 0.0f;
+        float m_splineDistance = 0.0f;
+        bool m_splineLoop = true;
     };
 }
\ No newline at end of file
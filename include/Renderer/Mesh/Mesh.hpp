@@ -29,13 +29,18 @@
  * SOFTWARE.
  */
 #pragma once
+#include <span>
 #include <vector>
 #include "../Texture/Texture2D.hpp"
 #include "../Shader/Shader.hpp"
 #include "../Buffer/Buffer.hpp"
 #include "MeshParsers/ObjParser.hpp"
+#include "../../Memory/MemoryTracker.hpp"
 #include "../../OpenGL/MeshRenderer.hpp"
 #include "../../Math/Transform.hpp"
+#include "../../Math/Geometry/Sphere.hpp"
+#include "../../Math/NormalMatrix.hpp"
+#include "../../Math/VertexCompression.hpp"
 
 namespace lux
 {
@@ -60,7 +65,7 @@ namespace lux
             if (filePath.extension() == ".obj")
             {
                 MaterialParser materialParser;
-                OBJParser parser;
+                OBJParser parser {std::pmr::get_default_resource(), GetTaggedResource(MemoryTag::MESH)};
                 m_meshData = parser.ParseMesh(filePath);
                 m_materials = materialParser.ParseMaterial(materialPath);
             }
@@ -76,7 +81,7 @@ namespace lux
         {
             if (filePath.extension() == ".obj")
             {
-                OBJParser parser;
+                OBJParser parser {std::pmr::get_default_resource(), GetTaggedResource(MemoryTag::MESH)};
                 m_meshData = parser.ParseMesh(filePath);
             }
         }
@@ -93,6 +98,25 @@ namespace lux
 
         void SetupMesh() noexcept;
         void SetupMeshInstanced(const std::vector<Transform>& instanceMatrices) noexcept;
+
+        /**
+         * @brief Uploads the vertices as 16 byte CompressedVertex with Layout::Compressed(), instanced if matrices are given
+         *
+         * The shader has to decode them like shadowCompressed.vert, Draw() sets the quantization uniforms.
+         */
+        void SetupMeshCompressed(const std::vector<Transform>& instanceMatrices = {}) noexcept;
+        [[nodiscard]] bool IsCompressed() const noexcept { return m_compressed; }
+        [[nodiscard]] const VertexQuantization& GetVertexQuantization() const noexcept { return m_quantization; }
+
+        /**
+         * @brief Overwrites the first matrices.size() instances uploaded by SetupMeshInstanced(), normal matrices included
+         */
+        void UpdateInstances(std::span<const PackedMatrix4f> matrices) noexcept;
+
+        /**
+         * @brief Bounding sphere of the vertex positions in model space
+         */
+        [[nodiscard]] Sphere ComputeBoundingSphere() const noexcept;
         void Draw(GPUDrawPrimitive primitive, GPUPrimitiveDataType type, uint32_t instances = 0, bool instanced = false) const noexcept;
 
         NonOwnPtr<Shader> GetShader() const noexcept { return m_shader; }
@@ -104,16 +128,25 @@ namespace lux
         Transform m_modelMatrix;
 
     private:
+        // Uploads the instance model and normal matrices (attributes 3-10) and binds them next to vertexLayout
+        void SetupInstanceAttributes(const Layout& vertexLayout, const std::vector<Transform>& instanceMatrices) noexcept;
+
         MeshType m_type;
-        MeshData m_meshData;
+        // MESH memory, the parsers allocate their output there so it is moved in rather than copied
+        MeshData m_meshData {std::pmr::vector<uint32_t>{GetTaggedResource(MemoryTag::MESH)},
+                             std::pmr::vector<float>{GetTaggedResource(MemoryTag::MESH)}, {}};
         Buffer m_vbo{BufferType::VertexBuffer};
         Buffer m_ebo{BufferType::IndexBuffer};
         Buffer m_instanceVBO{BufferType::VertexBuffer};
+        Buffer m_normalVBO{BufferType::VertexBuffer};
         Scope<IVertexLayout> m_layout;
         Texture2D m_texture{};
         std::vector<Matrix4f> m_instanceMatrices;
+        std::vector<PackedNormalMatrix> m_normalMatrices;
         std::string m_samplerName{};
         NonOwnPtr<Shader> m_shader;
+        VertexQuantization m_quantization{};
+        bool m_compressed = false;
     };
 
     struct MeshInstance
@@ -156,20 +189,4 @@ namespace lux
             return seed;
         }
     };
-
-    struct MeshPtrHash
-    {
-        size_t operator()(const NonOwnPtr<Mesh>& ptr) const noexcept
-        {
-            return std::hash<Mesh*>()(ptr);
-        }
-    };
-
-    struct MeshPtrEq
-    {
-        bool operator()(const NonOwnPtr<Mesh>& a, const NonOwnPtr<Mesh>& b) const noexcept
-        {
-            return a == b;
-        }
-    };
 }
\ No newline at end of file
@@ -29,7 +29,10 @@
  * SOFTWARE.
  */
 #pragma once
+#include <cstdlib>
 #include <filesystem>
+#include <memory_resource>
+#include <stdexcept>
 #include <vector>
 #include <fstream>
 #include "../Buffer/Layout.hpp"
@@ -37,10 +40,15 @@
 
 namespace lux
 {
+    /**
+     * @brief Parsed geometry; the vectors allocate from the resource they are constructed with, the heap by default
+     *
+     * Copies go to the default resource, so a mesh keeping a copy does not depend on a parser's resource.
+     */
     struct MeshData
     {
-        std::vector<uint32_t> indices;
-        std::vector<float> vertices;
+        std::pmr::vector<uint32_t> indices;
+        std::pmr::vector<float> vertices;
         Layout layout;
 
         bool operator==(const MeshData& m) const
@@ -57,12 +65,22 @@ namespace lux
         virtual MeshData ParseMesh(const std::filesystem::path& filePath) = 0;
     };
 
-    template<typename Vector>
-    Vector ReadVec(const std::vector<std::string>& words)
+    /**
+     * @brief Reads words[1..] into a vector, words is any sequence of std::string or std::pmr::string
+     */
+    template<typename Vector, typename Words>
+    Vector ReadVec(const Words& words)
     {
         Vector vec;
         for(size_t i = 0; i < Vector::GetVectorSize(); i++)
-            vec[i] = std::stof(words[i + 1]);
+        {
+            // strtof instead of stof, which only takes std::string
+            const char* begin = words[i + 1].c_str();
+            char* end = nullptr;
+            vec[i] = std::strtof(begin, &end);
+            if (end == begin)
+                throw std::invalid_argument("ReadVec: not a number");
+        }
 
         return vec;
     }
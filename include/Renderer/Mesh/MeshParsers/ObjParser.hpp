@@ -29,29 +29,48 @@
  * SOFTWARE.
  */
 #pragma once
+#include <memory_resource>
+#include <string>
+#include <unordered_map>
 #include "../MeshLoader.hpp"
 
 namespace  lux
 {
+    /**
+     * @brief Wavefront OBJ reader
+     *
+     * Line tokens, the v/vt/vn tables and the corner history are scratch data and come from the
+     * scratch resource, typically an ArenaResource reset after the load job. The returned MeshData
+     * allocates from the output resource, which has to outlive it.
+     */
     class OBJParser : public IMeshParser
     {
     public:
+        explicit OBJParser(std::pmr::memory_resource* scratch = std::pmr::get_default_resource(),
+                           std::pmr::memory_resource* output = std::pmr::get_default_resource()) :
+            m_scratch{scratch}, m_vertices{output}, m_indices{output}, m_history{scratch}, m_cornerTokens{scratch} {}
 
         MeshData ParseMesh(const std::filesystem::path& filename) override;
 
-        void ReadCorner(std::string &description, std::vector<Vector3f> &v,
-                 std::vector<Vector2f> &vt, std::vector<Vector3f> &vn, std::vector<float> &vertices,
-         std::unordered_map<std::string, uint32_t> &history, std::vector<uint32_t> &indices);
+        void ReadCorner(const std::pmr::string& description, const std::pmr::vector<Vector3f>& v,
+                        const std::pmr::vector<Vector2f>& vt, const std::pmr::vector<Vector3f>& vn,
+                        std::pmr::vector<float>& vertices, std::pmr::unordered_map<std::pmr::string, uint32_t>& history,
+                        std::pmr::vector<uint32_t>& indices);
 
-        void ReadFace(std::vector<std::string> &words, std::vector<Vector3f> &v, std::vector<Vector2f> &vt,
-                                  std::vector<Vector3f> &vn, std::vector<float> &vertices,
-                                  std::unordered_map<std::string, uint32_t> &history, std::vector<uint32_t> &indices);
+        void ReadFace(const std::pmr::vector<std::pmr::string>& words, const std::pmr::vector<Vector3f>& v,
+                      const std::pmr::vector<Vector2f>& vt, const std::pmr::vector<Vector3f>& vn,
+                      std::pmr::vector<float>& vertices, std::pmr::unordered_map<std::pmr::string, uint32_t>& history,
+                      std::pmr::vector<uint32_t>& indices);
 
     private:
-        std::vector<float> m_vertices;
-        std::vector<uint32_t > m_indices;
-        std::unordered_map<std::string, uint32_t> m_history;
+        std::pmr::memory_resource* m_scratch;
+        std::pmr::vector<float> m_vertices;
+        std::pmr::vector<uint32_t > m_indices;
+        std::pmr::unordered_map<std::pmr::string, uint32_t> m_history;
+        std::pmr::vector<std::pmr::string> m_cornerTokens;
         uint32_t m_elementCount;
+
+        void ReleaseScratch() noexcept;
     };
 
     struct Material
@@ -29,10 +29,42 @@
  * SOFTWARE.
  */
 #pragma once
-
+#include <span>
 #include "RenderPass.hpp"
+#include "../Camera/Camera.hpp"
+#include "../../Math/Transform.hpp"
+#include "../../Math/Geometry/Frustum.hpp"
+#include "../../Memory/FrameAllocator.hpp"
 
-class CullPass : public RenderPass
+namespace lux
 {
+    /**
+     * @brief Culls the instances of a mesh against the camera frustum before they are drawn
+     *
+     * Begin() extracts the frustum once per frame, then each mesh Submit()s its instance transforms
+     * with its model space bounding sphere and Execute() leaves the packed model matrices of the
+     * visible instances in GetVisibleMatrices(). Scratch and results live in the frame allocator
+     * passed to Begin(), so they stay valid for the frames in flight and never touch the heap.
+     */
+    class CullPass : public RenderPass
+    {
+    public:
+        void Begin(const Camera& camera, FrameAllocator& frame) noexcept;
+        void Submit(std::span<const Transform> transforms, const Sphere& localBounds) noexcept;
+        void Execute() override;
+
+        [[nodiscard]] const Frustum& GetFrustum() const noexcept { return m_frustum; }
+        [[nodiscard]] std::span<const uint32_t> GetVisibleIndices() const { return m_visible.First(m_visibleCount); }
+        [[nodiscard]] std::span<const PackedMatrix4f> GetVisibleMatrices() const { return m_matrices.First(m_visibleCount); }
+
+    private:
+        Frustum m_frustum;
+        NonOwnPtr<FrameAllocator> m_frame = nullptr;
+        std::span<const Transform> m_transforms;
+        Sphere m_localBounds;
 
+        FrameSpan<uint32_t> m_visible;
+        FrameSpan<PackedMatrix4f> m_matrices;
+        size_t m_visibleCount = 0;
+    };
 }
\ No newline at end of file
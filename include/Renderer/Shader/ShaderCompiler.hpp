@@ -1,6 +1,9 @@
 #pragma once
+#include <memory_resource>
 #include <string>
+#include <unordered_map>
 #include <vector>
+#include "../../Memory/MemoryTracker.hpp"
 #include "glslang/glslang/Public/ShaderLang.h"
 #include "glslang/glslang/Include/intermediate.h"
 #include "glslang/glslang/Include/ResourceLimits.h"
@@ -119,14 +122,15 @@ namespace lux
         std::vector<ShaderVariable> members;
     };
 
+    // The tables are SHADER memory, the names inside the entries still come from the heap
     struct ShaderReflectionData
     {
-        std::vector<ShaderInput> inputs;
-        std::vector<ShaderOutput> outputs;
-        std::vector<ShaderUniform> uniforms;
-        std::vector<ShaderUniformBlock> uniformBlocks;
-        std::vector<ShaderPushConstant> pushConstants;
-        std::unordered_map<std::string, ShaderVariable> variables;
+        std::pmr::vector<ShaderInput> inputs {GetTaggedResource(MemoryTag::SHADER)};
+        std::pmr::vector<ShaderOutput> outputs {GetTaggedResource(MemoryTag::SHADER)};
+        std::pmr::vector<ShaderUniform> uniforms {GetTaggedResource(MemoryTag::SHADER)};
+        std::pmr::vector<ShaderUniformBlock> uniformBlocks {GetTaggedResource(MemoryTag::SHADER)};
+        std::pmr::vector<ShaderPushConstant> pushConstants {GetTaggedResource(MemoryTag::SHADER)};
+        std::pmr::unordered_map<std::string, ShaderVariable> variables {GetTaggedResource(MemoryTag::SHADER)};
     };
 
     class ReflectionVisitor : public glslang::TIntermTraverser
@@ -91,9 +91,15 @@ namespace lux
         uint32_t GetId() const noexcept { return m_texId; }
         uint32_t GetTextureUnit() const noexcept;
 
+        /**
+         * @brief Estimated GPU bytes of the uploaded images, mip chain included, as reported under MemoryTag::TEXTURE
+         */
+        size_t GetGPUBytes() const noexcept { return m_gpuBytes; }
+
     private:
         uint32_t m_texId = 0u;
         uint32_t m_unit = 0u;
+        size_t m_gpuBytes = 0;
         TextureSpecification m_specs;
     };
 }
\ No newline at end of file
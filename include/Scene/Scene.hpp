@@ -29,6 +29,9 @@
  * SOFTWARE.
  */
 #pragma once
+#include <memory_resource>
+#include "../Application/Handle.hpp"
+#include "../Memory/MemoryTracker.hpp"
 #include "../Renderer/Light/Light.hpp"
 #include "../Renderer/Camera/Camera.hpp"
 #include "../Renderer/Mesh/Mesh.hpp"
@@ -42,15 +45,20 @@ namespace lux
 
     struct SceneObject
     {
-        NonOwnPtr<Mesh> mesh;
+        MeshHandle mesh;
         Transform transform;
     };
 
     class Scene
     {
     public:
-        explicit Scene(const std::string& name);
-        Scene(const std::string& name, NonOwnPtr<Camera> camera);
+        /**
+         * @param resource Backs the mesh list, e.g. a PoolResource or ArenaResource owned by the level; the
+         *                 default heap resource accounts it as SCENE memory
+         */
+        explicit Scene(const std::string& name, std::pmr::memory_resource* resource = GetTaggedResource(MemoryTag::SCENE));
+        Scene(const std::string& name, NonOwnPtr<Camera> camera,
+              std::pmr::memory_resource* resource = GetTaggedResource(MemoryTag::SCENE));
 
         static void LoadScene() noexcept {}
         static void UnloadScene() noexcept {}
@@ -64,8 +72,16 @@ namespace lux
         static void RemoveGameObject(const Ref<GameObject>& gameObject) noexcept {}
         void SetCamera(NonOwnPtr<Camera> camera) noexcept;
 
-        void AddMesh(const Ref<Mesh>& mesh) noexcept;
+        /**
+         * @throws std::length_error if the mesh table is out of slots
+         */
+        MeshHandle AddMesh(const Ref<Mesh>& mesh);
         void RemoveMesh(const Ref<Mesh>& mesh) noexcept;
+
+        /**
+         * @brief The mesh, or null once it was removed from the scene
+         */
+        [[nodiscard]] NonOwnPtr<Mesh> GetMesh(MeshHandle handle) const noexcept { return m_meshTable.Get(handle); }
         void SetupMeshes() const noexcept;
 
         void AddPrimitive(const Ref<IPrimitive>& primitive) noexcept;
@@ -74,10 +90,10 @@ namespace lux
         static void AddLight(const Light& light) noexcept {}
         static void RemoveLight(const Light& light) noexcept {}
 
-        static std::unordered_map<NonOwnPtr<Mesh>, std::vector<Transform>, MeshPtrHash, MeshPtrEq>
-            GroupMeshInstances(const std::vector<SceneObject>& objects);
+        static std::unordered_map<MeshHandle, std::vector<Transform>> GroupMeshInstances(const std::vector<SceneObject>& objects);
 
-        const std::vector<Ref<Mesh>>& GetMeshes() const noexcept { return m_meshes; }
+        const std::pmr::vector<Ref<Mesh>>& GetMeshes() const noexcept { return m_meshes; }
+        const std::pmr::vector<MeshHandle>& GetMeshHandles() const noexcept { return m_meshHandles; }
         const std::vector<Ref<IPrimitive>>& GetPrimitives() const noexcept { return m_primitives; }
         const std::vector<Light>& GetLights() const noexcept { return m_lights; }
 
@@ -87,7 +103,10 @@ namespace lux
         std::string m_name;
         NonOwnPtr<Camera> m_camera;
 
-        std::vector<Ref<Mesh>> m_meshes;
+        // m_meshHandles[i] names m_meshes[i]
+        std::pmr::vector<Ref<Mesh>> m_meshes;
+        std::pmr::vector<MeshHandle> m_meshHandles;
+        HandleTable<Mesh> m_meshTable;
         std::vector<Ref<IPrimitive>> m_primitives;
         std::vector<Light> m_lights;
     };
@@ -28,4 +28,282 @@
  * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
  * SOFTWARE.
  */
-#pragma once
\ No newline at end of file
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "../Math/Geometry/AABB.hpp"
+
+#if !defined(LUX_NO_BMI2) && (defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__)))
+    #define LUX_MORTON_BMI2
+    #include <immintrin.h>
+#endif
+
+/*  Morton codes
+ *
+ *  Interleave the bits of 2 or 3 integer coordinates so that sorting by the code walks a
+ *  Z-order curve: objects close in space end up close in memory. The 32 bit codes hold
+ *  16 bits per axis in 2D and 10 in 3D, the 64 bit codes 32 and 21. Higher input bits are
+ *  dropped.
+ *
+ *  With BMI2 the bits are scattered and gathered with pdep/pext, otherwise with the usual
+ *  shift and mask ("magic bits") sequences. pdep/pext are microcoded and slow on AMD
+ *  before Zen 3, define LUX_NO_BMI2 to keep the fallback on such targets.
+ *--------------------------------------------------------------------------------*/
+namespace lux
+{
+    template<typename T>
+    concept MortonCodeType = std::is_same_v<T, uint32_t> || std::is_same_v<T, uint64_t>;
+
+    namespace detail
+    {
+        [[nodiscard]] constexpr uint32_t Part1By1(uint32_t x) noexcept
+        {
+            x &= 0x0000FFFFu;
+            x = (x | (x << 8)) & 0x00FF00FFu;
+            x = (x | (x << 4)) & 0x0F0F0F0Fu;
+            x = (x | (x << 2)) & 0x33333333u;
+            x = (x | (x << 1)) & 0x55555555u;
+            return x;
+        }
+
+        [[nodiscard]] constexpr uint64_t Part1By1(uint64_t x) noexcept
+        {
+            x &= 0x00000000FFFFFFFFull;
+            x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+            x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+            x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+            x = (x | (x << 2)) & 0x3333333333333333ull;
+            x = (x | (x << 1)) & 0x5555555555555555ull;
+            return x;
+        }
+
+        [[nodiscard]] constexpr uint32_t Compact1By1(uint32_t x) noexcept
+        {
+            x &= 0x55555555u;
+            x = (x ^ (x >> 1)) & 0x33333333u;
+            x = (x ^ (x >> 2)) & 0x0F0F0F0Fu;
+            x = (x ^ (x >> 4)) & 0x00FF00FFu;
+            x = (x ^ (x >> 8)) & 0x0000FFFFu;
+            return x;
+        }
+
+        [[nodiscard]] constexpr uint64_t Compact1By1(uint64_t x) noexcept
+        {
+            x &= 0x5555555555555555ull;
+            x = (x ^ (x >> 1)) & 0x3333333333333333ull;
+            x = (x ^ (x >> 2)) & 0x0F0F0F0F0F0F0F0Full;
+            x = (x ^ (x >> 4)) & 0x00FF00FF00FF00FFull;
+            x = (x ^ (x >> 8)) & 0x0000FFFF0000FFFFull;
+            x = (x ^ (x >> 16)) & 0x00000000FFFFFFFFull;
+            return x;
+        }
+
+        [[nodiscard]] constexpr uint32_t Part1By2(uint32_t x) noexcept
+        {
+            x &= 0x000003FFu;
+            x = (x | (x << 16)) & 0x030000FFu;
+            x = (x | (x << 8)) & 0x0300F00Fu;
+            x = (x | (x << 4)) & 0x030C30C3u;
+            x = (x | (x << 2)) & 0x09249249u;
+            return x;
+        }
+
+        [[nodiscard]] constexpr uint64_t Part1By2(uint64_t x) noexcept
+        {
+            x &= 0x00000000001FFFFFull;
+            x = (x | (x << 32)) & 0x001F00000000FFFFull;
+            x = (x | (x << 16)) & 0x001F0000FF0000FFull;
+            x = (x | (x << 8)) & 0x100F00F00F00F00Full;
+            x = (x | (x << 4)) & 0x10C30C30C30C30C3ull;
+            x = (x | (x << 2)) & 0x1249249249249249ull;
+            return x;
+        }
+
+        [[nodiscard]] constexpr uint32_t Compact1By2(uint32_t x) noexcept
+        {
+            x &= 0x09249249u;
+            x = (x ^ (x >> 2)) & 0x030C30C3u;
+            x = (x ^ (x >> 4)) & 0x0300F00Fu;
+            x = (x ^ (x >> 8)) & 0xFF0000FFu;
+            x = (x ^ (x >> 16)) & 0x000003FFu;
+            return x;
+        }
+
+        [[nodiscard]] constexpr uint64_t Compact1By2(uint64_t x) noexcept
+        {
+            x &= 0x1249249249249249ull;
+            x = (x ^ (x >> 2)) & 0x10C30C30C30C30C3ull;
+            x = (x ^ (x >> 4)) & 0x100F00F00F00F00Full;
+            x = (x ^ (x >> 8)) & 0x001F0000FF0000FFull;
+            x = (x ^ (x >> 16)) & 0x001F00000000FFFFull;
+            x = (x ^ (x >> 32)) & 0x00000000001FFFFFull;
+            return x;
+        }
+
+        /** @brief Bits of the x axis in a 2D code, y sits one bit higher */
+        template<MortonCodeType Code>
+        inline constexpr Code MortonMask2 = static_cast<Code>(0x5555555555555555ull);
+
+        /** @brief Bits of the x axis in a 3D code, y and z sit one and two bits higher */
+        template<MortonCodeType Code>
+        inline constexpr Code MortonMask3 = static_cast<Code>(std::is_same_v<Code, uint32_t> ? 0x09249249ull : 0x1249249249249249ull);
+
+#if defined(LUX_MORTON_BMI2)
+        [[nodiscard]] inline uint32_t Deposit(uint32_t value, uint32_t mask) noexcept { return _pdep_u32(value, mask); }
+        [[nodiscard]] inline uint64_t Deposit(uint64_t value, uint64_t mask) noexcept { return _pdep_u64(value, mask); }
+        [[nodiscard]] inline uint32_t Extract(uint32_t value, uint32_t mask) noexcept { return _pext_u32(value, mask); }
+        [[nodiscard]] inline uint64_t Extract(uint64_t value, uint64_t mask) noexcept { return static_cast<uint64_t>(_pext_u64(value, mask)); }
+#endif
+    }
+
+    template<MortonCodeType Code>
+    [[nodiscard]] inline Code MortonEncode2D(uint32_t x, uint32_t y) noexcept
+    {
+#if defined(LUX_MORTON_BMI2)
+        constexpr Code mask = detail::MortonMask2<Code>;
+        return detail::Deposit(Code{x}, mask) | detail::Deposit(Code{y}, static_cast<Code>(mask << 1));
+#else
+        return detail::Part1By1(Code{x}) | (detail::Part1By1(Code{y}) << 1);
+#endif
+    }
+
+    template<MortonCodeType Code>
+    [[nodiscard]] inline std::array<uint32_t, 2> MortonDecode2D(Code code) noexcept
+    {
+#if defined(LUX_MORTON_BMI2)
+        constexpr Code mask = detail::MortonMask2<Code>;
+        return {static_cast<uint32_t>(detail::Extract(code, mask)), static_cast<uint32_t>(detail::Extract(code, static_cast<Code>(mask << 1)))};
+#else
+        return {static_cast<uint32_t>(detail::Compact1By1(code)), static_cast<uint32_t>(detail::Compact1By1(static_cast<Code>(code >> 1)))};
+#endif
+    }
+
+    template<MortonCodeType Code>
+    [[nodiscard]] inline Code MortonEncode3D(uint32_t x, uint32_t y, uint32_t z) noexcept
+    {
+#if defined(LUX_MORTON_BMI2)
+        constexpr Code mask = detail::MortonMask3<Code>;
+        return detail::Deposit(Code{x}, mask) | detail::Deposit(Code{y}, static_cast<Code>(mask << 1)) |
+               detail::Deposit(Code{z}, static_cast<Code>(mask << 2));
+#else
+        return detail::Part1By2(Code{x}) | (detail::Part1By2(Code{y}) << 1) | (detail::Part1By2(Code{z}) << 2);
+#endif
+    }
+
+    template<MortonCodeType Code>
+    [[nodiscard]] inline std::array<uint32_t, 3> MortonDecode3D(Code code) noexcept
+    {
+#if defined(LUX_MORTON_BMI2)
+        constexpr Code mask = detail::MortonMask3<Code>;
+        return {static_cast<uint32_t>(detail::Extract(code, mask)), static_cast<uint32_t>(detail::Extract(code, static_cast<Code>(mask << 1))),
+                static_cast<uint32_t>(detail::Extract(code, static_cast<Code>(mask << 2)))};
+#else
+        return {static_cast<uint32_t>(detail::Compact1By2(code)), static_cast<uint32_t>(detail::Compact1By2(static_cast<Code>(code >> 1))),
+                static_cast<uint32_t>(detail::Compact1By2(static_cast<Code>(code >> 2)))};
+#endif
+    }
+
+    /**
+     * @brief 63 bit keys of positions quantized to 21 bits per axis inside bounds, positions outside are clamped
+     */
+    inline void ComputeMortonKeys(std::span<const math::Vector3f> positions, const math::AABB& bounds, std::span<uint64_t> keys) noexcept
+    {
+        CORE_ASSERT(keys.size() >= positions.size(), "ComputeMortonKeys: output span too small")
+
+        constexpr float maxCell = static_cast<float>((1u << 21) - 1);
+        const math::Vector3f extents = bounds.max - bounds.min;
+        auto scaleOf = [](float extent) { return extent > 0.0f ? maxCell / extent : 0.0f; };
+        const float sx = scaleOf(extents.GetX()), sy = scaleOf(extents.GetY()), sz = scaleOf(extents.GetZ());
+        const float ox = bounds.min.GetX(), oy = bounds.min.GetY(), oz = bounds.min.GetZ();
+
+        for (size_t i = 0; i < positions.size(); ++i)
+        {
+            const math::Vector3f& p = positions[i];
+            const auto x = static_cast<uint32_t>(std::clamp((p.GetX() - ox) * sx, 0.0f, maxCell));
+            const auto y = static_cast<uint32_t>(std::clamp((p.GetY() - oy) * sy, 0.0f, maxCell));
+            const auto z = static_cast<uint32_t>(std::clamp((p.GetZ() - oz) * sz, 0.0f, maxCell));
+            keys[i] = MortonEncode3D<uint64_t>(x, y, z);
+        }
+    }
+
+    /**
+     * @brief Sorts keys ascending and applies the same permutation to values, with an LSD radix sort
+     *
+     * Stable. Digits on which every key agrees are skipped, so keys of a small box cost fewer passes.
+     */
+    inline void SortByMortonKey(std::span<uint64_t> keys, std::span<uint32_t> values)
+    {
+        CORE_ASSERT(keys.size() == values.size(), "SortByMortonKey: keys and values differ in size")
+
+        constexpr uint32_t DigitBits = 11;
+        constexpr uint32_t Buckets = 1u << DigitBits;
+        const size_t count = keys.size();
+        if (count < 2)
+            return;
+
+        std::vector<uint64_t> keyScratch(count);
+        std::vector<uint32_t> valueScratch(count);
+        std::vector<uint32_t> offsets(Buckets);
+
+        uint64_t* keysIn = keys.data();
+        uint32_t* valuesIn = values.data();
+        uint64_t* keysOut = keyScratch.data();
+        uint32_t* valuesOut = valueScratch.data();
+
+        for (uint32_t shift = 0; shift < 63; shift += DigitBits)
+        {
+            std::fill(offsets.begin(), offsets.end(), 0u);
+            for (size_t i = 0; i < count; ++i)
+                ++offsets[(keysIn[i] >> shift) & (Buckets - 1)];
+
+            if (offsets[(keysIn[0] >> shift) & (Buckets - 1)] == count)
+                continue;
+
+            uint32_t sum = 0;
+            for (uint32_t& offset : offsets)
+                sum += std::exchange(offset, sum);
+
+            for (size_t i = 0; i < count; ++i)
+            {
+                const uint32_t slot = offsets[(keysIn[i] >> shift) & (Buckets - 1)]++;
+                keysOut[slot] = keysIn[i];
+                valuesOut[slot] = valuesIn[i];
+            }
+
+            std::swap(keysIn, keysOut);
+            std::swap(valuesIn, valuesOut);
+        }
+
+        if (keysIn != keys.data())
+        {
+            std::copy_n(keysIn, count, keys.data());
+            std::copy_n(valuesIn, count, values.data());
+        }
+    }
+
+    /**
+     * @brief Writes the indices of positions in Morton order, for spatially coherent BVH builds and instance buffers
+     */
+    inline void MortonOrder(std::span<const math::Vector3f> positions, const math::AABB& bounds, std::span<uint32_t> order)
+    {
+        CORE_ASSERT(order.size() == positions.size(), "MortonOrder: order and positions differ in size")
+
+        std::vector<uint64_t> keys(positions.size());
+        ComputeMortonKeys(positions, bounds, keys);
+
+        for (size_t i = 0; i < order.size(); ++i)
+            order[i] = static_cast<uint32_t>(i);
+
+        SortByMortonKey(keys, order);
+    }
+
+    inline void MortonOrder(std::span<const math::Vector3f> positions, std::span<uint32_t> order)
+    {
+        MortonOrder(positions, math::AABB::FromPoints(positions), order);
+    }
+}
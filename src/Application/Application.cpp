@@ -13,6 +13,7 @@
 #include "../../include/FileSystem/FileSystem.hpp"
 #include "../../include/Renderer/Primitives/Plane.hpp"
 #include "../../include/Renderer/RenderPasses/ShadowPass.hpp"
+#include "../../include/Renderer/RenderPasses/CullPass.hpp"
 #include "../../include/Input/Mouse.hpp"
 #include "../../include/Event/Events.hpp"
 #include "GLFW/glfw3.h"
@@ -220,7 +221,7 @@ namespace lux
         objMesh->LoadMeshFromFile("assets/castle.obj", "assets/castle.mtl");
         scene.AddMesh(objMesh);
 
-        Ref<Plane> plane = CreateRef<Plane>(&cubeShader, Vector3f(0.4f, -1.0f, 0.3f), Vector2f(20.0f, 20.0f));
+        Ref<lux::Plane> plane = CreateRef<lux::Plane>(&cubeShader, Vector3f(0.4f, -1.0f, 0.3f), Vector2f(20.0f, 20.0f));
 
         FrameBufferSpecification fbSpec;
         fbSpec.width = 2048;
@@ -258,26 +259,35 @@ namespace lux
         constexpr int n = 5;
         std::vector<SceneObject> objects;
 
-        for (const auto& mesh : scene.GetMeshes())
+        for (MeshHandle mesh : scene.GetMeshHandles())
             for (int i = 0; i < n; ++i)
                 objects.push_back({
-                    mesh.get(),
-                    { Matrix4f::Translate(Vector3f{ i * 8.0f, 0.0f, 0.0f }), Identity4f, Identity4f}
+                    mesh,
+                    Transform{ Vector3f{ i * 8.0f, 0.0f, 0.0f } }
                 });
 
         auto grouped = scene.GroupMeshInstances(objects);
+        std::unordered_map<MeshHandle, Sphere> meshBounds;
 
-        for (auto& [meshPtr, transforms] : grouped)
+        for (auto& [handle, transforms] : grouped)
         {
+            NonOwnPtr<Mesh> meshPtr = scene.GetMesh(handle);
             if (transforms.size() > 1)
                 meshPtr->SetupMeshInstanced(transforms);
             else
                 meshPtr->SetupMesh();
+
+            meshBounds.emplace(handle, meshPtr->ComputeBoundingSphere());
         }
 
+        CullPass cullPass;
+
+        MemoryTracker::SetDumpInterval(MemoryDumpInterval);
 
         while (!m_window->ShouldClose())
         {
+            m_frameAllocator.BeginFrame();
+
             // float radius = 5.0f;
             // float orbitSpeed = 1.0f;
             // float fixedHeight = 1.0f;
@@ -316,17 +326,34 @@ namespace lux
             diffuseTexture.Bind(diffuseTexture.GetTextureUnit());
             objMesh->SetShader(&shadowShader);
 
-            for (auto& [meshPtr, transforms] : grouped)
+            cullPass.Begin(m_camera, m_frameAllocator);
+
+            for (auto& [handle, transforms] : grouped)
             {
+                // Meshes removed from the scene leave stale handles behind, skip them
+                NonOwnPtr<Mesh> meshPtr = scene.GetMesh(handle);
+                if (!meshPtr)
+                    continue;
+
                 uint32_t instanceCount = static_cast<uint32_t>(transforms.size());
 
                 if (instanceCount > 1)
+                {
+                    cullPass.Submit(transforms, meshBounds.at(handle));
+                    cullPass.Execute();
+
+                    std::span<const PackedMatrix4f> visible = cullPass.GetVisibleMatrices();
+                    if (visible.empty())
+                        continue;
+
+                    meshPtr->UpdateInstances(visible);
                     meshPtr->Draw(
                         GPUDrawPrimitive::TRIANGLES,
                         GPUPrimitiveDataType::UNSIGNED_INT,
-                        instanceCount,
+                        static_cast<uint32_t>(visible.size()),
                         true
                     );
+                }
                 else
                     meshPtr->Draw(
                         GPUDrawPrimitive::TRIANGLES,
@@ -356,6 +383,8 @@ namespace lux
             m_context->m_dispatcher.PollEvents();
             m_window->ProcessEvents();
             m_window->VSync(false);
+
+            MemoryTracker::EndFrame(time);
         }
 
         ShaderCompiler::Finalize();
@@ -26,22 +26,40 @@ std::string FileSystem::ToLower(const std::string& s)
     return result;
 }
 
-std::vector<std::string> FileSystem::Split(std::string line, const std::string& delim)
+template<typename Tokens>
+static void SplitInto(std::string_view line, std::string_view delim, Tokens& tokens)
 {
-    std::vector<std::string> tokens;
-    size_t pos = 0;
-    std::string token;
-    while ((pos = line.find(delim)) != std::string::npos)
+    size_t start = 0;
+    size_t end = 0;
+    while ((end = line.find(delim, start)) != std::string_view::npos)
     {
-        token = line.substr(0, pos);
-        tokens.push_back(token);
-        line.erase(0, pos + delim.size());
+        tokens.emplace_back(line.substr(start, end - start));
+        start = end + delim.size();
     }
-    tokens.push_back(line);
+    tokens.emplace_back(line.substr(start));
+}
 
+std::vector<std::string> FileSystem::Split(std::string_view line, std::string_view delim)
+{
+    std::vector<std::string> tokens;
+    SplitInto(line, delim, tokens);
     return tokens;
 }
 
+std::pmr::vector<std::pmr::string> FileSystem::Split(std::string_view line, std::string_view delim,
+                                                     std::pmr::memory_resource* resource)
+{
+    std::pmr::vector<std::pmr::string> tokens {resource};
+    SplitInto(line, delim, tokens);
+    return tokens;
+}
+
+void FileSystem::Split(std::string_view line, std::string_view delim, std::pmr::vector<std::pmr::string>& tokens)
+{
+    tokens.clear();
+    SplitInto(line, delim, tokens);
+}
+
 namespace fs = std::filesystem;
 std::vector<std::filesystem::path> FileSystem::GetFilesInDirectory(const std::string& directoryPath)
 {
@@ -0,0 +1,68 @@
+#include "../../include/Memory/MemoryTracker.hpp"
+
+/*  Global operator new hook
+ *
+ *  Built with LUX_MEMORY_HOOK the executable counts every heap allocation in the
+ *  MemoryTracker, which turns them into allocations per frame. The array and nothrow
+ *  variants forward to these in the standard library. Off by default: one relaxed
+ *  increment per allocation is cheap but not free.
+ *--------------------------------------------------------------------------------*/
+#if LUX_MEMORY_HOOK
+#include <algorithm>
+#include <cstdlib>
+#include <new>
+
+namespace
+{
+    [[maybe_unused]] const bool hookInstalled = (lux::MemoryTracker::SetHeapHookInstalled(), true);
+
+    // As the standard operator new: retry while a new handler can free memory, throw once none is installed
+    template<typename Allocate>
+    void* AllocateOrThrow(Allocate&& allocate)
+    {
+        for (;;)
+        {
+            if (void* p = allocate())
+                return p;
+
+            std::new_handler handler = std::get_new_handler();
+            if (!handler)
+                throw std::bad_alloc{};
+
+            handler();
+        }
+    }
+}
+
+void* operator new(size_t size)
+{
+    lux::MemoryTracker::OnHeapAllocation(size);
+    return AllocateOrThrow([size] { return std::malloc(size ? size : 1); });
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, size_t) noexcept { std::free(p); }
+
+// std::pmr::new_delete_resource() and the engine allocators use the aligned form
+void* operator new(size_t size, std::align_val_t alignment)
+{
+    lux::MemoryTracker::OnHeapAllocation(size);
+    const size_t align = static_cast<size_t>(alignment);
+    return AllocateOrThrow([size, align]
+    {
+#if defined(_MSC_VER)
+        return _aligned_malloc(size ? size : 1, align);
+#else
+        return std::aligned_alloc(align, (std::max<size_t>(size, 1) + align - 1) / align * align);
+#endif
+    });
+}
+
+#if defined(_MSC_VER)
+void operator delete(void* p, std::align_val_t) noexcept { _aligned_free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { _aligned_free(p); }
+#else
+void operator delete(void* p, std::align_val_t) noexcept { std::free(p); }
+void operator delete(void* p, size_t, std::align_val_t) noexcept { std::free(p); }
+#endif
+#endif
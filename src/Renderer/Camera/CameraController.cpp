@@ -47,8 +47,44 @@ namespace lux
         CORE_INFO("Created Camera Controller");
     }
 
+    void CameraController::FollowSpline(NonOwnPtr<const Spline> spline, float speed, bool loop) noexcept
+    {
+        m_spline = spline;
+        m_splineSpeed = speed;
+        m_splineDistance = 0.0f;
+        m_splineLoop = loop;
+    }
+
+    void CameraController::AdvanceAlongSpline(double deltaTime) noexcept
+    {
+        const float length = m_spline->Length();
+        m_splineDistance += m_splineSpeed * static_cast<float>(deltaTime);
+
+        if (m_splineLoop && length > 0.0f)
+        {
+            m_splineDistance = std::fmod(m_splineDistance, length);
+            if (m_splineDistance < 0.0f)
+                m_splineDistance += length;
+        }
+        else
+            m_splineDistance = std::clamp(m_splineDistance, 0.0f, length);
+
+        const float t = m_spline->ParameterAtDistance(m_splineDistance);
+        m_camera.SetPosition(m_spline->Evaluate(t));
+
+        Vector3f tangent = m_spline->Tangent(t);
+        if (tangent.Length() > EPSILON)
+            m_camera.SetFront(tangent.Normalize());
+    }
+
     void CameraController::UpdateCamera(double deltaTime) noexcept
     {
+        if (m_spline)
+        {
+            AdvanceAlongSpline(deltaTime);
+            return;
+        }
+
         if (InputDevice::IsKeyDown(InputType::Keyboard, m_actionMapper.GetKeyCombo(InputAction::MoveForward, InputType::Keyboard).key))
         {
             if (InputDevice::IsKeyDown( InputType::Keyboard, static_cast<int>(KeyboardKeys::KeyLeftShift)))
@@ -1,5 +1,6 @@
 #include "../../include/Renderer/Mesh/Mesh.hpp"
 #include "../../include/OpenGL/MeshRenderer.hpp"
+#include "../../include/Math/Geometry/AABB.hpp"
 
 
 namespace lux
@@ -12,8 +13,13 @@ namespace lux
         m_texture = std::move(tex);
     }
 
-    Mesh::Mesh(const Mesh& other) : m_type{other.m_type}, m_meshData{other.m_meshData}, m_vbo{other.m_vbo},
-            m_ebo{other.m_ebo}, m_layout{other.m_layout->Clone()}, m_shader{other.m_shader} {}
+    Mesh::Mesh(const Mesh& other) : m_type{other.m_type}, m_vbo{other.m_vbo},
+            m_ebo{other.m_ebo}, m_layout{other.m_layout->Clone()}, m_shader{other.m_shader},
+            m_quantization{other.m_quantization}, m_compressed{other.m_compressed}
+    {
+        // Assigned rather than copy constructed, which would move the geometry to the default resource
+        m_meshData = other.m_meshData;
+    }
     Mesh& Mesh::operator=(const Mesh& other)
     {
         if (this != &other)
@@ -22,6 +28,8 @@ namespace lux
             m_vbo = other.m_vbo;
             m_ebo = other.m_ebo;
             m_layout = other.m_layout->Clone();
+            m_quantization = other.m_quantization;
+            m_compressed = other.m_compressed;
         }
 
         return *this;
@@ -43,6 +51,37 @@ namespace lux
         vertexLayout.Push<Vector3f>(GPUPrimitiveDataType::FLOAT, false);
         vertexLayout.Finalize();
 
+        m_vbo.SetData(m_meshData.vertices, BufferUsage::StaticDraw, m_layout);
+        m_ebo.SetData(m_meshData.indices,  BufferUsage::StaticDraw, m_layout);
+
+        SetupInstanceAttributes(vertexLayout, instanceMatrices);
+    }
+
+    void Mesh::SetupMeshCompressed(const std::vector<Transform>& instanceMatrices) noexcept
+    {
+        const std::span vertices{reinterpret_cast<const StandardVertex*>(m_meshData.vertices.data()),
+                                 m_meshData.vertices.size() * sizeof(float) / sizeof(StandardVertex)};
+
+        m_quantization = VertexQuantization::FromVertices(vertices);
+        std::vector<CompressedVertex> compressed(vertices.size());
+        CompressVertices(vertices, m_quantization, compressed);
+        m_compressed = true;
+
+        m_vbo.SetData(compressed, BufferUsage::StaticDraw, m_layout);
+        m_ebo.SetData(m_meshData.indices, BufferUsage::StaticDraw, m_layout);
+
+        const Layout vertexLayout = Layout::Compressed();
+        if (instanceMatrices.empty())
+        {
+            m_layout->SetupLayout({{vertexLayout, m_vbo}});
+            return;
+        }
+
+        SetupInstanceAttributes(vertexLayout, instanceMatrices);
+    }
+
+    void Mesh::SetupInstanceAttributes(const Layout& vertexLayout, const std::vector<Transform>& instanceMatrices) noexcept
+    {
         Layout instanceLayout;
         instanceLayout.index = 3;
         instanceLayout.Push<Vector4f>(GPUPrimitiveDataType::FLOAT, true);
@@ -51,19 +90,50 @@ namespace lux
         instanceLayout.Push<Vector4f>(GPUPrimitiveDataType::FLOAT, true);
         instanceLayout.Finalize();
 
-        std::vector<Matrix4f> matrices;
-        matrices.reserve(instanceMatrices.size());
+        const std::vector<PackedMatrix4f> matrixData = ComposeMatrices(instanceMatrices);
+        m_normalMatrices = ComputeNormalMatrices(matrixData);
 
-        for (const auto& t : instanceMatrices)
-            matrices.push_back(t.ToMatrix4());
+        m_instanceVBO.SetData(matrixData, BufferUsage::DynamicDraw, m_layout);
+        m_normalVBO.SetData(m_normalMatrices, BufferUsage::DynamicDraw, m_layout);
 
-        auto matrixData = MatricesAsFloatVector(matrices);
+        m_layout->SetupLayout({ { vertexLayout,  m_vbo },{ instanceLayout, m_instanceVBO },
+                                { Layout::NormalMatrices(7), m_normalVBO }});
+    }
 
-        m_vbo.SetData(m_meshData.vertices, BufferUsage::StaticDraw, m_layout);
-        m_ebo.SetData(m_meshData.indices,  BufferUsage::StaticDraw, m_layout);
-        m_instanceVBO.SetData(matrixData,  BufferUsage::StaticDraw, m_layout);
+    void Mesh::UpdateInstances(std::span<const PackedMatrix4f> matrices) noexcept
+    {
+        CORE_ASSERT(matrices.size_bytes() <= m_instanceVBO.GetSize(), "More instances than SetupMeshInstanced uploaded")
+        m_instanceVBO.Update(matrices);
 
-        m_layout->SetupLayout({ { vertexLayout,  m_vbo },{ instanceLayout, m_instanceVBO }});
+        // m_normalMatrices keeps the size SetupMeshInstanced gave it, so this does not allocate
+        const std::span normals{m_normalMatrices.data(), matrices.size()};
+        ComputeNormalMatrices(matrices, normals);
+        m_normalVBO.Update(std::span<const PackedNormalMatrix>{normals});
+    }
+
+    Sphere Mesh::ComputeBoundingSphere() const noexcept
+    {
+        // Position, texture coordinates and normal, as laid out in SetupMeshInstanced
+        constexpr size_t vertexFloats = (sizeof(Vector3f) + sizeof(Vector2f) + sizeof(Vector3f)) / sizeof(float);
+        const auto& vertices = m_meshData.vertices;
+
+        std::vector<Vector3f> positions;
+        positions.reserve(vertices.size() / vertexFloats);
+        for (size_t i = 0; i + 3 <= vertices.size(); i += vertexFloats)
+            positions.emplace_back(vertices[i], vertices[i + 1], vertices[i + 2]);
+
+        if (positions.empty())
+            return {};
+
+        const Vector3f center = AABB::FromPoints(positions).Center();
+        float radiusSquared = 0.0f;
+        for (const auto& position : positions)
+        {
+            const Vector3f d = position - center;
+            radiusSquared = std::max(radiusSquared, d.Dot(d));
+        }
+
+        return {center, std::sqrt(radiusSquared)};
     }
 
 
@@ -73,6 +143,14 @@ namespace lux
         //m_shader->SetUniform(m_samplerName, m_texture.GetTextureUnit());
         //m_texture.Draw(m_texture.GetTextureUnit());
         uint32_t indexCount = static_cast<uint32_t>(m_meshData.indices.size());
+        if (m_compressed)
+        {
+            m_shader->SetUniform("positionOffset", m_quantization.positionOffset);
+            m_shader->SetUniform("positionScale", m_quantization.positionScale);
+            m_shader->SetUniform("uvScaleOffset", Vector4f(m_quantization.uvScale[0], m_quantization.uvScale[1],
+                                                           m_quantization.uvOffset[0], m_quantization.uvOffset[1]));
+        }
+
         if (instanced)
         {
             m_shader->SetUniform("useInstancing", true);
@@ -15,22 +15,24 @@
 
 namespace lux
 {
-    void OBJParser::ReadCorner(std::string &description, std::vector<Vector3f> &v,
-                               std::vector<Vector2f> &vt, std::vector<Vector3f> &vn, std::vector<float> &vertices,
-                               std::unordered_map<std::string, uint32_t> &history, std::vector<uint32_t> &indices)
+    void OBJParser::ReadCorner(const std::pmr::string& description, const std::pmr::vector<Vector3f>& v,
+                               const std::pmr::vector<Vector2f>& vt, const std::pmr::vector<Vector3f>& vn,
+                               std::pmr::vector<float>& vertices, std::pmr::unordered_map<std::pmr::string, uint32_t>& history,
+                               std::pmr::vector<uint32_t>& indices)
     {
-        if (!history.contains(description)) {
-            history[description] = static_cast<uint32_t>(vertices.size() / 8);
-
-            std::vector<std::string> v_vt_vn = FileSystem::Split(description, "/");
-            Vector3f pos = v[std::stol(v_vt_vn[0]) - 1];
+        auto [it, inserted] = history.try_emplace(description, static_cast<uint32_t>(vertices.size() / 8));
+        if (inserted)
+        {
+            std::pmr::vector<std::pmr::string>& v_vt_vn = m_cornerTokens;
+            FileSystem::Split(description, "/", v_vt_vn);
+            Vector3f pos = v[std::stol(v_vt_vn[0].c_str()) - 1];
             vertices.push_back(pos[0]);
             vertices.push_back(pos[1]);
             vertices.push_back(pos[2]);
 
             if (v_vt_vn.size() > 1 && !v_vt_vn[1].empty())
             {
-                Vector2f tex = vt[std::stol(v_vt_vn[1]) - 1];
+                Vector2f tex = vt[std::stol(v_vt_vn[1].c_str()) - 1];
                 vertices.push_back(tex[0]);
                 vertices.push_back(tex[1]);
             }
@@ -41,7 +43,7 @@ namespace lux
             }
 
             if (v_vt_vn.size() > 2 && !v_vt_vn[2].empty()) {
-                Vector3f normal = vn[std::stol(v_vt_vn[2]) - 1];
+                Vector3f normal = vn[std::stol(v_vt_vn[2].c_str()) - 1];
                 vertices.push_back(normal[0]);
                 vertices.push_back(normal[1]);
                 vertices.push_back(normal[2]);
@@ -51,13 +53,14 @@ namespace lux
                 vertices.push_back(0.0f);
             }
         }
-        indices.push_back(history[description]);
+        indices.push_back(it->second);
     }
 
 
-    void OBJParser::ReadFace(std::vector<std::string> &words, std::vector<Vector3f> &v, std::vector<Vector2f> &vt,
-                             std::vector<Vector3f> &vn, std::vector<float> &vertices,
-                             std::unordered_map<std::string, uint32_t> &history, std::vector<uint32_t> &indices)
+    void OBJParser::ReadFace(const std::pmr::vector<std::pmr::string>& words, const std::pmr::vector<Vector3f>& v,
+                             const std::pmr::vector<Vector2f>& vt, const std::pmr::vector<Vector3f>& vn,
+                             std::pmr::vector<float>& vertices, std::pmr::unordered_map<std::pmr::string, uint32_t>& history,
+                             std::pmr::vector<uint32_t>& indices)
     {
         size_t triangleCount = words.size() - 3;
         for (size_t i = 0; i < triangleCount; ++i)
@@ -78,45 +81,59 @@ namespace lux
 
         int lineCount = 0;
 
-        std::vector<Vector3f> v;
-        std::vector<Vector2f> vt;
-        std::vector<Vector3f> vn;
+        std::pmr::vector<Vector3f> v {m_scratch};
+        std::pmr::vector<Vector2f> vt {m_scratch};
+        std::pmr::vector<Vector3f> vn {m_scratch};
         size_t vertexCount = 0, texCoordCount = 0, normalCount = 0, triangleCount = 0;
 
         filesys::FileReader fileReader(filename);
 
-        while (fileReader.HasNextLine())
+        // The caller may reset the scratch memory after this call, nothing of it may outlive the parse
+        struct ScratchRelease
         {
-            std::string line = fileReader.GetNextLine();
+            OBJParser& parser;
+            ~ScratchRelease() { parser.ReleaseScratch(); }
+        } scratchRelease {*this};
 
-            std::vector<std::string> words = fileReader.SplitLine(line, " ");
-            if (words[0] == "v")
+        // One line buffer for the whole file, only its capacity grows
+        std::string line;
+
+        // First pass only counts, by the leading keyword, so it needs no tokens
+        while (fileReader.GetLine(line))
+        {
+            const std::string_view keyword = std::string_view{line}.substr(0, line.find(' '));
+            if (keyword == "v")
                 ++vertexCount;
 
-            else if (words[0] == "vt")
+            else if (keyword == "vt")
                 ++texCoordCount;
 
-            else if (words[0] == "vn")
+            else if (keyword == "vn")
                 ++normalCount;
 
-            else if (words[0] == "f")
-                triangleCount += words.size() - 3;
+            else if (keyword == "f")
+                triangleCount += std::ranges::count(line, ' ') + 1 - 3;
         }
 
         v.reserve(vertexCount);
         vt.reserve(texCoordCount);
         vn.reserve(normalCount);
+        m_vertices.clear();
+        m_indices.clear();
         m_vertices.reserve(triangleCount * 3 * 8);
         m_indices.reserve(triangleCount * 3);
+        m_history.reserve(triangleCount * 3);
 
         fileReader.Reset();
 
-        while (fileReader.HasNextLine())
+        // Reused for every line, so only the first lines allocate tokens
+        std::pmr::vector<std::pmr::string> words {m_scratch};
+
+        while (fileReader.GetLine(line))
         {
-            std::string line = fileReader.GetNextLine();
             lineCount++;
 
-            std::vector<std::string> words = fileReader.SplitLine(line, " ");
+            FileSystem::Split(line, " ", words);
             if (words[0] == "v")
                 v.push_back(ReadVec<Vector3f>(words));
 
@@ -132,7 +149,16 @@ namespace lux
 
         m_elementCount = m_indices.size();
         Layout layout;
-        return MeshData{ m_indices, m_vertices, layout };
+
+        // Moving keeps the output resource, so the geometry is not copied
+        return MeshData{ std::move(m_indices), std::move(m_vertices), layout };
+    }
+
+    void OBJParser::ReleaseScratch() noexcept
+    {
+        // Swapping with empty containers frees nodes, buckets and capacity, clear() would keep them
+        std::pmr::unordered_map<std::pmr::string, uint32_t>{m_scratch}.swap(m_history);
+        std::pmr::vector<std::pmr::string>{m_scratch}.swap(m_cornerTokens);
     }
 
     std::unordered_map<std::string, Material> MaterialParser::ParseMaterial(const std::filesystem::path& filePath)
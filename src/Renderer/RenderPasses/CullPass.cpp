@@ -0,0 +1,54 @@
+#include <algorithm>
+#include <cmath>
+#include "../../../include/Renderer/RenderPasses/CullPass.hpp"
+#include "../../../include/Math/Quatf.hpp"
+
+namespace lux
+{
+    void CullPass::Begin(const Camera& camera, FrameAllocator& frame) noexcept
+    {
+        m_frame = &frame;
+        m_frustum = Frustum::FromMatrix(camera.GetViewProjection());
+    }
+
+    void CullPass::Submit(std::span<const Transform> transforms, const Sphere& localBounds) noexcept
+    {
+        m_transforms = transforms;
+        m_localBounds = localBounds;
+        m_visibleCount = 0;
+    }
+
+    void CullPass::Execute()
+    {
+        CORE_ASSERT(m_frame, "CullPass: Execute() before Begin()")
+
+        const size_t count = m_transforms.size();
+        const std::span<float> centerX = m_frame->AllocateSpan<float>(count);
+        const std::span<float> centerY = m_frame->AllocateSpan<float>(count);
+        const std::span<float> centerZ = m_frame->AllocateSpan<float>(count);
+        const std::span<float> radii = m_frame->AllocateSpan<float>(count);
+        m_visible = m_frame->AllocateSpan<uint32_t>(count);
+        const std::span<uint32_t> visible = m_visible;
+
+        const Vector3f& localCenter = m_localBounds.center;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Transform& transform = m_transforms[i];
+            const Vector3f& scale = transform.GetScale();
+            const Vector3f scaledCenter{localCenter.GetX() * scale.GetX(), localCenter.GetY() * scale.GetY(),
+                                        localCenter.GetZ() * scale.GetZ()};
+            const Vector3f center = transform.GetPosition() + Quatf{transform.GetRotation()}.Rotate(scaledCenter);
+
+            centerX[i] = center.GetX();
+            centerY[i] = center.GetY();
+            centerZ[i] = center.GetZ();
+            radii[i] = m_localBounds.radius * std::max({std::abs(scale.GetX()), std::abs(scale.GetY()), std::abs(scale.GetZ())});
+        }
+
+        const ConstVector3Stream centers{centerX, centerY, centerZ};
+        m_visibleCount = CullSpheres(m_frustum, centers, radii, visible);
+
+        m_matrices = m_frame->AllocateSpan<PackedMatrix4f>(m_visibleCount);
+        ComposeMatrices(m_transforms, visible.first(m_visibleCount), m_matrices);
+    }
+}
@@ -1,6 +1,7 @@
 #include "../../include/Utils/ImageLoad.hpp"
 #include "../../include/Renderer/Texture/Texture2D.hpp"
 #include "../../include/OpenGL/OpenglError.hpp"
+#include "../../include/Memory/MemoryTracker.hpp"
 
 namespace lux
 {
@@ -16,8 +17,15 @@ namespace lux
 
             GPUTexture::Load(m_texId, i, m_specs.width, m_specs.height, m_specs.channels, m_specs.format, m_specs.type, data);
             FreeImage(data);
+
+            m_gpuBytes += static_cast<size_t>(m_specs.width) * m_specs.height * m_specs.channels;
         }
 
+        // A full mip chain adds a third of the base level
+        if (m_specs.mipMap)
+            m_gpuBytes += m_gpuBytes / 3;
+        MemoryTracker::OnAllocate(MemoryTag::TEXTURE, m_gpuBytes);
+
         if (m_specs.mipMap)
         {
             GenerateMipmaps();
@@ -42,7 +50,10 @@ namespace lux
     Texture2D::~Texture2D()
     {
         if(m_texId != 0)
+        {
             GPUTexture::DeleteTexture(&m_texId);
+            MemoryTracker::OnFree(MemoryTag::TEXTURE, m_gpuBytes);
+        }
         GPUTexture::ReleaseUnit(m_texId);
     }
 
@@ -50,6 +61,7 @@ namespace lux
     {
         m_texId = other.m_texId;
         m_unit = other.m_unit;
+        m_gpuBytes = std::exchange(other.m_gpuBytes, 0);
         m_specs = std::move(other.m_specs);
         GPUTexture::ReleaseUnit(other.m_texId);
         other.m_texId = 0;
@@ -59,10 +71,17 @@ namespace lux
     {
         if (this != &other)
         {
-            m_texId = other.m_texId;
+            // Release the texture being replaced, as the destructor does
+            if (m_texId != 0)
+            {
+                GPUTexture::DeleteTexture(&m_texId);
+                MemoryTracker::OnFree(MemoryTag::TEXTURE, m_gpuBytes);
+            }
+
+            m_texId = std::exchange(other.m_texId, 0);
             m_unit = other.m_unit;
+            m_gpuBytes = std::exchange(other.m_gpuBytes, 0);
             m_specs = std::move(other.m_specs);
-            other.m_texId = 0;
         }
 
         return *this;
@@ -3,25 +3,45 @@
 
 namespace lux
 {
-    Scene::Scene(const std::string &name) : m_name { name }, m_camera { nullptr }
+    Scene::Scene(const std::string &name, std::pmr::memory_resource* resource) : m_name { name }, m_camera { nullptr },
+        m_meshes { resource }, m_meshHandles { resource }
     {
 
     }
 
-    Scene::Scene(const std::string& name, NonOwnPtr<Camera> camera) : m_name { name }, m_camera { camera }
+    Scene::Scene(const std::string& name, NonOwnPtr<Camera> camera, std::pmr::memory_resource* resource) :
+        m_name { name }, m_camera { camera }, m_meshes { resource }, m_meshHandles { resource }
     {
         CORE_ASSERT(m_camera != nullptr, "Camera is null")
     }
 
-    void Scene::AddMesh(const Ref<Mesh>& mesh) noexcept
+    MeshHandle Scene::AddMesh(const Ref<Mesh>& mesh)
     {
+        CORE_ASSERT(mesh != nullptr, "Mesh is null")
+
+        // A mesh added twice keeps its handle, so its instances still group together
+        auto it = std::ranges::find(m_meshes, mesh);
+        const MeshHandle handle = it != m_meshes.end() ? m_meshHandles[static_cast<size_t>(it - m_meshes.begin())]
+                                                       : m_meshTable.Insert(mesh.get());
         m_meshes.push_back(mesh);
+        m_meshHandles.push_back(handle);
+        return handle;
     }
 
     void Scene::RemoveMesh(const Ref<Mesh>& mesh) noexcept
     {
-        auto new_end = std::ranges::remove_if(m_meshes, [&](const Ref<Mesh>& m) { return m == mesh; }).begin();
-        m_meshes.erase(new_end, m_meshes.end());
+        for (size_t i = 0; i < m_meshes.size();)
+        {
+            if (m_meshes[i] != mesh)
+            {
+                ++i;
+                continue;
+            }
+
+            m_meshTable.Remove(m_meshHandles[i]);
+            m_meshes.erase(m_meshes.begin() + static_cast<std::ptrdiff_t>(i));
+            m_meshHandles.erase(m_meshHandles.begin() + static_cast<std::ptrdiff_t>(i));
+        }
     }
 
     void Scene::AddPrimitive(const Ref<IPrimitive>& primitive) noexcept
@@ -49,10 +69,9 @@ namespace lux
         }
     }
 
-    std::unordered_map<NonOwnPtr<Mesh>, std::vector<Transform>, MeshPtrHash, MeshPtrEq>
-    Scene::GroupMeshInstances(const std::vector<SceneObject>& objects)
+    std::unordered_map<MeshHandle, std::vector<Transform>> Scene::GroupMeshInstances(const std::vector<SceneObject>& objects)
     {
-        std::unordered_map<NonOwnPtr<Mesh>, std::vector<Transform>, MeshPtrHash, MeshPtrEq> grouped;
+        std::unordered_map<MeshHandle, std::vector<Transform>> grouped;
 
         for (const auto& obj : objects)
         {
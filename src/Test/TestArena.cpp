@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../include/Memory/ArenaAllocator.hpp"
+
+namespace lux
+{
+    struct Counted
+    {
+        explicit Counted(int& counter) : m_counter{counter} { ++m_counter; }
+        ~Counted() { --m_counter; }
+
+        int& m_counter;
+    };
+
+    TEST(ArenaTest, GrowsInsteadOfThrowing)
+    {
+        Arena arena {256};
+
+        std::vector<int*> values;
+        for (int i = 0; i < 1000; ++i)
+            values.push_back(arena.Create<int>(i));
+
+        for (int i = 0; i < 1000; ++i)
+            EXPECT_EQ(*values[i], i);
+
+        EXPECT_GT(arena.GetBlockCount(), 1u);
+
+        // Larger than a block and over-aligned: gets a block of its own
+        void* big = arena.Allocate(4096, 256);
+        EXPECT_EQ(reinterpret_cast<uintptr_t>(big) % 256, 0u);
+        EXPECT_EQ(*values[999], 999);
+    }
+
+    TEST(ArenaTest, ResetReusesBlocks)
+    {
+        Arena arena {1024};
+        int alive = 0;
+
+        for (int i = 0; i < 200; ++i)
+            arena.Create<Counted>(alive);
+
+        EXPECT_EQ(alive, 200);
+        const size_t blocks = arena.GetBlockCount();
+        const size_t reserved = arena.GetReservedBytes();
+
+        for (int frame = 0; frame < 10; ++frame)
+        {
+            arena.Reset();
+            EXPECT_EQ(alive, 0);
+
+            for (int i = 0; i < 200; ++i)
+                arena.Create<Counted>(alive);
+        }
+
+        EXPECT_EQ(arena.GetBlockCount(), blocks);
+        EXPECT_EQ(arena.GetReservedBytes(), reserved);
+
+        arena.Reset();
+        arena.Trim();
+        EXPECT_EQ(arena.GetBlockCount(), 0u);
+        EXPECT_EQ(arena.GetReservedBytes(), 0u);
+    }
+
+    TEST(ArenaTest, MarkersRollBack)
+    {
+        Arena arena {128};
+        int alive = 0;
+
+        arena.Create<Counted>(alive);
+        auto* kept = arena.Create<std::string>("kept across the scope");
+
+        const Arena::Marker marker = arena.GetMarker();
+        {
+            ArenaScope scope {arena};
+            for (int i = 0; i < 50; ++i)
+                arena.Create<Counted>(alive);
+
+            EXPECT_EQ(alive, 51);
+        }
+        EXPECT_EQ(alive, 1);
+        EXPECT_EQ(*kept, "kept across the scope");
+
+        // Memory after the marker is handed out again
+        void* first = arena.Allocate(16);
+        arena.Rewind(marker);
+        EXPECT_EQ(arena.Allocate(16), first);
+
+        arena.Reset();
+        EXPECT_EQ(alive, 0);
+    }
+
+    TEST(ArenaTest, ThreadLocalInstances)
+    {
+        Arena* main = &Arena::ThreadLocal();
+        EXPECT_EQ(main, &Arena::ThreadLocal());
+
+        Arena* other = nullptr;
+        std::thread worker{[&]
+        {
+            other = &Arena::ThreadLocal();
+            int* values = other->CreateArray<int>(64);
+            EXPECT_EQ(values[63], 0);
+        }};
+        worker.join();
+
+        EXPECT_NE(main, other);
+    }
+}
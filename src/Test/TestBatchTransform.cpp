@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "../../include/Math/BatchTransform.hpp"
+
+namespace lux::math
+{
+    static Matrix4f AffineMatrix()
+    {
+        return Matrix4f::Translate(Vector3f(1.5f, -2.0f, 0.25f)) *
+               Matrix4f::Rotate(0.7f, Vector3f(0.3f, 1.0f, -0.5f)) *
+               Matrix4f::Scale(Vector3f(2.0f, 0.5f, 1.25f));
+    }
+
+    // Odd count so every backend also runs its scalar tail
+    static std::vector<Vector3f> RandomPoints(size_t count)
+    {
+        std::mt19937 rng {7};
+        std::uniform_real_distribution<float> dist {-10.0f, 10.0f};
+
+        std::vector<Vector3f> points;
+        for (size_t i = 0; i < count; ++i)
+            points.emplace_back(dist(rng), dist(rng), dist(rng));
+        return points;
+    }
+
+    static void ExpectNear(const Vector3f& actual, const Vector4f& expected)
+    {
+        EXPECT_NEAR(actual.GetX(), expected[0], 1e-4f);
+        EXPECT_NEAR(actual.GetY(), expected[1], 1e-4f);
+        EXPECT_NEAR(actual.GetZ(), expected[2], 1e-4f);
+    }
+
+    TEST(BatchTransformTest, PointsMatchMatrixVectorProduct)
+    {
+        Matrix4f m = AffineMatrix();
+        auto points = RandomPoints(37);
+        std::vector<Vector3f> out(points.size());
+
+        TransformPoints(m, points, out);
+
+        for (size_t i = 0; i < points.size(); ++i)
+            ExpectNear(out[i], m * Vector4f(points[i], 1.0f));
+    }
+
+    TEST(BatchTransformTest, DirectionsIgnoreTranslation)
+    {
+        Matrix4f m = AffineMatrix();
+        auto directions = RandomPoints(37);
+        std::vector<Vector3f> out(directions.size());
+
+        TransformDirections(m, directions, out);
+
+        for (size_t i = 0; i < directions.size(); ++i)
+            ExpectNear(out[i], m * Vector4f(directions[i], 0.0f));
+    }
+
+    TEST(BatchTransformTest, StreamsMatchArrays)
+    {
+        Matrix4f m = AffineMatrix();
+        auto points = RandomPoints(37);
+        std::vector<Vector3f> expected(points.size());
+        TransformPoints(m, points, expected);
+
+        std::vector<float> x, y, z;
+        for (const auto& p : points)
+        {
+            x.push_back(p.GetX());
+            y.push_back(p.GetY());
+            z.push_back(p.GetZ());
+        }
+
+        // In place
+        Vector3Stream stream {x, y, z};
+        TransformPoints(m, stream, stream);
+
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            EXPECT_NEAR(x[i], expected[i].GetX(), 1e-4f);
+            EXPECT_NEAR(y[i], expected[i].GetY(), 1e-4f);
+            EXPECT_NEAR(z[i], expected[i].GetZ(), 1e-4f);
+        }
+    }
+
+    TEST(BatchTransformTest, AABBsBoundTransformedCorners)
+    {
+        Matrix4f m = AffineMatrix();
+        auto points = RandomPoints(2 * 21);
+
+        std::vector<AABB> boxes;
+        for (size_t i = 0; i < points.size(); i += 2)
+        {
+            AABB box = AABB::FromPoints(std::span(points).subspan(i, 2));
+            boxes.push_back(box);
+        }
+
+        std::vector<AABB> out(boxes.size());
+        TransformAABBs(m, boxes, out);
+
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            std::vector<Vector3f> corners;
+            for (int c = 0; c < 8; ++c)
+            {
+                Vector3f corner {c & 1 ? boxes[i].max.GetX() : boxes[i].min.GetX(),
+                                 c & 2 ? boxes[i].max.GetY() : boxes[i].min.GetY(),
+                                 c & 4 ? boxes[i].max.GetZ() : boxes[i].min.GetZ()};
+                Vector4f transformed = m * Vector4f(corner, 1.0f);
+                corners.emplace_back(transformed[0], transformed[1], transformed[2]);
+            }
+
+            AABB expected = AABB::FromPoints(corners);
+            EXPECT_NEAR(out[i].min.GetX(), expected.min.GetX(), 1e-3f);
+            EXPECT_NEAR(out[i].min.GetY(), expected.min.GetY(), 1e-3f);
+            EXPECT_NEAR(out[i].min.GetZ(), expected.min.GetZ(), 1e-3f);
+            EXPECT_NEAR(out[i].max.GetX(), expected.max.GetX(), 1e-3f);
+            EXPECT_NEAR(out[i].max.GetY(), expected.max.GetY(), 1e-3f);
+            EXPECT_NEAR(out[i].max.GetZ(), expected.max.GetZ(), 1e-3f);
+        }
+    }
+
+    TEST(BatchTransformTest, AABBStreamsMatchArrays)
+    {
+        Matrix4f m = AffineMatrix();
+        auto points = RandomPoints(2 * 13);
+
+        std::vector<AABB> boxes;
+        std::vector<float> minX, minY, minZ, maxX, maxY, maxZ;
+        for (size_t i = 0; i < points.size(); i += 2)
+        {
+            AABB box = AABB::FromPoints(std::span(points).subspan(i, 2));
+            boxes.push_back(box);
+            minX.push_back(box.min.GetX()); minY.push_back(box.min.GetY()); minZ.push_back(box.min.GetZ());
+            maxX.push_back(box.max.GetX()); maxY.push_back(box.max.GetY()); maxZ.push_back(box.max.GetZ());
+        }
+
+        std::vector<AABB> expected(boxes.size());
+        TransformAABBs(m, boxes, expected);
+
+        Vector3Stream mins {minX, minY, minZ};
+        Vector3Stream maxs {maxX, maxY, maxZ};
+        TransformAABBs(m, mins, maxs, mins, maxs);
+
+        for (size_t i = 0; i < boxes.size(); ++i)
+        {
+            EXPECT_NEAR(minX[i], expected[i].min.GetX(), 1e-4f);
+            EXPECT_NEAR(minZ[i], expected[i].min.GetZ(), 1e-4f);
+            EXPECT_NEAR(maxY[i], expected[i].max.GetY(), 1e-4f);
+        }
+    }
+}
@@ -65,4 +65,21 @@ namespace lux::test
         m_Camera->SetTransform(transform);
         EXPECT_EQ(m_Camera->GetTransform(), transform);
     }
-}
\ No newline at end of file
+
+    TEST(CameraViewProjectionTest, MatchesShaderProduct)
+    {
+        Camera camera{math::Vector3f(1.0f, 2.0f, 5.0f), math::Vector3f(0.0f, 0.0f, -1.0f), math::Vector3f(0.0f, 1.0f, 0.0f),
+                      16.0f / 9.0f, 60.0f, 0.0f, 0.0f};
+
+        // The GPU reads each uniform transposed and evaluates projection * view * p
+        const math::Matrix4f projection = camera.GetProjection().Transpose();
+        const math::Matrix4f view = camera.GetView().Transpose();
+        const math::Vector4f point(3.0f, -1.0f, -4.0f, 1.0f);
+
+        const math::Vector4f expected = projection * (view * point);
+        const math::Vector4f actual = camera.GetViewProjection() * point;
+
+        for (size_t i = 0; i < 4; ++i)
+            EXPECT_NEAR(actual[i], expected[i], 1e-4f);
+    }
+}
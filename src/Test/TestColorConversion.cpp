@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "../../include/Math/ColorConversion.hpp"
+
+namespace lux
+{
+    // 37 is not a multiple of any lane count, so the padded remainder is covered too
+    static std::vector<Color> Ramp(size_t count)
+    {
+        std::vector<Color> colors;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const float t = static_cast<float>(i) / static_cast<float>(count - 1);
+            colors.emplace_back(t, 1.0f - t, t * t, 0.25f + 0.5f * t);
+        }
+        return colors;
+    }
+
+    TEST(ColorConversionTest, TransferFunctionsStayWithinBounds)
+    {
+        constexpr size_t Count = 1 << 16;
+        std::vector<Color> in;
+        for (size_t i = 0; i < Count; i += 2)
+        {
+            const float t = static_cast<float>(i) / (Count - 1);
+            in.emplace_back(t, static_cast<float>(i + 1) / (Count - 1), t * t, 0.5f);
+        }
+
+        std::vector<Color> linear(in.size()), srgb(in.size());
+        SrgbToLinear(in, linear);
+        LinearToSrgb(in, srgb);
+
+        for (size_t i = 0; i < in.size(); ++i)
+        {
+            for (uint32_t c = 0; c < 3; ++c)
+            {
+                const float reference = SrgbToLinear(in[i][c]);
+                EXPECT_LE(std::abs(linear[i][c] - reference), 3e-6f * reference + 1e-9f) << in[i][c];
+                EXPECT_NEAR(srgb[i][c], LinearToSrgb(in[i][c]), 1e-5f) << in[i][c];
+            }
+
+            EXPECT_EQ(linear[i].GetA(), 0.5f);
+            EXPECT_EQ(srgb[i].GetA(), 0.5f);
+        }
+    }
+
+    TEST(ColorConversionTest, Srgb8RoundTripsExactly)
+    {
+        std::vector<uint8_t> bytes(256 * 4);
+        for (size_t i = 0; i < 256; ++i)
+        {
+            bytes[i * 4] = static_cast<uint8_t>(i);
+            bytes[i * 4 + 1] = static_cast<uint8_t>(255 - i);
+            bytes[i * 4 + 2] = static_cast<uint8_t>(i * 7);
+            bytes[i * 4 + 3] = static_cast<uint8_t>(i);
+        }
+
+        std::vector<Color> colors(256);
+        UnpackSrgbRGBA8(bytes, colors);
+        EXPECT_FLOAT_EQ(colors[200].GetR(), SrgbToLinear(200.0f / 255.0f));
+        EXPECT_FLOAT_EQ(colors[200].GetA(), 200.0f / 255.0f);
+
+        std::vector<uint8_t> packed(bytes.size());
+        PackSrgbRGBA8(colors, packed);
+        EXPECT_EQ(packed, bytes);
+
+        UnpackRGBA8(bytes, colors);
+        PackRGBA8(colors, packed);
+        EXPECT_EQ(packed, bytes);
+    }
+
+    TEST(ColorConversionTest, PackedFormatsMatchScalar)
+    {
+        std::vector<Color> colors = Ramp(37);
+        colors.emplace_back(1.5f, -0.5f, 0.5f, 2.0f);
+
+        std::vector<uint8_t> rgba8(colors.size() * 4);
+        std::vector<uint32_t> rgb10a2(colors.size());
+        std::vector<uint16_t> rgba16f(colors.size() * 4);
+        PackRGBA8(colors, rgba8);
+        PackRGB10A2(colors, rgb10a2);
+        PackRGBA16F(colors, rgba16f);
+
+        auto unorm = [](float x, float max) { return static_cast<uint32_t>(std::lrint(std::clamp(x, 0.0f, 1.0f) * max)); };
+
+        for (size_t i = 0; i < colors.size(); ++i)
+        {
+            const Color& c = colors[i];
+            for (uint32_t k = 0; k < 4; ++k)
+            {
+                EXPECT_EQ(rgba8[i * 4 + k], unorm(c[k], 255.0f)) << i;
+                EXPECT_EQ(rgba16f[i * 4 + k], math::FloatToHalf(c[k])) << i;
+            }
+
+            const uint32_t expected = unorm(c.GetR(), 1023.0f) | unorm(c.GetG(), 1023.0f) << 10 |
+                                      unorm(c.GetB(), 1023.0f) << 20 | unorm(c.GetA(), 3.0f) << 30;
+            EXPECT_EQ(rgb10a2[i], expected) << i;
+        }
+    }
+
+    TEST(ColorConversionTest, PremultiplyAlphaInPlace)
+    {
+        std::vector<Color> colors = Ramp(37);
+        const std::vector<Color> original = colors;
+        PremultiplyAlpha(colors, colors);
+
+        for (size_t i = 0; i < colors.size(); ++i)
+            EXPECT_EQ(colors[i], original[i] * Color(original[i].GetA(), original[i].GetA(), original[i].GetA(), 1.0f)) << i;
+    }
+}
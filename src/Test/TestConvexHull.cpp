@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <set>
+#include <tuple>
+#include <vector>
+#include "../../include/Math/Geometry/Convex Hull.hpp"
+
+namespace lux::math
+{
+    static std::vector<Vector3f> RandomPoints(size_t count, uint32_t seed, bool onSphere)
+    {
+        std::mt19937 rng{seed};
+        std::normal_distribution<float> normal{0.0f, 1.0f};
+        std::uniform_real_distribution<float> uniform{0.0f, 1.0f};
+
+        std::vector<Vector3f> points;
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vector3f direction = Vector3f{normal(rng), normal(rng), normal(rng)}.Normalize();
+            points.push_back(direction * (onSphere ? 10.0f : 10.0f * std::cbrt(uniform(rng))));
+        }
+        return points;
+    }
+
+    // Closed two-manifold: every directed edge appears once and its reverse appears too
+    static void ExpectClosedHull(const ConvexHull& hull)
+    {
+        std::set<std::pair<uint32_t, uint32_t>> edges;
+        for (size_t t = 0; t < hull.indices.size(); t += 3)
+            for (size_t i = 0; i < 3; ++i)
+                EXPECT_TRUE(edges.insert({hull.indices[t + i], hull.indices[t + (i + 1) % 3]}).second);
+
+        for (const auto& [from, to] : edges)
+            EXPECT_TRUE(edges.contains({to, from}));
+
+        // Euler characteristic of a sphere
+        const auto faces = static_cast<int64_t>(hull.TriangleCount());
+        EXPECT_EQ(static_cast<int64_t>(hull.vertices.size()) - faces * 3 / 2 + faces, 2);
+    }
+
+    static void ExpectContains(const ConvexHull& hull, const std::vector<Vector3f>& points, float tolerance)
+    {
+        for (size_t t = 0; t < hull.indices.size(); t += 3)
+        {
+            const Plane plane = Plane::FromPoints(hull.vertices[hull.indices[t]], hull.vertices[hull.indices[t + 1]],
+                                                  hull.vertices[hull.indices[t + 2]]);
+            for (const auto& point : points)
+                ASSERT_LE(plane.SignedDistance(point), tolerance);
+        }
+    }
+
+    TEST(ConvexHullTest, CubeWithInteriorPoints)
+    {
+        std::vector<Vector3f> points = RandomPoints(200, 1, false);
+        for (auto& point : points)
+            point = point * 0.05f;
+
+        for (int i = 0; i < 8; ++i)
+            points.push_back(Vector3f{i & 1 ? 1.0f : -1.0f, i & 2 ? 1.0f : -1.0f, i & 4 ? 1.0f : -1.0f});
+
+        ConvexHull hull = BuildConvexHull(points);
+        EXPECT_EQ(hull.vertices.size(), 8u);
+        EXPECT_EQ(hull.TriangleCount(), 12u);
+        ExpectClosedHull(hull);
+        ExpectContains(hull, points, 1e-5f);
+    }
+
+    TEST(ConvexHullTest, ContainsEveryInputPoint)
+    {
+        std::vector<Vector3f> points = RandomPoints(5000, 2, false);
+        ConvexHull hull = BuildConvexHull(points);
+
+        ASSERT_FALSE(hull.Empty());
+        ExpectClosedHull(hull);
+        ExpectContains(hull, points, 1e-4f);
+    }
+
+    TEST(ConvexHullTest, DegenerateInputGivesEmptyHull)
+    {
+        EXPECT_TRUE(BuildConvexHull(std::vector<Vector3f>{Vector3f{0.0f, 0.0f, 0.0f}, Vector3f{1.0f, 0.0f, 0.0f}}).Empty());
+
+        std::vector<Vector3f> planar;
+        for (int i = 0; i < 50; ++i)
+            planar.push_back(Vector3f{static_cast<float>(i % 7), static_cast<float>(i / 7), 0.0f});
+        EXPECT_TRUE(BuildConvexHull(planar).Empty());
+    }
+
+    TEST(ConvexHullTest, VertexBudgetLimitsHull)
+    {
+        std::vector<Vector3f> points = RandomPoints(2000, 3, true);
+        ConvexHull hull = BuildConvexHull(points, ConvexHullSettings{.maxVertices = 32});
+
+        EXPECT_LE(hull.vertices.size(), 32u);
+        EXPECT_GE(hull.vertices.size(), 30u);
+        ExpectClosedHull(hull);
+    }
+
+    TEST(ConvexHullTest, ParallelPartitionMatchesSerial)
+    {
+        std::vector<Vector3f> points = RandomPoints(20000, 4, false);
+
+        ConvexHull serial = BuildConvexHull(points, ConvexHullSettings{.parallelThreshold = points.size() + 1});
+        ConvexHull parallel = BuildConvexHull(points, ConvexHullSettings{.parallelThreshold = 1, .threadCount = 4});
+
+        EXPECT_EQ(serial.indices, parallel.indices);
+        ASSERT_EQ(serial.vertices.size(), parallel.vertices.size());
+        for (size_t i = 0; i < serial.vertices.size(); ++i)
+            EXPECT_EQ(serial.vertices[i], parallel.vertices[i]);
+    }
+}
@@ -0,0 +1,51 @@
+#include <gtest/gtest.h>
+#include <array>
+#include <string>
+#include "../../include/Event/EventSystem.hpp"
+
+namespace lux
+{
+    struct ResizeEvent
+    {
+        int m_width;
+        int m_height;
+    };
+
+    // Larger than an event chunk, goes through the heap path
+    struct PayloadEvent
+    {
+        explicit PayloadEvent(std::string text) : m_text{std::move(text)} {}
+
+        std::string m_text;
+        std::array<double, 16> m_values {};
+    };
+
+    TEST(EventSystemTest, DispatchesQueuedEvents)
+    {
+        EventDispatcher dispatcher;
+        const uint32_t id = EventDispatcher::GenerateListenerID();
+
+        int area = 0;
+        std::string text;
+        dispatcher.RegisterListener<ResizeEvent>(id, [&](const ResizeEvent& e) { area += e.m_width * e.m_height; });
+        dispatcher.RegisterListener<PayloadEvent>(id, [&](const PayloadEvent& e) { text += e.m_text; });
+
+        for (int frame = 0; frame < 100; ++frame)
+        {
+            dispatcher.PostEvent<ResizeEvent>(2, 3);
+            dispatcher.PostEvent<PayloadEvent>("x");
+            dispatcher.PollEvents();
+        }
+
+        EXPECT_EQ(area, 600);
+        EXPECT_EQ(text.size(), 100u);
+
+        dispatcher.EraseListener(id);
+        dispatcher.PostEvent<ResizeEvent>(5, 5);
+        dispatcher.PollEvents();
+        EXPECT_EQ(area, 600);
+
+        // Events still queued are released with the dispatcher
+        dispatcher.PostEvent<PayloadEvent>("never dispatched, long enough to skip the small string buffer");
+    }
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <numbers>
+#include <random>
+#include <vector>
+#include "../../include/Math/FastMath.hpp"
+
+namespace lux::math
+{
+    TEST(FastMathTest, SinCosWithinBound)
+    {
+        std::mt19937 rng {1};
+        std::uniform_real_distribution<float> wide {-8192.0f, 8192.0f};
+        std::uniform_real_distribution<float> narrow {-7.0f, 7.0f};
+
+        std::vector<float> angles;
+        for (int i = 0; i < 100000; ++i)
+            angles.push_back(i % 2 ? wide(rng) : narrow(rng));
+        for (int k = -16; k <= 16; ++k)
+            angles.push_back(k * std::numbers::pi_v<float> / 4.0f);
+        angles.push_back(0.0f);
+        angles.push_back(8192.0f);
+        angles.push_back(-8192.0f);
+
+        std::vector<float> sines(angles.size()), cosines(angles.size());
+        fast::SinCos(angles, sines, cosines);
+
+        double maxError = 0.0;
+        for (size_t i = 0; i < angles.size(); ++i)
+        {
+            const double x = angles[i];
+            maxError = std::max({maxError, std::abs(sines[i] - std::sin(x)), std::abs(cosines[i] - std::cos(x))});
+
+            float s, c;
+            fast::SinCos(angles[i], s, c);
+            EXPECT_EQ(s, sines[i]) << angles[i];
+            EXPECT_EQ(c, cosines[i]) << angles[i];
+        }
+
+        EXPECT_LT(maxError, 1.5e-7);
+        EXPECT_EQ(fast::Sin(0.0f), 0.0f);
+        EXPECT_EQ(fast::Cos(0.0f), 1.0f);
+    }
+
+    TEST(FastMathTest, Atan2WithinBound)
+    {
+        std::mt19937 rng {2};
+        std::uniform_real_distribution<float> dist {-100.0f, 100.0f};
+
+        std::vector<float> ys, xs;
+        for (int i = 0; i < 100000; ++i)
+        {
+            ys.push_back(dist(rng));
+            xs.push_back(i % 3 ? dist(rng) : dist(rng) * 1e-3f);
+        }
+
+        // axes, diagonals and the tan(pi / 8) switch point
+        for (float y : {-1.0f, 0.0f, 1.0f, 0.41421356f, -0.41421356f})
+            for (float x : {-1.0f, 0.0f, 1.0f})
+            {
+                ys.push_back(y);
+                xs.push_back(x);
+            }
+
+        std::vector<float> out(ys.size());
+        fast::Atan2(ys, xs, out);
+
+        double maxError = 0.0;
+        for (size_t i = 0; i < out.size(); ++i)
+        {
+            if (ys[i] == 0.0f && xs[i] == 0.0f)
+                EXPECT_EQ(out[i], 0.0f);
+            else
+                maxError = std::max(maxError, std::abs(out[i] - std::atan2(double(ys[i]), double(xs[i]))));
+
+            EXPECT_EQ(fast::Atan2(ys[i], xs[i]), out[i]);
+        }
+
+        EXPECT_LT(maxError, 3e-7);
+    }
+
+    TEST(FastMathTest, RsqrtWithinBound)
+    {
+        std::vector<float> values;
+        for (float v = 1e-30f; v < 1e30f; v *= 1.0013f)
+            values.push_back(v);
+
+        std::vector<float> out(values.size());
+        fast::Rsqrt(values, out);
+
+        double maxError = 0.0;
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            const double expected = 1.0 / std::sqrt(double(values[i]));
+            maxError = std::max(maxError, std::abs(out[i] - expected) / expected);
+        }
+
+        EXPECT_LT(maxError, 3e-7);
+        EXPECT_NEAR(fast::Rsqrt(4.0f), 0.5f, 1e-7f);
+    }
+
+    TEST(FastMathTest, DegreesConvertInSinglePrecision)
+    {
+        static_assert(std::is_same_v<decltype(fast::DegToRad(1.0f)), float>);
+        EXPECT_FLOAT_EQ(fast::DegToRad(180.0f), std::numbers::pi_v<float>);
+        EXPECT_FLOAT_EQ(fast::RadToDeg(std::numbers::pi_v<float> / 2.0f), 90.0f);
+    }
+}
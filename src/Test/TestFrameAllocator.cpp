@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <numeric>
+#include <span>
+#include <stdexcept>
+#include "../../include/Memory/FrameAllocator.hpp"
+
+namespace lux
+{
+    static float Sum(std::span<const float> values)
+    {
+        return std::accumulate(values.begin(), values.end(), 0.0f);
+    }
+
+    TEST(FrameAllocatorTest, MemoryLivesForFramesInFlight)
+    {
+        FrameAllocator frames {2, 1024};
+
+        FrameSpan<float> first = frames.AllocateSpan<float>(4);
+        const float* firstData = first.data();
+        for (size_t i = 0; i < first.size(); ++i)
+            first[i] = static_cast<float>(i);
+
+        frames.BeginFrame();
+        FrameSpan<float> second = frames.AllocateSpan<float>(4);
+        EXPECT_NE(first.data(), second.data());
+
+        // The previous frame is still readable while this one runs
+        EXPECT_TRUE(frames.IsLive(0));
+        EXPECT_FLOAT_EQ(Sum(first), 6.0f);
+
+        frames.BeginFrame();
+        EXPECT_FALSE(frames.IsLive(0));
+        EXPECT_TRUE(frames.IsLive(1));
+
+        // Frame 0's arena was reset and hands out the same memory again
+        FrameSpan<float> third = frames.AllocateSpan<float>(4);
+        EXPECT_EQ(third.data(), firstData);
+    }
+
+    TEST(FrameAllocatorTest, FrameVectorGrows)
+    {
+        FrameAllocator frames;
+        FrameVector<uint32_t> values = frames.MakeVector<uint32_t>();
+
+        for (uint32_t i = 0; i < 1000; ++i)
+            values.push_back(i);
+
+        ASSERT_EQ(values.size(), 1000u);
+        EXPECT_GE(values.capacity(), 1000u);
+        for (uint32_t i = 0; i < 1000; ++i)
+            EXPECT_EQ(values[i], i);
+
+        values.resize(1200);
+        EXPECT_EQ(values[1100], 0u);
+
+        FrameSpan<uint32_t> span = values.GetSpan();
+        std::span<const uint32_t> view = span;
+        EXPECT_EQ(view.size(), 1200u);
+        EXPECT_EQ(view[999], 999u);
+    }
+
+    TEST(FrameAllocatorTest, SteadyFramesDoNotTouchTheHeap)
+    {
+        FrameAllocator frames {3, 4096};
+
+        auto frame = [&]
+        {
+            frames.BeginFrame();
+            FrameVector<float> values = frames.MakeVector<float>();
+            for (int i = 0; i < 5000; ++i)
+                values.push_back(1.0f);
+
+            FrameSpan<uint64_t> scratch = frames.AllocateSpan<uint64_t>(256);
+            scratch[255] = 1;
+            EXPECT_FLOAT_EQ(Sum(values), 5000.0f);
+        };
+
+        for (int i = 0; i < 3; ++i)
+            frame();
+
+        const size_t reserved = frames.GetReservedBytes();
+        for (int i = 0; i < 100; ++i)
+            frame();
+
+        EXPECT_EQ(frames.GetReservedBytes(), reserved);
+    }
+
+    TEST(FrameAllocatorTest, DetectsUseAfterFrame)
+    {
+        if (!FrameChecks)
+            GTEST_SKIP() << "LUX_FRAME_CHECKS is off";
+
+        FrameAllocator frames {2};
+        FrameSpan<int> span = frames.AllocateSpan<int>(8);
+        FrameVector<int> vector = frames.MakeVector<int>(8);
+        vector.push_back(1);
+
+        frames.BeginFrame();
+        EXPECT_NO_THROW(span[0] = 1);
+        EXPECT_NO_THROW(vector.push_back(2));
+
+        frames.BeginFrame();
+        EXPECT_THROW(span[0] = 2, std::logic_error);
+        EXPECT_THROW(vector.push_back(3), std::logic_error);
+        EXPECT_THROW(static_cast<void>(std::span<const int>{span}), std::logic_error);
+    }
+}
@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "../../include/Math/Geometry/Frustum.hpp"
+
+namespace lux::math
+{
+    static Frustum MakeFrustum()
+    {
+        // Camera at the origin looking down -Z with a 90 degree field of view
+        return Frustum::FromMatrix(Matrix4f::Perspective(90.0f, 1.0f, 1.0f, 100.0f));
+    }
+
+    TEST(FrustumTest, ExtractsNormalizedPlanes)
+    {
+        Frustum frustum = MakeFrustum();
+
+        for (const auto& plane : frustum.planes)
+            EXPECT_NEAR(plane.normal.Length(), 1.0f, 1e-5f);
+
+        const Plane& nearPlane = frustum.planes[Frustum::NEAR];
+        EXPECT_NEAR(nearPlane.normal.GetZ(), -1.0f, 1e-5f);
+        EXPECT_NEAR(nearPlane.distance, -1.0f, 1e-4f);
+
+        const Plane& farPlane = frustum.planes[Frustum::FAR];
+        EXPECT_NEAR(farPlane.normal.GetZ(), 1.0f, 1e-5f);
+        EXPECT_NEAR(farPlane.distance, 100.0f, 1e-2f);
+    }
+
+    TEST(FrustumTest, ClassifiesSpheresAndBoxes)
+    {
+        Frustum frustum = MakeFrustum();
+
+        EXPECT_TRUE(frustum.Intersects(Sphere{Vector3f{0.0f, 0.0f, -10.0f}, 1.0f}));
+        EXPECT_TRUE(frustum.Intersects(Sphere{Vector3f{0.0f, 0.0f, -0.5f}, 1.0f}));
+        EXPECT_TRUE(frustum.Intersects(Sphere{Vector3f{10.5f, 0.0f, -10.0f}, 1.0f}));
+        EXPECT_FALSE(frustum.Intersects(Sphere{Vector3f{0.0f, 0.0f, 10.0f}, 1.0f}));
+        EXPECT_FALSE(frustum.Intersects(Sphere{Vector3f{0.0f, 0.0f, -200.0f}, 1.0f}));
+        EXPECT_FALSE(frustum.Intersects(Sphere{Vector3f{0.0f, 20.0f, -10.0f}, 1.0f}));
+
+        EXPECT_TRUE(frustum.Intersects(AABB{Vector3f{-1.0f, -1.0f, -11.0f}, Vector3f{1.0f, 1.0f, -9.0f}}));
+        EXPECT_TRUE(frustum.Intersects(AABB{Vector3f{9.0f, -1.0f, -11.0f}, Vector3f{12.0f, 1.0f, -9.0f}}));
+        EXPECT_FALSE(frustum.Intersects(AABB{Vector3f{-1.0f, -1.0f, 2.0f}, Vector3f{1.0f, 1.0f, 4.0f}}));
+        EXPECT_FALSE(frustum.Intersects(AABB{Vector3f{15.0f, -1.0f, -11.0f}, Vector3f{17.0f, 1.0f, -9.0f}}));
+    }
+
+    TEST(FrustumTest, BatchCullingMatchesScalar)
+    {
+        Frustum frustum = MakeFrustum();
+        std::mt19937 rng{11};
+        std::uniform_real_distribution<float> position{-60.0f, 60.0f};
+        std::uniform_real_distribution<float> size{0.1f, 5.0f};
+
+        // Not a multiple of the lane count so the scalar tail runs too
+        constexpr size_t count = 1003;
+        std::vector<float> x(count), y(count), z(count), ex(count), ey(count), ez(count), radii(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            x[i] = position(rng); y[i] = position(rng); z[i] = position(rng);
+            ex[i] = size(rng); ey[i] = size(rng); ez[i] = size(rng);
+            radii[i] = size(rng);
+        }
+
+        const ConstVector3Stream centers{x, y, z};
+        const ConstVector3Stream extents{ex, ey, ez};
+        std::vector<uint32_t> visible(count);
+
+        std::vector<uint32_t> expected;
+        for (uint32_t i = 0; i < count; ++i)
+            if (frustum.Intersects(Sphere{Vector3f{x[i], y[i], z[i]}, radii[i]}))
+                expected.push_back(i);
+
+        size_t visibleCount = CullSpheres(frustum, centers, radii, visible);
+        ASSERT_GT(expected.size(), 0u);
+        ASSERT_LT(expected.size(), count);
+        EXPECT_EQ(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount), expected);
+
+        expected.clear();
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            const Vector3f center{x[i], y[i], z[i]}, extent{ex[i], ey[i], ez[i]};
+            if (frustum.Intersects(AABB{center - extent, center + extent}))
+                expected.push_back(i);
+        }
+
+        visibleCount = CullAABBs(frustum, centers, extents, visible);
+        EXPECT_EQ(std::vector<uint32_t>(visible.begin(), visible.begin() + visibleCount), expected);
+    }
+}
@@ -0,0 +1,56 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <limits>
+#include <vector>
+#include "../../include/Math/Half.hpp"
+
+namespace lux::math
+{
+    TEST(HalfTest, EveryHalfRoundTrips)
+    {
+        for (uint32_t bits = 0; bits <= 0xFFFFu; ++bits)
+        {
+            const auto half = static_cast<uint16_t>(bits);
+            const float value = HalfToFloat(half);
+            if (std::isnan(value))
+                EXPECT_EQ(FloatToHalf(value) & 0x7E00u, 0x7E00u) << bits;
+            else
+                EXPECT_EQ(FloatToHalf(value), half) << bits;
+        }
+    }
+
+    TEST(HalfTest, RoundsToNearestEven)
+    {
+        EXPECT_EQ(FloatToHalf(1.0f), 0x3C00u);
+        EXPECT_EQ(FloatToHalf(-2.0f), 0xC000u);
+        EXPECT_EQ(FloatToHalf(65504.0f), 0x7BFFu);
+        EXPECT_EQ(FloatToHalf(65520.0f), 0x7C00u);
+        EXPECT_EQ(FloatToHalf(std::numeric_limits<float>::infinity()), 0x7C00u);
+        EXPECT_EQ(FloatToHalf(0x1p-24f), 0x0001u);
+        EXPECT_EQ(FloatToHalf(0x1p-26f), 0x0000u);
+
+        // halfway between 1 and the next half (1 + 2^-10) goes to the even mantissa, just above goes up
+        EXPECT_EQ(FloatToHalf(1.0f + 0x1p-11f), 0x3C00u);
+        EXPECT_EQ(FloatToHalf(1.0f + 0x1p-11f + 0x1p-20f), 0x3C01u);
+        EXPECT_EQ(FloatToHalf(1.0f + 3 * 0x1p-11f), 0x3C02u);
+    }
+
+    TEST(HalfTest, BatchMatchesScalar)
+    {
+        std::vector<float> values;
+        for (int i = -300; i < 300; ++i)
+            values.push_back(std::ldexp(static_cast<float>(i) * 1.37f, i / 20));
+
+        std::vector<uint16_t> halves(values.size());
+        FloatToHalf(values, halves);
+
+        std::vector<float> back(values.size());
+        HalfToFloat(halves, back);
+
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+            EXPECT_EQ(halves[i], FloatToHalf(values[i])) << i;
+            EXPECT_EQ(back[i], HalfToFloat(halves[i])) << i;
+        }
+    }
+}
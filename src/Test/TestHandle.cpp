@@ -0,0 +1,118 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <stdexcept>
+#include <unordered_map>
+#include "../../include/Application/Handle.hpp"
+
+namespace lux
+{
+    struct HandleTestItem { int value = 0; };
+    struct HandleTestOther { int value = 0; };
+
+    template<> inline constexpr HandleType HandleTypeOf<HandleTestItem> = HandleType::USER;
+    template<> inline constexpr HandleType HandleTypeOf<HandleTestOther> = static_cast<HandleType>(9);
+
+    TEST(HandleTest, TaggedPointerPacksTagAndLowBits)
+    {
+        alignas(16) static uint64_t values[3] = {1, 0, 2};
+
+        TaggedPointer<uint64_t, 16> ptr {&values[0], 0xBEEF};
+        EXPECT_EQ(TaggedPointer<uint64_t>::LowBits, 3u);
+        EXPECT_EQ(ptr.GetUnderlying(), &values[0]);
+        EXPECT_EQ(ptr.GetTag(), 0xBEEF);
+        // 32-bit targets keep the tag next to the pointer
+        EXPECT_EQ(sizeof(ptr), TaggedPointer<uint64_t>::Packed ? sizeof(void*) : 2 * sizeof(void*));
+
+        ptr.SetLowBits(0xF);
+        ptr.SetUnderlying(&values[2]);
+        EXPECT_EQ(*ptr, 2u);
+        EXPECT_EQ(ptr.GetTag(), 0xBEEF);
+        EXPECT_EQ(ptr.GetLowBits(), 0xFu);
+
+        ptr.SetTag(7);
+        EXPECT_EQ(ptr.GetUnderlying(), &values[2]);
+        EXPECT_EQ(ptr.GetLowBits(), 0xFu);
+
+        // A tagged null still reads as null
+        TaggedPointer<uint64_t> null {nullptr, 42};
+        EXPECT_FALSE(null);
+        EXPECT_EQ(null.GetTag(), 42);
+    }
+
+    TEST(HandleTest, LayoutEncodesIndexGenerationAndType)
+    {
+        using Item = Handle<HandleTestItem>;
+        using Item64 = Handle64<HandleTestItem>;
+
+        static_assert(sizeof(Item) == 4 && sizeof(Item64) == 8);
+        static_assert(Item::MaxIndex == (1u << 20) - 1 && Item::MaxGeneration == 255);
+        static_assert(Item64::MaxIndex == UINT32_MAX && Item64::MaxGeneration == UINT16_MAX);
+        static_assert(MeshHandle::Type == HandleType::MESH && BufferHandle::Type == HandleType::BUFFER);
+
+        constexpr Item handle {12345, 200};
+        static_assert(handle.GetIndex() == 12345 && handle.GetGeneration() == 200);
+        static_assert(handle.GetType() == HandleType::USER);
+        static_assert(!handle.IsNull() && Item{}.IsNull());
+
+        constexpr Item64 wide {0xFFFFFFFF, 0xFFFF};
+        static_assert(wide.GetIndex() == 0xFFFFFFFF && wide.GetGeneration() == 0xFFFF);
+
+        // Values round-trip, but only into a handle of the same type
+        EXPECT_EQ(Item::FromValue(handle.GetValue()), handle);
+        EXPECT_TRUE(Handle<HandleTestOther>::FromValue(handle.GetValue()).IsNull());
+
+        std::unordered_map<Item, int> map;
+        map[handle] = 1;
+        EXPECT_EQ(map.at(Item::FromValue(handle.GetValue())), 1);
+    }
+
+    TEST(HandleTest, TableRejectsStaleHandles)
+    {
+        HandleTable<HandleTestItem> table;
+        HandleTestItem a {1}, b {2};
+
+        const auto first = table.Insert(&a);
+        EXPECT_EQ(table.Get(first), &a);
+        EXPECT_EQ(table.At(first).value, 1);
+        EXPECT_EQ(table.Get({}), nullptr);
+
+        EXPECT_TRUE(table.Remove(first));
+        EXPECT_FALSE(table.Remove(first));
+        EXPECT_TRUE(table.IsEmpty());
+
+        // The slot is reused under a new generation, the old handle stays dead
+        const auto second = table.Insert(&b);
+        EXPECT_EQ(second.GetIndex(), first.GetIndex());
+        EXPECT_NE(second.GetGeneration(), first.GetGeneration());
+        EXPECT_EQ(table.Get(first), nullptr);
+        EXPECT_THROW(static_cast<void>(table.At(first)), std::out_of_range);
+        EXPECT_EQ(table.Get(second), &b);
+
+        // Out of range indices never validate
+        EXPECT_EQ(table.Get(Handle<HandleTestItem>{99, 0}), nullptr);
+    }
+
+    TEST(HandleTest, TableRetiresSlotsBeforeTheGenerationWraps)
+    {
+        HandleTable<HandleTestItem> table;
+        HandleTestItem item;
+
+        const auto original = table.Insert(&item);
+        auto handle = original;
+        for (uint32_t i = 0; i < Handle<HandleTestItem>::MaxGeneration; ++i)
+        {
+            ASSERT_EQ(handle.GetIndex(), original.GetIndex());
+            table.Remove(handle);
+            handle = table.Insert(&item);
+        }
+
+        // Generation 255 is the last one, its slot is not handed out again
+        EXPECT_EQ(handle.GetGeneration(), Handle<HandleTestItem>::MaxGeneration);
+        table.Remove(handle);
+        const auto fresh = table.Insert(&item);
+        EXPECT_NE(fresh.GetIndex(), original.GetIndex());
+        EXPECT_EQ(table.GetSlotCount(), 2u);
+        EXPECT_EQ(table.Get(original), nullptr);
+        EXPECT_EQ(table.Get(handle), nullptr);
+    }
+}
@@ -0,0 +1,128 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "../../include/Math/Geometry/Intersection.hpp"
+
+namespace lux::math
+{
+    static Vector3f RandomVector(std::mt19937& rng, float extent)
+    {
+        std::uniform_real_distribution<float> dist {-extent, extent};
+        return Vector3f {dist(rng), dist(rng), dist(rng)};
+    }
+
+    TEST(IntersectionTest, RayHitsTriangleAtExpectedDistance)
+    {
+        Triangle triangle {Vector3f {-1.0f, -1.0f, -5.0f}, Vector3f {1.0f, -1.0f, -5.0f}, Vector3f {0.0f, 1.0f, -5.0f}};
+        Ray ray {Vector3f {0.0f, 0.0f, 0.0f}, Vector3f {0.0f, 0.0f, -1.0f}};
+
+        auto t = Intersect(ray, triangle);
+        ASSERT_TRUE(t.has_value());
+        EXPECT_NEAR(*t, 5.0f, 1e-6f);
+
+        // Behind the origin and beside the triangle
+        EXPECT_FALSE(Intersect(Ray {Vector3f {0.0f, 0.0f, -10.0f}, Vector3f {0.0f, 0.0f, -1.0f}}, triangle).has_value());
+        EXPECT_FALSE(Intersect(Ray {Vector3f {3.0f, 0.0f, 0.0f}, Vector3f {0.0f, 0.0f, -1.0f}}, triangle).has_value());
+    }
+
+    TEST(IntersectionTest, RayEntersBoxThroughNearFace)
+    {
+        AABB box {Vector3f {-1.0f, -1.0f, -1.0f}, Vector3f {1.0f, 1.0f, 1.0f}};
+
+        auto t = Intersect(Ray {Vector3f {-5.0f, 0.5f, 0.0f}, Vector3f {1.0f, 0.0f, 0.0f}}, box);
+        ASSERT_TRUE(t.has_value());
+        EXPECT_NEAR(*t, 4.0f, 1e-6f);
+
+        EXPECT_EQ(Intersect(Ray {Vector3f {0.0f, 0.0f, 0.0f}, Vector3f {0.0f, 1.0f, 0.0f}}, box), 0.0f);
+        EXPECT_FALSE(Intersect(Ray {Vector3f {-5.0f, 3.0f, 0.0f}, Vector3f {1.0f, 0.0f, 0.0f}}, box).has_value());
+        EXPECT_FALSE(Intersect(Ray {Vector3f {5.0f, 0.0f, 0.0f}, Vector3f {1.0f, 0.0f, 0.0f}}, box).has_value());
+    }
+
+    TEST(IntersectionTest, SpherePlaneAndCapsuleSphere)
+    {
+        Plane ground = Plane::FromPointNormal(Vector3f {0.0f, 2.0f, 0.0f}, Vector3f {0.0f, 3.0f, 0.0f});
+        EXPECT_TRUE(Intersects(Sphere {Vector3f {5.0f, 2.5f, 0.0f}, 1.0f}, ground));
+        EXPECT_FALSE(Intersects(Sphere {Vector3f {5.0f, 3.5f, 0.0f}, 1.0f}, ground));
+        EXPECT_FALSE(Intersects(Sphere {Vector3f {5.0f, 0.5f, 0.0f}, 1.0f}, ground));
+
+        Capsule capsule {Vector3f {0.0f, 0.0f, 0.0f}, Vector3f {0.0f, 4.0f, 0.0f}, 0.5f};
+        EXPECT_TRUE(Intersects(capsule, Sphere {Vector3f {1.0f, 2.0f, 0.0f}, 0.6f}));
+        EXPECT_FALSE(Intersects(capsule, Sphere {Vector3f {1.0f, 2.0f, 0.0f}, 0.4f}));
+        EXPECT_TRUE(Intersects(capsule, Sphere {Vector3f {0.0f, 5.0f, 0.0f}, 0.6f}));
+        EXPECT_FALSE(Intersects(capsule, Sphere {Vector3f {0.0f, -1.0f, 0.0f}, 0.4f}));
+    }
+
+    // Odd counts so every backend also runs its scalar tail
+    TEST(IntersectionTest, BatchedRayTestsMatchScalar)
+    {
+        std::mt19937 rng {11};
+        Ray ray {Vector3f {0.1f, 0.2f, 10.0f}, Vector3f {0.05f, -0.02f, -1.0f}};
+
+        std::vector<Triangle> triangles;
+        std::vector<AABB> boxes;
+        for (size_t i = 0; i < 37; ++i)
+        {
+            Vector3f center = RandomVector(rng, 2.0f);
+            triangles.push_back({center + RandomVector(rng, 2.0f), center + RandomVector(rng, 2.0f), center + RandomVector(rng, 2.0f)});
+
+            Vector3f extent = RandomVector(rng, 1.0f);
+            Vector3f half {std::abs(extent.GetX()), std::abs(extent.GetY()), std::abs(extent.GetZ())};
+            boxes.push_back({center - half, center + half});
+        }
+
+        std::vector<float> triangleDistances(triangles.size()), boxDistances(boxes.size());
+        size_t triangleHits = IntersectTriangles(ray, triangles, triangleDistances);
+        size_t boxHits = IntersectAABBs(ray, boxes, boxDistances);
+
+        size_t expectedTriangleHits = 0, expectedBoxHits = 0;
+        for (size_t i = 0; i < triangles.size(); ++i)
+        {
+            auto t = Intersect(ray, triangles[i]);
+            expectedTriangleHits += t.has_value();
+            if (t)
+                EXPECT_NEAR(triangleDistances[i], *t, 1e-4f);
+            else
+                EXPECT_TRUE(std::isinf(triangleDistances[i]));
+
+            auto b = Intersect(ray, boxes[i]);
+            expectedBoxHits += b.has_value();
+            if (b)
+                EXPECT_NEAR(boxDistances[i], *b, 1e-4f);
+            else
+                EXPECT_TRUE(std::isinf(boxDistances[i]));
+        }
+
+        EXPECT_EQ(triangleHits, expectedTriangleHits);
+        EXPECT_EQ(boxHits, expectedBoxHits);
+        EXPECT_GT(triangleHits, 0u);
+        EXPECT_GT(boxHits, 0u);
+    }
+
+    TEST(IntersectionTest, BatchedOverlapTestsMatchScalar)
+    {
+        std::mt19937 rng {12};
+        Plane plane = Plane::FromPointNormal(Vector3f {0.0f, 0.5f, 0.0f}, Vector3f {0.2f, 1.0f, -0.3f});
+        Capsule capsule {Vector3f {-2.0f, 0.0f, 0.0f}, Vector3f {2.0f, 1.0f, 0.0f}, 0.75f};
+
+        std::vector<Sphere> spheres;
+        for (size_t i = 0; i < 29; ++i)
+            spheres.push_back({RandomVector(rng, 4.0f), 0.25f + 0.05f * static_cast<float>(i)});
+
+        std::vector<uint8_t> planeHits(spheres.size()), capsuleHits(spheres.size());
+        size_t planeCount = IntersectSpheres(plane, spheres, planeHits);
+        size_t capsuleCount = IntersectSpheres(capsule, spheres, capsuleHits);
+
+        size_t expectedPlane = 0, expectedCapsule = 0;
+        for (size_t i = 0; i < spheres.size(); ++i)
+        {
+            EXPECT_EQ(planeHits[i], Intersects(spheres[i], plane));
+            EXPECT_EQ(capsuleHits[i], Intersects(capsule, spheres[i]));
+            expectedPlane += planeHits[i];
+            expectedCapsule += capsuleHits[i];
+        }
+
+        EXPECT_EQ(planeCount, expectedPlane);
+        EXPECT_EQ(capsuleCount, expectedCapsule);
+    }
+}
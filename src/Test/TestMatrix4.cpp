@@ -1,5 +1,5 @@
 #include <gtest/gtest.h>
-#include "../../include/Math/Matrix4.hpp"
+#include "../../include/Math/Matrix.hpp"
 
 namespace lux::math
 {
@@ -176,6 +176,9 @@ namespace lux::math
 
     TEST(Matrix4Test, AccessOutOfRange)
     {
+        if (!CheckedAccess)
+            GTEST_SKIP() << "Built with LUX_MATH_CHECKS=0";
+
         Matrix4<float> mat;
         EXPECT_THROW(mat[4][0], std::out_of_range);
         EXPECT_THROW(mat[0][4], std::out_of_range);
@@ -234,4 +237,164 @@ namespace lux::math
         ASSERT_EQ(mat_col, mat_row.Transpose());
     }
 
-}
\ No newline at end of file
+    static Matrix4<float> GeneralMatrix()
+    {
+        return Matrix4(4.0f, 7.0f, 2.0f, 3.0f,
+                       0.0f, 5.0f, 1.0f, 8.0f,
+                       6.0f, 2.0f, 9.0f, 1.0f,
+                       3.0f, 4.0f, 2.0f, 7.0f,
+                       MatOrder::ROW_MAJOR);
+    }
+
+    TEST(Matrix4Test, KernelMultiplicationMatchesScalar)
+    {
+        Matrix4<float> mat1 = GeneralMatrix();
+        Matrix4<float> mat2 = Matrix4<float>::Rotate(0.7f, Vector3f(1.0f, 2.0f, 3.0f)) * Matrix4<float>::Translate(Vector3f(1.0f, -2.0f, 5.0f));
+
+        Matrix4<float> result = mat1 * mat2;
+        float expected[16];
+        simd::scalar::Mat4Mul(mat1.Data(), mat2.Data(), expected);
+
+        for(int i = 0; i < 4; i++)
+            for(int j = 0; j < 4; j++)
+                EXPECT_NEAR(result[i][j], expected[i * 4 + j], 1e-4f);
+    }
+
+    TEST(Matrix4Test, KernelVectorMultiplicationMatchesScalar)
+    {
+        Matrix4<float> mat = GeneralMatrix();
+        Vector4 vec(1.5f, -2.0f, 0.25f, 1.0f);
+
+        Vector4<float> result = mat * vec;
+
+        EXPECT_FLOAT_EQ(result.GetX(), mat[0].Dot(vec));
+        EXPECT_FLOAT_EQ(result.GetY(), mat[1].Dot(vec));
+        EXPECT_FLOAT_EQ(result.GetZ(), mat[2].Dot(vec));
+        EXPECT_FLOAT_EQ(result.GetW(), mat[3].Dot(vec));
+    }
+
+    TEST(Matrix4Test, InverseGeneralMatrix)
+    {
+        Matrix4<float> mat = GeneralMatrix();
+        Matrix4<float> inverse = mat.Inverse();
+        Matrix4<float> product = mat * inverse;
+
+        float expected[16];
+        EXPECT_NEAR(simd::scalar::Mat4Inverse(mat.Data(), expected), mat.Determinant(), 1e-3f);
+
+        for(int i = 0; i < 4; i++)
+            for(int j = 0; j < 4; j++)
+            {
+                EXPECT_NEAR(inverse[i][j], expected[i * 4 + j], 1e-5f);
+                EXPECT_NEAR(product[i][j], i == j ? 1.0f : 0.0f, 1e-5f);
+            }
+    }
+
+    TEST(Matrix4Test, InverseSingularMatrixThrows)
+    {
+        Matrix4<float> singular(3.0f);
+        EXPECT_THROW((void)singular.Inverse(), std::runtime_error);
+    }
+
+    TEST(Matrix4Test, AssignmentKeepsInverseConsistent)
+    {
+        Matrix4<float> mat;
+        mat = GeneralMatrix();
+
+        Matrix4<float> product = mat * mat.Inverse();
+
+        for(int i = 0; i < 4; i++)
+            for(int j = 0; j < 4; j++)
+                EXPECT_NEAR(product[i][j], i == j ? 1.0f : 0.0f, 1e-5f);
+    }
+
+    TEST(Matrix4Test, PackedMatrixLayout)
+    {
+        Matrix4<float> mat = Matrix4<float>::Translate(Vector3f(1.0f, 2.0f, 3.0f)) * Matrix4<float>::Scale(2.0f);
+        PackedMatrix4f packed = PackedMatrix4f::From(mat);
+
+        for(int col = 0; col < 4; col++)
+            for(int row = 0; row < 4; row++)
+                EXPECT_EQ(packed(row, col), mat.GetCol(col)[row]);
+
+        EXPECT_FLOAT_EQ(packed.Determinant(), mat.Determinant());
+        EXPECT_EQ(packed.ToMatrix4(), mat);
+
+        std::vector<Matrix4f> matrices {mat, GeneralMatrix()};
+        std::vector<PackedMatrix4f> packedMatrices = PackMatrices(matrices);
+        std::vector<float> floats = MatricesAsFloatVector(matrices);
+
+        ASSERT_EQ(floats.size(), packedMatrices.size() * 16);
+        EXPECT_EQ(std::memcmp(floats.data(), packedMatrices.data(), floats.size() * sizeof(float)), 0);
+    }
+
+    static void ExpectMatrixNear(const Matrix4<float>& actual, const Matrix4<float>& expected)
+    {
+        for(size_t i = 0; i < 4; i++)
+            for(size_t j = 0; j < 4; j++)
+                EXPECT_NEAR(actual.At(i, j), expected.At(i, j), 1e-5f);
+    }
+
+    TEST(Matrix4Test, ShapeTagPropagation)
+    {
+        Matrix4<float> rigid = Matrix4<float>::Translate(Vector3f(1.0f, 2.0f, 3.0f)) *
+                               Matrix4<float>::Rotate(0.4f, Vector3f(0.0f, 1.0f, 0.0f));
+        Matrix4<float> affine = rigid * Matrix4<float>::Scale(2.0f);
+
+        EXPECT_EQ(rigid.GetShape(), MatShape::RIGID);
+        EXPECT_EQ(rigid.Transpose().GetShape(), MatShape::RIGID);
+        EXPECT_EQ(affine.GetShape(), MatShape::AFFINE);
+        EXPECT_EQ(Matrix4<float>::Perspective(60.0f, 1.5f, 0.1f, 100.0f).GetShape(), MatShape::GENERAL);
+        EXPECT_EQ((affine * GeneralMatrix()).GetShape(), MatShape::GENERAL);
+
+        affine[0][0] = 5.0f;
+        EXPECT_EQ(affine.GetShape(), MatShape::GENERAL);
+    }
+
+    TEST(Matrix4Test, ProductShapeFollowsTranslationLayout)
+    {
+        // Translate() keeps its translation in the last column, the transposed product in the last row
+        const Matrix4<float> column = Matrix4<float>::Translate(Vector3f(1.0f, 2.0f, 3.0f));
+        const Matrix4<float> row = column * Matrix4<float>::Rotate(0.4f, Vector3f(0.0f, 1.0f, 0.0f));
+        ASSERT_EQ(row.GetShape(), MatShape::RIGID);
+
+        // Same layout: the product is affine and the fast inverse is exact
+        const Matrix4<float> same = row * row;
+        EXPECT_EQ(same.GetShape(), MatShape::RIGID);
+        ExpectMatrixNear(same.Inverse(), same.WithShape(MatShape::GENERAL).Inverse());
+
+        // A factor without translation fits either layout
+        EXPECT_EQ((column * Matrix4<float>::Scale(2.0f)).GetShape(), MatShape::AFFINE);
+        EXPECT_EQ((row * Matrix4<float>::Scale(2.0f)).GetShape(), MatShape::AFFINE);
+
+        // Mixed layouts are affine in neither, so the tag must not promise it
+        const Matrix4<float> mixed = row * Matrix4<float>::Translate(Vector3f(-4.0f, 0.5f, 2.0f));
+        EXPECT_EQ(mixed.GetShape(), MatShape::GENERAL);
+        EXPECT_EQ((Matrix4<float>::Translate(Vector3f(1.0f, 0.0f, 0.0f)) * row).GetShape(), MatShape::GENERAL);
+    }
+
+    TEST(Matrix4Test, InverseAffineMatchesGeneralInverse)
+    {
+        Matrix4<float> model = Matrix4<float>::Translate(Vector3f(1.0f, -2.0f, 3.0f)) *
+                               Matrix4<float>::Rotate(0.7f, Vector3f(1.0f, 1.0f, 0.0f)) *
+                               Matrix4<float>::Scale(Vector3f(2.0f, 0.5f, 3.0f));
+
+        ExpectMatrixNear(model.InverseAffine(), model.WithShape(MatShape::GENERAL).Inverse());
+        ExpectMatrixNear(model.Transpose().InverseAffine(), model.Transpose().WithShape(MatShape::GENERAL).Inverse());
+        EXPECT_THROW((void)Matrix4<float>::Scale(0.0f).Inverse(), std::runtime_error);
+    }
+
+    TEST(Matrix4Test, InverseRigidMatchesGeneralInverse)
+    {
+        Matrix4<float> view = Matrix4<float>::LookAt(Vector3f(3.0f, 2.0f, 5.0f), Vector3f(0.0f, 0.0f, 0.0f),
+                                                     Vector3f(0.0f, 1.0f, 0.0f));
+
+        ExpectMatrixNear(view.Inverse(), view.WithShape(MatShape::GENERAL).Inverse());
+        ExpectMatrixNear(view.Transpose().Inverse(), view.Transpose().WithShape(MatShape::GENERAL).Inverse());
+        EXPECT_EQ(view.Inverse().GetShape(), MatShape::RIGID);
+
+        // Not affine in either layout: the fast paths fall back to the full inverse
+        ExpectMatrixNear(GeneralMatrix().InverseRigid(), GeneralMatrix().Inverse());
+    }
+
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <vector>
+#include "../../include/Memory/MemoryTracker.hpp"
+#include "../../include/Memory/ArenaAllocator.hpp"
+#include "../../include/Memory/PoolAllocator.hpp"
+#include "../../include/Memory/SlabAllocator.hpp"
+
+namespace lux
+{
+    // The counters are process wide, the tests compare against a snapshot taken before
+    static uint64_t Live(MemoryTag tag) { return MemoryTracker::GetSnapshot()[tag].liveBytes; }
+
+    TEST(MemoryTrackerTest, TracksLiveBytesAndPeak)
+    {
+        const MemoryTagStats before = MemoryTracker::GetSnapshot()[MemoryTag::SHADER];
+
+        MemoryTracker::OnAllocate(MemoryTag::SHADER, 1000);
+        MemoryTracker::OnAllocate(MemoryTag::SHADER, 500);
+        MemoryTracker::OnFree(MemoryTag::SHADER, 1000);
+
+        const MemoryTagStats after = MemoryTracker::GetSnapshot()[MemoryTag::SHADER];
+        EXPECT_EQ(after.liveBytes, before.liveBytes + 500);
+        EXPECT_GE(after.peakBytes, before.liveBytes + 1500);
+        EXPECT_EQ(after.allocations, before.allocations + 2);
+        EXPECT_EQ(after.GetLiveAllocations(), before.GetLiveAllocations() + 1);
+        EXPECT_EQ(after.allocatedBytes, before.allocatedBytes + 1500);
+
+        MemoryTracker::OnFree(MemoryTag::SHADER, 500);
+        MemoryTracker::ResetPeaks();
+        EXPECT_EQ(MemoryTracker::GetSnapshot()[MemoryTag::SHADER].peakBytes, before.liveBytes);
+    }
+
+    TEST(MemoryTrackerTest, EngineAllocatorsReportTheirTag)
+    {
+        const uint64_t mesh = Live(MemoryTag::MESH);
+        const uint64_t event = Live(MemoryTag::EVENT);
+        const uint64_t scene = Live(MemoryTag::SCENE);
+
+        {
+            Arena arena {4096, MemoryTag::MESH};
+            static_cast<void>(arena.Allocate(3000));
+            static_cast<void>(arena.Allocate(3000));
+            EXPECT_GE(Live(MemoryTag::MESH), mesh + arena.GetReservedBytes());
+
+            PoolAllocator pool {PageSize, 64, MemoryTag::EVENT};
+            pool.Free(pool.Allocate());
+            EXPECT_EQ(Live(MemoryTag::EVENT), event + pool.GetSlabCount() * pool.GetPoolSize());
+
+            SlabAllocator slabs {MemoryTag::SCENE};
+            void* small = slabs.Allocate(64);
+            void* large = slabs.Allocate(100000);
+            EXPECT_EQ(Live(MemoryTag::SCENE), scene + slabs.GetStats().reservedBytes);
+
+            slabs.Free(large);
+            slabs.Free(small);
+            EXPECT_EQ(Live(MemoryTag::SCENE), scene + slabs.GetStats().slabCount * SlabAllocator::SlabSize);
+        }
+
+        EXPECT_EQ(Live(MemoryTag::MESH), mesh);
+        EXPECT_EQ(Live(MemoryTag::EVENT), event);
+        EXPECT_EQ(Live(MemoryTag::SCENE), scene);
+    }
+
+    TEST(MemoryTrackerTest, TaggedResourceBacksPmrContainers)
+    {
+        const uint64_t mesh = Live(MemoryTag::MESH);
+        std::pmr::memory_resource* resource = GetTaggedResource(MemoryTag::MESH);
+        EXPECT_EQ(resource, GetTaggedResource(MemoryTag::MESH));
+        EXPECT_FALSE(resource->is_equal(*GetTaggedResource(MemoryTag::TEXTURE)));
+
+        {
+            std::pmr::vector<float> vertices {resource};
+            vertices.reserve(1000);
+            EXPECT_EQ(Live(MemoryTag::MESH), mesh + 1000 * sizeof(float));
+
+            // Same resource on both sides: the storage moves, nothing is copied or counted twice
+            const float* data = vertices.data();
+            std::pmr::vector<float> moved {resource};
+            moved = std::move(vertices);
+            EXPECT_EQ(moved.data(), data);
+            EXPECT_EQ(Live(MemoryTag::MESH), mesh + 1000 * sizeof(float));
+        }
+
+        EXPECT_EQ(Live(MemoryTag::MESH), mesh);
+    }
+
+    TEST(MemoryTrackerTest, EndFrameComputesRates)
+    {
+        // Times far ahead of anything else in the process so the windows below are exact
+        MemoryTracker::EndFrame(1000.0);
+        MemoryTracker::EndFrame(1001.0);
+        const uint64_t frame = MemoryTracker::GetSnapshot().frame;
+
+        for (int i = 0; i < 10; ++i)
+            MemoryTracker::OnAllocate(MemoryTag::TEMP, 64);
+        MemoryTracker::EndFrame(1002.0);
+
+        MemorySnapshot snapshot = MemoryTracker::GetSnapshot();
+        EXPECT_EQ(snapshot.frame, frame + 1);
+        EXPECT_DOUBLE_EQ(snapshot[MemoryTag::TEMP].allocationsPerSecond, 10.0);
+        EXPECT_DOUBLE_EQ(snapshot[MemoryTag::TEMP].bytesPerSecond, 640.0);
+
+        for (int i = 0; i < 10; ++i)
+            MemoryTracker::OnFree(MemoryTag::TEMP, 64);
+
+        // A frame shorter than the window keeps the previous rates
+        MemoryTracker::SetDumpInterval(0.5);
+        MemoryTracker::EndFrame(1002.5);
+        EXPECT_DOUBLE_EQ(MemoryTracker::GetSnapshot()[MemoryTag::TEMP].allocationsPerSecond, 10.0);
+        MemoryTracker::SetDumpInterval(0.0);
+    }
+
+    TEST(MemoryTrackerTest, CountsHeapAllocationsPerFrame)
+    {
+        if (!MemoryTracker::GetSnapshot().heapHookInstalled)
+            GTEST_SKIP() << "LUX_MEMORY_HOOK is off";
+
+        MemoryTracker::EndFrame(2000.0);
+
+        std::vector<std::unique_ptr<int>> values;
+        values.reserve(100);
+        for (int i = 0; i < 100; ++i)
+            values.push_back(std::make_unique<int>(i));
+        MemoryTracker::EndFrame(2000.1);
+
+        const MemorySnapshot snapshot = MemoryTracker::GetSnapshot();
+        EXPECT_GE(snapshot.heapAllocationsLastFrame, 101u);
+        EXPECT_GE(snapshot.heapAllocationsPeakFrame, snapshot.heapAllocationsLastFrame);
+    }
+
+    TEST(MemoryTrackerTest, HeapHookCallsTheNewHandler)
+    {
+        if (!MemoryTracker::GetSnapshot().heapHookInstalled)
+            GTEST_SKIP() << "LUX_MEMORY_HOOK is off";
+#if defined(__SANITIZE_ADDRESS__)
+        GTEST_SKIP() << "AddressSanitizer aborts on the oversized request";
+#endif
+
+        // A handler with nothing left to free uninstalls itself, the next failure then throws
+        static int calls = 0;
+        calls = 0;
+        std::set_new_handler([] { ++calls; std::set_new_handler(nullptr); });
+
+        volatile size_t huge = std::numeric_limits<size_t>::max() / 2;
+        EXPECT_THROW(operator delete(operator new(huge)), std::bad_alloc);
+        EXPECT_EQ(calls, 1);
+    }
+}
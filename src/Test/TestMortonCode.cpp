@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <numeric>
+#include <random>
+#include <vector>
+#include "../../include/Utils/MortonCode.hpp"
+
+namespace lux
+{
+    // Bit by bit interleave, axis a of bit i lands at bit i * axes + a
+    template<typename Code>
+    static Code ReferenceEncode(std::initializer_list<uint32_t> coordinates)
+    {
+        const auto axes = static_cast<uint32_t>(coordinates.size());
+        const uint32_t bits = (sizeof(Code) * 8) / axes;
+        Code code = 0;
+        uint32_t axis = 0;
+        for (uint32_t value : coordinates)
+        {
+            for (uint32_t bit = 0; bit < bits; ++bit)
+                code |= static_cast<Code>((static_cast<Code>(value) >> bit) & 1u) << (bit * axes + axis);
+            ++axis;
+        }
+        return code;
+    }
+
+    TEST(MortonCodeTest, EncodeMatchesReferenceAndRoundTrips)
+    {
+        std::mt19937 rng{8};
+        std::uniform_int_distribution<uint32_t> dist;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            const uint32_t x = dist(rng), y = dist(rng), z = dist(rng);
+
+            EXPECT_EQ(MortonEncode2D<uint32_t>(x & 0xFFFFu, y & 0xFFFFu), ReferenceEncode<uint32_t>({x, y}));
+            EXPECT_EQ(MortonEncode2D<uint64_t>(x, y), ReferenceEncode<uint64_t>({x, y}));
+            EXPECT_EQ(MortonEncode3D<uint32_t>(x & 0x3FFu, y & 0x3FFu, z & 0x3FFu), ReferenceEncode<uint32_t>({x, y, z}));
+            EXPECT_EQ(MortonEncode3D<uint64_t>(x & 0x1FFFFFu, y & 0x1FFFFFu, z & 0x1FFFFFu), ReferenceEncode<uint64_t>({x, y, z}));
+
+            EXPECT_EQ(MortonDecode2D(MortonEncode2D<uint32_t>(x & 0xFFFFu, y & 0xFFFFu)), (std::array{x & 0xFFFFu, y & 0xFFFFu}));
+            EXPECT_EQ(MortonDecode2D(MortonEncode2D<uint64_t>(x, y)), (std::array{x, y}));
+            EXPECT_EQ(MortonDecode3D(MortonEncode3D<uint32_t>(x, y, z)), (std::array{x & 0x3FFu, y & 0x3FFu, z & 0x3FFu}));
+            EXPECT_EQ(MortonDecode3D(MortonEncode3D<uint64_t>(x, y, z)), (std::array{x & 0x1FFFFFu, y & 0x1FFFFFu, z & 0x1FFFFFu}));
+        }
+    }
+
+    // The shift and mask fallback is tested directly so BMI2 builds cover it too
+    TEST(MortonCodeTest, MagicBitsMatchReference)
+    {
+        std::mt19937 rng{9};
+        std::uniform_int_distribution<uint32_t> dist;
+
+        for (int i = 0; i < 1000; ++i)
+        {
+            const uint32_t x = dist(rng);
+            EXPECT_EQ(detail::Part1By1(x & 0xFFFFu), ReferenceEncode<uint32_t>({x, 0}));
+            EXPECT_EQ(detail::Part1By1(uint64_t{x}), ReferenceEncode<uint64_t>({x, 0}));
+            EXPECT_EQ(detail::Part1By2(x & 0x3FFu), ReferenceEncode<uint32_t>({x, 0, 0}));
+            EXPECT_EQ(detail::Part1By2(uint64_t{x & 0x1FFFFFu}), ReferenceEncode<uint64_t>({x, 0, 0}));
+
+            EXPECT_EQ(detail::Compact1By1(detail::Part1By1(x & 0xFFFFu)), x & 0xFFFFu);
+            EXPECT_EQ(detail::Compact1By1(detail::Part1By1(uint64_t{x})), x);
+            EXPECT_EQ(detail::Compact1By2(detail::Part1By2(x & 0x3FFu)), x & 0x3FFu);
+            EXPECT_EQ(detail::Compact1By2(detail::Part1By2(uint64_t{x & 0x1FFFFFu})), x & 0x1FFFFFu);
+        }
+    }
+
+    TEST(MortonCodeTest, OrderSortsPositionsByKey)
+    {
+        std::mt19937 rng{10};
+        std::uniform_real_distribution<float> dist{-100.0f, 100.0f};
+
+        std::vector<math::Vector3f> positions(5000);
+        for (auto& position : positions)
+            position = math::Vector3f{dist(rng), dist(rng), dist(rng)};
+
+        const math::AABB bounds = math::AABB::FromPoints(positions);
+        std::vector<uint64_t> keys(positions.size());
+        ComputeMortonKeys(positions, bounds, keys);
+
+        std::vector<uint32_t> order(positions.size());
+        MortonOrder(positions, order);
+
+        std::vector<uint32_t> sorted = order;
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<uint32_t> identity(positions.size());
+        std::iota(identity.begin(), identity.end(), 0u);
+        ASSERT_EQ(sorted, identity);
+
+        for (size_t i = 1; i < order.size(); ++i)
+            ASSERT_LE(keys[order[i - 1]], keys[order[i]]);
+
+        EXPECT_EQ(keys[order.front()], *std::min_element(keys.begin(), keys.end()));
+        EXPECT_EQ(keys[order.back()], *std::max_element(keys.begin(), keys.end()));
+    }
+}
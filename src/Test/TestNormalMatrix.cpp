@@ -0,0 +1,78 @@
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+#include "../../include/Math/NormalMatrix.hpp"
+
+namespace lux::math
+{
+    // Odd count so every backend also runs its padded tail
+    static std::vector<Matrix4f> RandomAffineMatrices(size_t count)
+    {
+        std::mt19937 rng {11};
+        std::uniform_real_distribution<float> dist {-1.0f, 1.0f};
+        std::uniform_real_distribution<float> scale {0.2f, 3.0f};
+
+        std::vector<Matrix4f> models;
+        for (size_t i = 0; i < count; ++i)
+        {
+            const Vector3f s {scale(rng), scale(rng), i % 4 == 0 ? -scale(rng) : scale(rng)};
+            models.push_back(Matrix4f::Translate(Vector3f(dist(rng), dist(rng), dist(rng)) * 10.0f) *
+                             Matrix4f::Rotate(dist(rng) * 3.0f, Vector3f(dist(rng), dist(rng), dist(rng) + 1.5f)) *
+                             Matrix4f::Scale(s));
+        }
+        return models;
+    }
+
+    TEST(NormalMatrixTest, MatchesInverseTranspose)
+    {
+        const std::vector<Matrix4f> models = RandomAffineMatrices(37);
+
+        std::vector<PackedNormalMatrix> normals(models.size());
+        ComputeNormalMatrices(std::span<const Matrix4f>{models}, normals);
+
+        for (size_t i = 0; i < models.size(); ++i)
+        {
+            const Matrix4f inverse = models[i].Inverse();
+            for (size_t r = 0; r < 3; ++r)
+            {
+                for (size_t c = 0; c < 3; ++c)
+                    EXPECT_NEAR(normals[i](r, c), inverse.At(c, r), 1e-4f) << i << " " << r << " " << c;
+
+                EXPECT_EQ(normals[i].data[r * 4 + 3], 0.0f);
+            }
+        }
+    }
+
+    TEST(NormalMatrixTest, PackedInputMatchesMatrix4)
+    {
+        const std::vector<Matrix4f> models = RandomAffineMatrices(21);
+
+        std::vector<PackedMatrix4f> packed;
+        for (const Matrix4f& m : models)
+            packed.push_back(PackedMatrix4f::From(m));
+
+        std::vector<PackedNormalMatrix> fromRows(models.size());
+        ComputeNormalMatrices(std::span<const Matrix4f>{models}, fromRows);
+
+        EXPECT_EQ(ComputeNormalMatrices(packed), fromRows);
+    }
+
+    TEST(NormalMatrixTest, RotationAndSingularCases)
+    {
+        const Matrix4f rotation = Matrix4f::Rotate(0.9f, Vector3f(1.0f, 2.0f, -0.5f));
+        const std::vector<PackedMatrix4f> models {PackedMatrix4f::From(rotation),
+                                                  PackedMatrix4f::From(rotation * Matrix4f::Scale(2.0f)),
+                                                  PackedMatrix4f::From(Matrix4f::Scale(Vector3f(1.0f, 0.0f, 1.0f)))};
+
+        const std::vector<PackedNormalMatrix> normals = ComputeNormalMatrices(models);
+
+        // A rotation is its own normal matrix, scaling it by s makes the normal matrix the rotation over s
+        for (size_t r = 0; r < 3; ++r)
+            for (size_t c = 0; c < 3; ++c)
+            {
+                EXPECT_NEAR(normals[0](r, c), models[0](r, c), 1e-6f);
+                EXPECT_NEAR(normals[1](r, c), models[1](r, c) * 0.25f, 1e-6f);
+                EXPECT_EQ(normals[2](r, c), 0.0f);
+            }
+    }
+}
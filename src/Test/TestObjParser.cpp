@@ -0,0 +1,60 @@
+#include <gtest/gtest.h>
+#include <filesystem>
+#include <fstream>
+#include "../../include/Memory/ArenaAllocator.hpp"
+#include "../../include/Renderer/Mesh/MeshParsers/ObjParser.hpp"
+#include "../../include/FileSystem/FileSystem.hpp"
+
+namespace lux
+{
+    static std::filesystem::path WriteQuadObj()
+    {
+        const auto path = std::filesystem::temp_directory_path() / "lux_test_quad.obj";
+        std::ofstream file {path};
+        file << "o quad\n"
+             << "v -1.0 -1.0 0.0\nv 1.0 -1.0 0.0\nv 1.0 1.0 0.0\nv -1.0 1.0 0.0\n"
+             << "vt 0.0 0.0\nvt 1.0 0.0\nvt 1.0 1.0\nvt 0.0 1.0\n"
+             << "vn 0.0 0.0 1.0\n"
+             << "f 1/1/1 2/2/1 3/3/1 4/4/1\n";
+        return path;
+    }
+
+    TEST(ObjParserTest, SplitWithResource)
+    {
+        Arena arena;
+        ArenaResource resource {arena};
+
+        const auto tokens = FileSystem::Split("f 1/1/1 2/2/1 3/3/1", " ", &resource);
+        ASSERT_EQ(tokens.size(), 4u);
+        EXPECT_EQ(tokens[2], "2/2/1");
+        EXPECT_EQ(tokens.get_allocator().resource(), &resource);
+        EXPECT_EQ(FileSystem::Split("a//b", "/"), (std::vector<std::string>{"a", "", "b"}));
+    }
+
+    TEST(ObjParserTest, ArenaScratchMatchesHeap)
+    {
+        const auto path = WriteQuadObj();
+
+        OBJParser heapParser;
+        const MeshData expected = heapParser.ParseMesh(path);
+
+        // A quad is two triangles sharing two corners
+        EXPECT_EQ(expected.indices, (std::pmr::vector<uint32_t>{0, 1, 2, 0, 2, 3}));
+        EXPECT_EQ(expected.vertices.size(), 4u * 8u);
+
+        Arena arena {4096};
+        ArenaResource scratch {arena};
+        OBJParser parser {&scratch};
+        for (int run = 0; run < 3; ++run)
+        {
+            const MeshData mesh = parser.ParseMesh(path);
+            EXPECT_EQ(mesh, expected);
+            EXPECT_EQ(mesh.vertices.get_allocator().resource(), std::pmr::get_default_resource());
+
+            // The parser keeps nothing in scratch memory between parses
+            arena.Reset();
+        }
+
+        std::filesystem::remove(path);
+    }
+}
@@ -0,0 +1,126 @@
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdint>
+#include <list>
+#include <memory_resource>
+#include <set>
+#include <thread>
+#include <vector>
+#include "../../include/Memory/PoolAllocator.hpp"
+
+namespace lux
+{
+    TEST(PoolAllocatorTest, ChunksAreDistinctAndAligned)
+    {
+        PoolAllocator pool {PageSize, 40};
+        EXPECT_EQ(pool.GetChunkSize(), 48u);
+
+        std::set<void*> chunks;
+        for (size_t i = 0; i < 3 * pool.GetChunksPerSlab(); ++i)
+        {
+            void* chunk = pool.Allocate();
+            EXPECT_TRUE(IsAligned(chunk, PoolAllocator::ChunkAlignment));
+            EXPECT_TRUE(pool.Owns(chunk));
+            EXPECT_TRUE(chunks.insert(chunk).second);
+        }
+
+        // The thread's magazine may have pulled part of a further slab
+        const size_t slabs = pool.GetSlabCount();
+        EXPECT_GE(slabs, 3u);
+
+        for (void* chunk : chunks)
+            pool.Free(chunk);
+
+        // Freed chunks are reused, no new slab
+        for (size_t i = 0; i < chunks.size(); ++i)
+            EXPECT_TRUE(pool.Owns(pool.Allocate()));
+
+        EXPECT_EQ(pool.GetSlabCount(), slabs);
+    }
+
+    TEST(PoolAllocatorTest, NewAndDelete)
+    {
+        struct Node
+        {
+            explicit Node(int value) : m_value{value} {}
+            int m_value;
+            Node* m_next = nullptr;
+        };
+
+        PoolAllocator pool {PageSize, sizeof(Node)};
+
+        Node* head = nullptr;
+        for (int i = 0; i < 1000; ++i)
+        {
+            Node* node = pool.New<Node>(i);
+            node->m_next = head;
+            head = node;
+        }
+
+        int expected = 999;
+        while (head)
+        {
+            EXPECT_EQ(head->m_value, expected--);
+            Node* next = head->m_next;
+            pool.Delete(head);
+            head = next;
+        }
+    }
+
+    TEST(PoolAllocatorTest, CrossThreadFrees)
+    {
+        PoolAllocator pool {PageSize, 32};
+        constexpr size_t PerThread = 20000;
+
+        // Producers allocate, the main thread frees everything; chunks must never be handed out twice
+        std::vector<std::vector<void*>> produced(4);
+        std::vector<std::thread> threads;
+        for (auto& out : produced)
+            threads.emplace_back([&pool, &out]
+            {
+                for (size_t i = 0; i < PerThread; ++i)
+                {
+                    out.push_back(pool.Allocate());
+                    if (i % 3 == 0)
+                    {
+                        pool.Free(out.back());
+                        out.pop_back();
+                    }
+                }
+            });
+
+        for (auto& thread : threads)
+            thread.join();
+
+        std::vector<void*> all;
+        for (auto& out : produced)
+            all.insert(all.end(), out.begin(), out.end());
+
+        std::sort(all.begin(), all.end());
+        EXPECT_EQ(std::adjacent_find(all.begin(), all.end()), all.end());
+
+        for (void* chunk : all)
+            pool.Free(chunk);
+    }
+
+    TEST(PoolAllocatorTest, MemoryResource)
+    {
+        PoolAllocator pool {PageSize, 64};
+        PoolResource resource {pool};
+
+        // List nodes fit a chunk, so the list runs on the pool
+        std::pmr::list<int> list {&resource};
+        for (int i = 0; i < 500; ++i)
+            list.push_back(i);
+
+        EXPECT_EQ(list.size(), 500u);
+        EXPECT_TRUE(pool.Owns(&list.back()));
+
+        // A growing vector outgrows the chunk and falls back to upstream
+        std::pmr::vector<int> vector {&resource};
+        vector.resize(1000, 7);
+        EXPECT_FALSE(pool.Owns(vector.data()));
+
+        EXPECT_TRUE(resource.is_equal(PoolResource{pool}));
+    }
+}
@@ -0,0 +1,153 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "../../include/Math/Quatf.hpp"
+
+namespace lux::math
+{
+    static std::vector<Quatf> RandomRotations(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {-1.0f, 1.0f};
+
+        std::vector<Quatf> rotations;
+        for (size_t i = 0; i < count; ++i)
+            rotations.push_back(Quatf {dist(rng), dist(rng), dist(rng), dist(rng)}.Normalize());
+        return rotations;
+    }
+
+    // Reference slerp with acos and sin, in double
+    static Quatf ReferenceSlerp(const Quatf& a, Quatf b, float t)
+    {
+        double dot = a.Dot(b);
+        if (dot < 0.0)
+        {
+            b = Quatf {-b.GetX(), -b.GetY(), -b.GetZ(), -b.GetW()};
+            dot = -dot;
+        }
+
+        double angle = std::acos(std::min(dot, 1.0));
+        double f0 = 1.0 - t, f1 = t;
+        if (angle > 1e-6)
+        {
+            f0 = std::sin((1.0 - t) * angle) / std::sin(angle);
+            f1 = std::sin(t * angle) / std::sin(angle);
+        }
+
+        return {static_cast<float>(f0 * a.GetX() + f1 * b.GetX()), static_cast<float>(f0 * a.GetY() + f1 * b.GetY()),
+                static_cast<float>(f0 * a.GetZ() + f1 * b.GetZ()), static_cast<float>(f0 * a.GetW() + f1 * b.GetW())};
+    }
+
+    static void ExpectNear(const Quatf& actual, const Quatf& expected, float eps = 1e-5f)
+    {
+        EXPECT_NEAR(actual.GetX(), expected.GetX(), eps);
+        EXPECT_NEAR(actual.GetY(), expected.GetY(), eps);
+        EXPECT_NEAR(actual.GetZ(), expected.GetZ(), eps);
+        EXPECT_NEAR(actual.GetW(), expected.GetW(), eps);
+    }
+
+    static void ExpectNear(const Vector3f& actual, const Vector3f& expected)
+    {
+        EXPECT_NEAR(actual.GetX(), expected.GetX(), 1e-4f);
+        EXPECT_NEAR(actual.GetY(), expected.GetY(), 1e-4f);
+        EXPECT_NEAR(actual.GetZ(), expected.GetZ(), 1e-4f);
+    }
+
+    TEST(QuatfTest, MultiplyMatchesQuaternionTemplate)
+    {
+        auto q = RandomRotations(2, 3);
+        Quatf expected {q[0].ToQuaternion() * q[1].ToQuaternion()};
+
+        ExpectNear(q[0] * q[1], expected);
+    }
+
+    TEST(QuatfTest, RotateMatchesMatrixRotate)
+    {
+        const Vector3f axis {0.3f, 1.0f, -0.5f};
+        Quatf q = Quatf::FromAxisAngle(0.7f, axis);
+        Matrix4f m = Matrix4f::Rotate(0.7f, axis);
+        Vector3f v {2.0f, -3.0f, 4.0f};
+
+        Vector4f expected = m * Vector4f(v, 0.0f);
+        ExpectNear(q.Rotate(v), Vector3f {expected[0], expected[1], expected[2]});
+
+        Matrix4f fromQuat = q.ToMatrix4();
+        Vector4f actual = fromQuat * Vector4f(v, 0.0f);
+        ExpectNear(Vector3f {actual[0], actual[1], actual[2]}, Vector3f {expected[0], expected[1], expected[2]});
+        EXPECT_EQ(fromQuat.GetShape(), MatShape::RIGID);
+    }
+
+    TEST(QuatfTest, SlerpMatchesReference)
+    {
+        auto a = RandomRotations(16, 5);
+        auto b = RandomRotations(16, 6);
+
+        for (size_t i = 0; i < a.size(); ++i)
+            for (float t : {0.0f, 0.25f, 0.5f, 0.9f, 1.0f})
+                ExpectNear(Slerp(a[i], b[i], t), ReferenceSlerp(a[i], b[i], t), 5e-5f);
+
+        // Endpoints are exact, including the shortest arc flip
+        ExpectNear(Slerp(a[0], b[0], 0.0f), a[0], 1e-6f);
+    }
+
+    TEST(QuatfTest, NlerpTakesShortestArc)
+    {
+        Quatf a = Quatf::FromAxisAngle(0.2f, Vector3f {0.0f, 1.0f, 0.0f});
+        Quatf b = Quatf::FromAxisAngle(0.6f, Vector3f {0.0f, 1.0f, 0.0f});
+        Quatf negB {-b.GetX(), -b.GetY(), -b.GetZ(), -b.GetW()};
+
+        Quatf r = Nlerp(a, negB, 0.5f);
+        ExpectNear(r, Quatf::FromAxisAngle(0.4f, Vector3f {0.0f, 1.0f, 0.0f}));
+        EXPECT_NEAR(r.Length(), 1.0f, 1e-6f);
+    }
+
+    // Odd counts so every backend also runs its scalar tail
+    TEST(QuatfTest, BatchOperationsMatchSingle)
+    {
+        constexpr size_t count = 21;
+        auto a = RandomRotations(count, 7);
+        auto b = RandomRotations(count, 8);
+
+        std::vector<float> t(count);
+        std::vector<Vector3f> v;
+        for (size_t i = 0; i < count; ++i)
+        {
+            t[i] = static_cast<float>(i) / count;
+            v.emplace_back(static_cast<float>(i), 1.0f - i * 0.5f, 2.0f);
+        }
+
+        std::vector<Quatf> product(count), nlerp(count), slerp(count), slerpUniform(count);
+        std::vector<Vector3f> rotated(count);
+
+        Multiply(a, b, product);
+        Nlerp(a, b, t, nlerp);
+        Slerp(a, b, t, slerp);
+        Slerp(a, b, 0.3f, slerpUniform);
+        Rotate(a, v, rotated);
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            ExpectNear(product[i], a[i] * b[i]);
+            ExpectNear(nlerp[i], Nlerp(a[i], b[i], t[i]));
+            ExpectNear(slerp[i], Slerp(a[i], b[i], t[i]));
+            ExpectNear(slerpUniform[i], Slerp(a[i], b[i], 0.3f));
+            ExpectNear(rotated[i], a[i].Rotate(v[i]));
+        }
+    }
+
+    TEST(QuatfTest, BatchMatricesMatchSingle)
+    {
+        auto q = RandomRotations(13, 9);
+        std::vector<PackedMatrix4f> packed(q.size());
+
+        ToMatrices(q, packed);
+
+        for (size_t i = 0; i < q.size(); ++i)
+        {
+            PackedMatrix4f expected = PackedMatrix4f::From(q[i].ToMatrix4());
+            for (size_t k = 0; k < 16; ++k)
+                EXPECT_NEAR(packed[i].data[k], expected.data[k], 1e-6f);
+        }
+    }
+}
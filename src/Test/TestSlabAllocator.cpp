@@ -0,0 +1,191 @@
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../../include/Memory/SlabAllocator.hpp"
+#include "../../include/Application/Pointers.hpp"
+
+namespace lux
+{
+    TEST(SlabAllocatorTest, SizeClassesCoverEverySmallSize)
+    {
+        EXPECT_EQ(SlabAllocator::ClassSize(SlabAllocator::SizeClassOf(1)), 16u);
+        EXPECT_EQ(SlabAllocator::ClassSize(SlabAllocator::SizeClassOf(129)), 160u);
+        EXPECT_EQ(SlabAllocator::SizeClassOf(SlabAllocator::MaxSmallSize), SlabAllocator::ClassCount - 1);
+
+        for (size_t size = 1; size <= SlabAllocator::MaxSmallSize; ++size)
+        {
+            const uint32_t sizeClass = SlabAllocator::SizeClassOf(size);
+            ASSERT_LT(sizeClass, SlabAllocator::ClassCount);
+            ASSERT_GE(SlabAllocator::ClassSize(sizeClass), size);
+            if (sizeClass > 0)
+            {
+                ASSERT_LT(SlabAllocator::ClassSize(sizeClass - 1), size);
+            }
+        }
+    }
+
+    TEST(SlabAllocatorTest, ReusesFreedBlocks)
+    {
+        SlabAllocator allocator;
+
+        std::vector<void*> blocks;
+        for (size_t i = 0; i < 5000; ++i)
+        {
+            void* p = allocator.Allocate(8 + i % 300);
+            ASSERT_TRUE(IsAligned(p, SlabAllocator::BlockAlignment));
+            std::memset(p, 0xAB, 8 + i % 300);
+            blocks.push_back(p);
+        }
+
+        const size_t slabs = allocator.GetStats().slabCount;
+        for (void* p : blocks)
+            allocator.Free(p);
+
+        SlabAllocator::Stats stats = allocator.GetStats();
+        EXPECT_EQ(stats.allocations, 5000u);
+        EXPECT_EQ(stats.frees, 5000u);
+        EXPECT_EQ(stats.liveBytes, 0u);
+
+        for (size_t i = 0; i < 5000; ++i)
+            blocks[i] = allocator.Allocate(8 + i % 300);
+
+        EXPECT_EQ(allocator.GetStats().slabCount, slabs);
+        for (void* p : blocks)
+            allocator.Free(p);
+
+        // Large and over-aligned requests bypass the slabs
+        void* large = allocator.Allocate(100000);
+        void* aligned = allocator.Allocate(64, 256);
+        EXPECT_TRUE(IsAligned(aligned, 256));
+        EXPECT_GT(allocator.GetStats().reservedBytes, slabs * SlabAllocator::SlabSize + 100000);
+        allocator.Free(large);
+        allocator.Free(aligned);
+        EXPECT_EQ(allocator.GetStats().liveBytes, 0u);
+    }
+
+    TEST(SlabAllocatorTest, FreesFromOtherThreads)
+    {
+        SlabAllocator allocator;
+        constexpr size_t Count = 20000;
+
+        std::vector<uint64_t*> blocks(Count);
+        std::thread producer {[&]
+        {
+            for (size_t i = 0; i < Count; ++i)
+            {
+                blocks[i] = static_cast<uint64_t*>(allocator.Allocate(sizeof(uint64_t) * (1 + i % 8)));
+                *blocks[i] = i;
+            }
+        }};
+        producer.join();
+
+        // Each block goes back through its slab's remote free stack
+        std::vector<std::thread> consumers;
+        for (size_t t = 0; t < 4; ++t)
+            consumers.emplace_back([&, t]
+            {
+                for (size_t i = t; i < Count; i += 4)
+                {
+                    EXPECT_EQ(*blocks[i], i);
+                    allocator.Free(blocks[i]);
+                }
+            });
+        for (std::thread& consumer : consumers)
+            consumer.join();
+
+        SlabAllocator::Stats stats = allocator.GetStats();
+        EXPECT_EQ(stats.remoteFrees, Count);
+        EXPECT_EQ(stats.liveBytes, 0u);
+
+        // A new thread takes over the producer's heap and collects the remote frees
+        const size_t slabs = stats.slabCount;
+        std::thread reuse {[&]
+        {
+            for (size_t i = 0; i < Count; ++i)
+                blocks[i] = static_cast<uint64_t*>(allocator.Allocate(sizeof(uint64_t) * (1 + i % 8)));
+            for (size_t i = 0; i < Count; ++i)
+                allocator.Free(blocks[i]);
+        }};
+        reuse.join();
+
+        EXPECT_EQ(allocator.GetStats().slabCount, slabs);
+    }
+
+    TEST(SlabAllocatorTest, ConcurrentAllocateAndRemoteFree)
+    {
+        SlabAllocator allocator;
+        constexpr int Threads = 4;
+        constexpr int Rounds = 20000;
+
+        // Every thread frees half of what it allocates and hands the rest to its neighbour
+        std::vector<std::vector<void*>> handoff(Threads);
+        std::vector<std::mutex> locks(Threads);
+
+        std::vector<std::thread> threads;
+        for (int t = 0; t < Threads; ++t)
+            threads.emplace_back([&, t]
+            {
+                for (int i = 0; i < Rounds; ++i)
+                {
+                    void* p = allocator.Allocate(16 + (i * 7) % 500);
+                    if (i % 2)
+                        allocator.Free(p);
+                    else
+                    {
+                        std::lock_guard lock {locks[(t + 1) % Threads]};
+                        handoff[(t + 1) % Threads].push_back(p);
+                    }
+
+                    if (i % 64 == 0)
+                    {
+                        std::vector<void*> mine;
+                        {
+                            std::lock_guard lock {locks[t]};
+                            mine.swap(handoff[t]);
+                        }
+                        for (void* q : mine)
+                            allocator.Free(q);
+                    }
+                }
+            });
+        for (std::thread& thread : threads)
+            thread.join();
+
+        for (auto& blocks : handoff)
+            for (void* p : blocks)
+                allocator.Free(p);
+
+        SlabAllocator::Stats stats = allocator.GetStats();
+        EXPECT_EQ(stats.allocations, static_cast<uint64_t>(Threads * Rounds));
+        EXPECT_EQ(stats.frees, stats.allocations);
+        EXPECT_EQ(stats.liveBytes, 0u);
+        EXPECT_GT(stats.remoteFrees, 0u);
+    }
+
+    TEST(SlabAllocatorTest, BacksRefAndScope)
+    {
+        SlabAllocator allocator;
+        SlabStdAllocator<std::string> alloc {allocator};
+
+        {
+            Ref<std::string> ref = CreateRef<std::string>(std::allocator_arg, alloc, "shared through the slab allocator");
+            auto scope = CreateScope<std::string>(std::allocator_arg, alloc, "owned through the slab allocator");
+            Ref<std::string> copy = ref;
+
+            EXPECT_EQ(*copy, "shared through the slab allocator");
+            EXPECT_EQ(*scope, "owned through the slab allocator");
+            EXPECT_EQ(allocator.GetStats().allocations, 2u);
+        }
+
+        EXPECT_EQ(allocator.GetStats().liveBytes, 0u);
+
+        std::vector<int, SlabStdAllocator<int>> values {alloc};
+        for (int i = 0; i < 1000; ++i)
+            values.push_back(i);
+        EXPECT_EQ(values[999], 999);
+    }
+}
@@ -0,0 +1,81 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "../../include/Math/Geometry/Spline.hpp"
+
+namespace lux::math
+{
+    static std::vector<Vector3f> ControlPoints()
+    {
+        return {
+            Vector3f{0.0f, 0.0f, 0.0f}, Vector3f{1.0f, 2.0f, 0.0f}, Vector3f{3.0f, 3.0f, 1.0f}, Vector3f{4.0f, 0.0f, 2.0f},
+            Vector3f{6.0f, -1.0f, 2.0f}, Vector3f{7.0f, 1.0f, 0.0f}, Vector3f{9.0f, 2.0f, -1.0f}
+        };
+    }
+
+    static void ExpectNear(const Vector3f& a, const Vector3f& b, float tolerance)
+    {
+        EXPECT_NEAR(a.GetX(), b.GetX(), tolerance);
+        EXPECT_NEAR(a.GetY(), b.GetY(), tolerance);
+        EXPECT_NEAR(a.GetZ(), b.GetZ(), tolerance);
+    }
+
+    TEST(SplineTest, CurvesMeetTheirDefiningPoints)
+    {
+        const std::vector<Vector3f> points = ControlPoints();
+
+        Spline catmullRom{SplineType::CATMULL_ROM, points};
+        ASSERT_EQ(catmullRom.SegmentCount(), 4u);
+        for (size_t segment = 0; segment <= 4; ++segment)
+            ExpectNear(catmullRom.Evaluate(static_cast<float>(segment) / 4.0f), points[segment + 1], 1e-5f);
+
+        Spline bezier{SplineType::BEZIER, points};
+        ASSERT_EQ(bezier.SegmentCount(), 2u);
+        ExpectNear(bezier.Evaluate(0.0f), points[0], 1e-5f);
+        ExpectNear(bezier.Evaluate(0.5f), points[3], 1e-5f);
+        ExpectNear(bezier.Evaluate(1.0f), points[6], 1e-5f);
+
+        // A uniform B-spline starts at (P0 + 4 P1 + P2) / 6
+        Spline bSpline{SplineType::B_SPLINE, points};
+        ExpectNear(bSpline.Evaluate(0.0f), (points[0] + points[1] * 4.0f + points[2]) * (1.0f / 6.0f), 1e-5f);
+    }
+
+    TEST(SplineTest, ArcLengthOfStraightLine)
+    {
+        std::vector<Vector3f> line;
+        for (int i = 0; i < 8; ++i)
+            line.push_back(Vector3f{static_cast<float>(i * i), 0.0f, 0.0f});
+
+        // Uneven control point spacing makes the speed vary with t, the distance lookup must not
+        Spline spline{SplineType::B_SPLINE, line, 64};
+        const float start = spline.Evaluate(0.0f).GetX();
+        EXPECT_NEAR(spline.Length(), spline.Evaluate(1.0f).GetX() - start, 1e-3f);
+
+        for (float distance = 0.0f; distance <= spline.Length(); distance += spline.Length() / 10.0f)
+            EXPECT_NEAR(spline.EvaluateAtDistance(distance).GetX() - start, distance, 1e-2f);
+    }
+
+    TEST(SplineTest, BatchMatchesScalar)
+    {
+        const std::vector<Vector3f> points = ControlPoints();
+        Spline spline{SplineType::CATMULL_ROM, points};
+
+        // Outside [0, 1] and past the end on purpose, both are clamped
+        constexpr size_t count = 37;
+        std::vector<float> t(count), distances(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            t[i] = static_cast<float>(i) / static_cast<float>(count - 3) - 0.02f;
+            distances[i] = spline.Length() * t[i];
+        }
+
+        std::vector<float> x(count), y(count), z(count);
+        spline.Evaluate(t, Vector3Stream{x, y, z});
+        for (size_t i = 0; i < count; ++i)
+            ExpectNear(Vector3f{x[i], y[i], z[i]}, spline.Evaluate(t[i]), 1e-5f);
+
+        spline.EvaluateAtDistance(distances, Vector3Stream{x, y, z});
+        for (size_t i = 0; i < count; ++i)
+            ExpectNear(Vector3f{x[i], y[i], z[i]}, spline.EvaluateAtDistance(distances[i]), 1e-5f);
+    }
+}
@@ -1,5 +1,8 @@
 #include <gtest/gtest.h>
+#include "glew/include/GL/glew.h"
+#include "GLFW/glfw3.h"
 #include "../../include/Renderer/Texture/Texture2D.hpp"
+#include "../../include/Memory/MemoryTracker.hpp"
 
 /*
 class TextureTest : public ::testing::Test
@@ -93,4 +96,82 @@ TEST_F(TextureTest, InvalidChannels)
     EXPECT_THROW(Texture2D("test/textures/test.png", 2, 2, 0), std::invalid_argument);
     EXPECT_THROW(Texture2D("test/textures/test.png", 2, 2, 5), std::invalid_argument);
 }
-*/
\ No newline at end of file
+*/
+
+namespace lux
+{
+    // Textures need a context, the tests run before the application creates its window
+    class TextureContextTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            if (!glfwInit())
+                GTEST_SKIP() << "No display to create a GL context on";
+
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 4);
+            glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 1);
+            glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+            glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+            m_window = glfwCreateWindow(16, 16, "TextureTest", nullptr, nullptr);
+            if (!m_window)
+                GTEST_SKIP() << "Failed to create a hidden GL context";
+
+            glfwMakeContextCurrent(m_window);
+            if (glewInit() != GLEW_OK)
+                GTEST_SKIP() << "Failed to initialize GLEW";
+        }
+
+        void TearDown() override
+        {
+            if (m_window)
+                glfwDestroyWindow(m_window);
+            glfwTerminate();
+        }
+
+        static TextureSpecification Specs()
+        {
+            return TextureSpecification
+            {
+                .width = 0,
+                .height = 0,
+                .channels = 0,
+                .mipMap = false,
+                .type = TextureType::Texture2D,
+                .format = GPUTexturePixelFormat::RGB,
+                .minFilter = TextureFilter::Linear,
+                .magFilter = TextureFilter::Linear,
+                .mipmapMinFilter = TextureFilter::LinearMipmapLinear,
+                .mipmapMagFilter = TextureFilter::Linear,
+                .wrapR = TextureWrap::Repeat,
+                .wrapS = TextureWrap::Repeat,
+                .wrapT = TextureWrap::Repeat,
+                .samplerName = "diffuseTexture",
+                .filePath = {"assets/wood.png"}
+            };
+        }
+
+        GLFWwindow* m_window = nullptr;
+    };
+
+    TEST_F(TextureContextTest, MoveAssignReleasesTheReplacedTexture)
+    {
+        const uint64_t before = MemoryTracker::GetSnapshot()[MemoryTag::TEXTURE].liveBytes;
+
+        {
+            Texture2D target {Specs()};
+            Texture2D source {Specs()};
+            ASSERT_GT(source.GetGPUBytes(), 0u);
+            EXPECT_EQ(MemoryTracker::GetSnapshot()[MemoryTag::TEXTURE].liveBytes, before + 2 * source.GetGPUBytes());
+
+            const size_t bytes = source.GetGPUBytes();
+            target = std::move(source);
+            EXPECT_EQ(target.GetGPUBytes(), bytes);
+            EXPECT_EQ(source.GetGPUBytes(), 0u);
+            EXPECT_EQ(MemoryTracker::GetSnapshot()[MemoryTag::TEXTURE].liveBytes, before + bytes);
+        }
+
+        EXPECT_EQ(MemoryTracker::GetSnapshot()[MemoryTag::TEXTURE].liveBytes, before);
+    }
+}
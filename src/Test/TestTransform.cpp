@@ -0,0 +1,112 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "../../include/Math/Transform.hpp"
+
+namespace lux::math
+{
+    static Qf AxisAngle(float angle, const Vector3f& axis)
+    {
+        Vector3f n = Vector3f{axis}.Normalize();
+        float s = std::sin(angle * 0.5f);
+        return Qf(std::cos(angle * 0.5f), n.GetX() * s, n.GetY() * s, n.GetZ() * s);
+    }
+
+    static void ExpectNear(const Vector4f& actual, const Vector4f& expected)
+    {
+        for (size_t i = 0; i < 4; ++i)
+            EXPECT_NEAR(actual[i], expected[i], 1e-4f);
+    }
+
+    TEST(TransformTest, TrsDataIs40Bytes)
+    {
+        EXPECT_EQ(sizeof(Vector3f) * 2 + sizeof(Qf), 40u);
+    }
+
+    TEST(TransformTest, RotationMatchesAxisAngleMatrix)
+    {
+        const Vector3f axis {0.3f, 1.0f, -0.5f};
+        Transform t {Vector3f{}, AxisAngle(0.7f, axis)};
+        Matrix4f expected = Matrix4f::Rotate(0.7f, axis);
+        Matrix4f m = t.ToMatrix4();
+
+        for (Vector4f v : {Vector4f(1, 0, 0, 0), Vector4f(0, 1, 0, 0), Vector4f(0, 0, 1, 0), Vector4f(2, -3, 4, 1)})
+            ExpectNear(m * v, expected * v);
+
+        EXPECT_EQ(m.GetShape(), MatShape::RIGID);
+    }
+
+    TEST(TransformTest, MapsPointsAsTranslateRotateScale)
+    {
+        const Vector3f position {1.5f, -2.0f, 0.25f};
+        const Vector3f scale {2.0f, 0.5f, 1.25f};
+        const Vector3f axis {-1.0f, 0.2f, 0.4f};
+        Transform t {position, AxisAngle(1.3f, axis), scale};
+        Matrix4f rotation = Matrix4f::Rotate(1.3f, axis);
+        Matrix4f m = t.ToMatrix4();
+
+        Vector3f p {3.0f, -1.0f, 0.5f};
+        Vector4f scaled = rotation * Vector4f(p.GetX() * scale.GetX(), p.GetY() * scale.GetY(), p.GetZ() * scale.GetZ(), 1.0f);
+        ExpectNear(m * Vector4f(p, 1.0f), Vector4f(scaled[0] + position.GetX(), scaled[1] + position.GetY(),
+                                                   scaled[2] + position.GetZ(), 1.0f));
+
+        EXPECT_EQ(m.GetShape(), MatShape::AFFINE);
+        ExpectNear(m.Inverse() * (m * Vector4f(p, 1.0f)), Vector4f(p, 1.0f));
+    }
+
+    TEST(TransformTest, CachedMatrixFollowsSetters)
+    {
+        Transform t {Vector3f{1.0f, 2.0f, 3.0f}};
+        ExpectNear(t.GetMatrix() * Vector4f(0, 0, 0, 1), Vector4f(1, 2, 3, 1));
+
+        t.SetPosition(Vector3f{-4.0f, 0.0f, 1.0f});
+        ExpectNear(t.GetMatrix() * Vector4f(0, 0, 0, 1), Vector4f(-4, 0, 1, 1));
+
+        t.Translate(Vector3f{1.0f, 1.0f, 1.0f});
+        t.SetScale(Vector3f{2.0f, 2.0f, 2.0f});
+        ExpectNear(t.GetMatrix() * Vector4f(1, 0, 0, 1), Vector4f(-1, 1, 2, 1));
+
+        t.Rotate(AxisAngle(std::numbers::pi_v<float> * 0.5f, Vector3f{0.0f, 0.0f, 1.0f}));
+        ExpectNear(t.GetMatrix() * Vector4f(1, 0, 0, 1), Vector4f(-3, 3, 2, 1));
+    }
+
+    TEST(TransformTest, BatchComposeMatchesSingleCompose)
+    {
+        // Odd count so every backend also runs its scalar tail
+        std::vector<Transform> transforms;
+        for (int i = 0; i < 13; ++i)
+            transforms.emplace_back(Vector3f{i * 1.5f, -i * 0.5f, 2.0f},
+                                    AxisAngle(0.3f * i, Vector3f{1.0f, i * 0.1f, -0.5f}),
+                                    Vector3f{1.0f + i * 0.1f, 0.5f, 2.0f - i * 0.05f});
+
+        std::vector<PackedMatrix4f> packed = ComposeMatrices(transforms);
+
+        ASSERT_EQ(packed.size(), transforms.size());
+        for (size_t i = 0; i < transforms.size(); ++i)
+        {
+            PackedMatrix4f expected = PackedMatrix4f::From(transforms[i].ToMatrix4());
+            for (size_t k = 0; k < 16; ++k)
+                EXPECT_NEAR(packed[i].data[k], expected.data[k], 1e-5f);
+        }
+    }
+
+    TEST(TransformTest, IndexedComposeMatchesSingleCompose)
+    {
+        std::vector<Transform> transforms;
+        for (int i = 0; i < 20; ++i)
+            transforms.emplace_back(Vector3f{i * 0.5f, 1.0f, -i * 2.0f}, AxisAngle(0.2f * i, Vector3f{0.0f, 1.0f, 0.3f}),
+                                    Vector3f{1.0f, 1.0f + i * 0.2f, 1.0f});
+
+        // Out of order with a repeat, and an odd count for the scalar tail
+        const std::vector<uint32_t> indices {19, 3, 3, 7, 0, 12, 18, 5, 11, 2, 16};
+        std::vector<PackedMatrix4f> packed(indices.size());
+        ComposeMatrices(transforms, indices, packed);
+
+        for (size_t i = 0; i < indices.size(); ++i)
+        {
+            PackedMatrix4f expected = PackedMatrix4f::From(transforms[indices[i]].ToMatrix4());
+            for (size_t k = 0; k < 16; ++k)
+                EXPECT_NEAR(packed[i].data[k], expected.data[k], 1e-5f);
+        }
+    }
+}
@@ -102,6 +102,9 @@ namespace lux
 
     TEST(Vector3Test, AccessOutOfRange)
     {
+        if (!CheckedAccess)
+            GTEST_SKIP() << "Built with LUX_MATH_CHECKS=0";
+
         Vector3<float> vec(1.0f, 2.0f, 3.0f);
         EXPECT_THROW(vec[3], std::out_of_range);
     }
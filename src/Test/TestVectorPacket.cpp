@@ -0,0 +1,137 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "../../include/Math/VectorPacket.hpp"
+
+namespace lux::math
+{
+    static std::vector<Vector3f> RandomVectors(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> dist {-10.0f, 10.0f};
+
+        std::vector<Vector3f> vectors;
+        for (size_t i = 0; i < count; ++i)
+            vectors.emplace_back(dist(rng), dist(rng), dist(rng));
+        return vectors;
+    }
+
+    static void ExpectNear(const Vector3f& actual, const Vector3f& expected, float tolerance)
+    {
+        EXPECT_NEAR(actual.GetX(), expected.GetX(), tolerance);
+        EXPECT_NEAR(actual.GetY(), expected.GetY(), tolerance);
+        EXPECT_NEAR(actual.GetZ(), expected.GetZ(), tolerance);
+    }
+
+    TEST(VectorPacketTest, LoadStoreRoundTrips)
+    {
+        constexpr size_t lanes = Vector3Packet::Lanes;
+        const std::vector<Vector3f> in = RandomVectors(2 * lanes + 3, 1);
+        std::vector<Vector3f> out(in.size(), Vector3f(-1.0f, -1.0f, -1.0f));
+
+        size_t i = 0;
+        for (; i + lanes <= in.size(); i += lanes)
+        {
+            const Vector3Packet p = Vector3Packet::Load(in, i);
+            for (size_t lane = 0; lane < lanes; ++lane)
+                ExpectNear(p.Lane(lane), in[i + lane], 0.0f);
+            p.Store(out, i);
+        }
+        Vector3Packet::LoadPartial(in, i).StorePartial(out, i);
+
+        for (size_t k = 0; k < in.size(); ++k)
+            ExpectNear(out[k], in[k], 0.0f);
+
+        const Vector3Packet tail = Vector3Packet::LoadPartial(in, in.size() - 1, Vector3f(7.0f, 8.0f, 9.0f));
+        ExpectNear(tail.Lane(0), in.back(), 0.0f);
+        for (size_t lane = 1; lane < lanes; ++lane)
+            ExpectNear(tail.Lane(lane), Vector3f(7.0f, 8.0f, 9.0f), 0.0f);
+
+        std::vector<Vector4f> in4;
+        for (size_t k = 0; k < lanes + 1; ++k)
+            in4.emplace_back(k * 1.0f, k * 2.0f, k * 3.0f, k * 4.0f);
+        std::vector<Vector4f> out4(in4.size());
+
+        Vector4Packet::Load(in4, 0).Store(out4, 0);
+        Vector4Packet::LoadPartial(in4, lanes).StorePartial(out4, lanes);
+        for (size_t k = 0; k < in4.size(); ++k)
+            for (size_t c = 0; c < 4; ++c)
+                EXPECT_EQ(out4[k][c], in4[k][c]);
+    }
+
+    TEST(VectorPacketTest, ArithmeticMatchesScalar)
+    {
+        constexpr size_t lanes = Vector3Packet::Lanes;
+        const std::vector<Vector3f> a = RandomVectors(lanes, 2);
+        const std::vector<Vector3f> b = RandomVectors(lanes, 3);
+
+        const Vector3Packet pa = Vector3Packet::Load(a, 0);
+        const Vector3Packet pb = Vector3Packet::Load(b, 0);
+        const simd::FloatN two = simd::SplatN(2.0f);
+
+        std::vector<float> dots(lanes), lengths(lanes);
+        simd::StoreN(dots.data(), Dot(pa, pb));
+        simd::StoreN(lengths.data(), Length(pa));
+
+        for (size_t lane = 0; lane < lanes; ++lane)
+        {
+            const Vector3f& u = a[lane];
+            const Vector3f& v = b[lane];
+
+            ExpectNear((pa + pb).Lane(lane), u + v, 1e-5f);
+            ExpectNear((pa - pb).Lane(lane), u - v, 1e-5f);
+            ExpectNear((-pa).Lane(lane), u * -1.0f, 0.0f);
+            ExpectNear((pa * two).Lane(lane), u * 2.0f, 1e-5f);
+            ExpectNear((pa / two).Lane(lane), u * 0.5f, 1e-5f);
+            ExpectNear(MulAdd(pa, two, pb).Lane(lane), u * 2.0f + v, 1e-4f);
+            ExpectNear(Cross(pa, pb).Lane(lane), Cross(u, v), 1e-3f);
+            EXPECT_NEAR(dots[lane], u.Dot(v), 1e-3f);
+            EXPECT_NEAR(lengths[lane], u.Length(), 1e-4f);
+        }
+    }
+
+    TEST(VectorPacketTest, NormalizeIsAccurateAndKeepsZero)
+    {
+        constexpr size_t lanes = Vector3Packet::Lanes;
+        std::vector<Vector3f> vectors = RandomVectors(64 * lanes, 4);
+        vectors[0] = Vector3f(0.0f, 0.0f, 0.0f);
+        vectors[1 % vectors.size()] = Vector3f(1e-18f, 0.0f, 0.0f);
+        vectors[2 % vectors.size()] = Vector3f(3e18f, -4e18f, 0.0f);
+
+        for (size_t i = 0; i < vectors.size(); i += lanes)
+        {
+            const Vector3Packet n = Normalize(Vector3Packet::Load(vectors, i));
+            for (size_t lane = 0; lane < lanes; ++lane)
+            {
+                Vector3f expected = vectors[i + lane];
+                if (expected.Length() == 0.0f)
+                {
+                    ExpectNear(n.Lane(lane), expected, 0.0f);
+                    continue;
+                }
+
+                expected.Normalize();
+                ExpectNear(n.Lane(lane), expected, 1e-6f);
+            }
+        }
+    }
+
+    TEST(VectorPacketTest, SelectPicksPerLane)
+    {
+        constexpr size_t lanes = Vector3Packet::Lanes;
+        const std::vector<Vector3f> a = RandomVectors(lanes, 5);
+        const Vector3Packet pa = Vector3Packet::Load(a, 0);
+        const Vector3Packet zero;
+
+        // keep the lanes with positive x, the rest become zero
+        const Vector3Packet kept = Select(simd::LessN(simd::SplatN(0.0f), pa.x), pa, zero);
+        for (size_t lane = 0; lane < lanes; ++lane)
+            ExpectNear(kept.Lane(lane), a[lane].GetX() > 0.0f ? a[lane] : Vector3f(0.0f, 0.0f, 0.0f), 0.0f);
+
+        const Vector4Packet p4 {pa, simd::SplatN(1.0f)};
+        const Vector4Packet flipped = Select(simd::LessN(pa.y, simd::SplatN(0.0f)), p4 * simd::SplatN(-1.0f), p4);
+        for (size_t lane = 0; lane < lanes; ++lane)
+            EXPECT_EQ(flipped.Lane(lane).GetW(), a[lane].GetY() < 0.0f ? -1.0f : 1.0f);
+    }
+}
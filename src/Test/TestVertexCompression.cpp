@@ -0,0 +1,99 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "../../include/Math/VertexCompression.hpp"
+
+namespace lux::math
+{
+    static std::vector<StandardVertex> RandomVertices(size_t count, unsigned seed)
+    {
+        std::mt19937 rng {seed};
+        std::uniform_real_distribution<float> position {-50.0f, 80.0f};
+        std::uniform_real_distribution<float> uv {-2.0f, 3.0f};
+        std::normal_distribution<float> normal {0.0f, 1.0f};
+
+        std::vector<StandardVertex> vertices;
+        for (size_t i = 0; i < count; ++i)
+        {
+            Vector3f n {normal(rng), normal(rng), normal(rng)};
+            n.Normalize();
+            vertices.push_back({Vector3f{position(rng), position(rng) * 0.1f, position(rng)}, Vector2f{uv(rng), uv(rng)}, n});
+        }
+        return vertices;
+    }
+
+    TEST(VertexCompressionTest, OctahedralErrorIsBounded)
+    {
+        float worstAngle = 0.0f;
+        auto check = [&](Vector3f n)
+        {
+            n.Normalize();
+            const auto [x, y] = OctahedralEncode(n);
+            const Vector3f decoded = OctahedralDecode(x, y);
+            // atan2 of |cross| and dot, acos loses everything below ~3e-4 radians in float
+            const float angle = std::atan2(Cross(decoded, n).Length(), decoded.Dot(n));
+            worstAngle = std::max(worstAngle, angle);
+        };
+
+        // the axes and the fold diagonals are where the encoding is most likely to break
+        for (float x : {-1.0f, 0.0f, 1.0f})
+            for (float y : {-1.0f, 0.0f, 1.0f})
+                for (float z : {-1.0f, 0.0f, 1.0f})
+                    if (x != 0.0f || y != 0.0f || z != 0.0f)
+                        check(Vector3f{x, y, z});
+
+        for (const auto& vertex : RandomVertices(20000, 3))
+            check(vertex.normal);
+
+        EXPECT_LT(worstAngle, 1e-4f);
+    }
+
+    TEST(VertexCompressionTest, CompressedVerticesDecodeWithinHalfAStep)
+    {
+        // 27 vertices leave a remainder with every lane count
+        const auto vertices = RandomVertices(27, 5);
+        const auto q = VertexQuantization::FromVertices(vertices);
+
+        std::vector<CompressedVertex> compressed(vertices.size());
+        CompressVertices(vertices, q, compressed);
+
+        for (size_t i = 0; i < vertices.size(); ++i)
+        {
+            const StandardVertex decoded = DecompressVertex(compressed[i], q);
+            for (size_t k = 0; k < 3; ++k)
+                EXPECT_NEAR(decoded.position[k], vertices[i].position[k], q.positionScale[k] / 131070.0f * 1.01f) << i;
+
+            for (size_t k = 0; k < 2; ++k)
+                EXPECT_NEAR(decoded.uv[k], vertices[i].uv[k], q.uvScale[k] / 131070.0f * 1.01f) << i;
+
+            const auto [x, y] = OctahedralEncode(vertices[i].normal);
+            EXPECT_EQ(compressed[i].normal[0], x) << i;
+            EXPECT_EQ(compressed[i].normal[1], y) << i;
+            EXPECT_EQ(compressed[i].padding, 0) << i;
+        }
+    }
+
+    TEST(VertexCompressionTest, BoundsMapToTheFullRange)
+    {
+        std::vector<StandardVertex> vertices
+        {
+            {Vector3f{-1.0f, 2.0f, 5.0f}, Vector2f{0.0f, 1.0f}, Vector3f{0.0f, 0.0f, 1.0f}},
+            {Vector3f{3.0f, 2.0f, -5.0f}, Vector2f{1.0f, 0.0f}, Vector3f{0.0f, 0.0f, -1.0f}}
+        };
+
+        const auto q = VertexQuantization::FromVertices(vertices);
+        std::vector<CompressedVertex> compressed(vertices.size());
+        CompressVertices(vertices, q, compressed);
+
+        EXPECT_EQ(compressed[0].position[0], 0);
+        EXPECT_EQ(compressed[1].position[0], 65535);
+        EXPECT_EQ(compressed[0].position[1], 0);  // flat axis: zero scale, everything at the offset
+        EXPECT_EQ(compressed[0].position[2], 65535);
+        EXPECT_EQ(compressed[0].uv[1], 65535);
+
+        const StandardVertex flat = DecompressVertex(compressed[1], q);
+        EXPECT_FLOAT_EQ(flat.position[1], 2.0f);
+        EXPECT_NEAR(flat.normal[2], -1.0f, 1e-6f);
+    }
+}